@@ -61,6 +61,7 @@ endfunction()
 macro(get_list_of_supported_optimizations PLATFORMS_LIST)
     list(APPEND PLATFORMS_LIST "")
     list(APPEND PLATFORMS_LIST "px")
+    list(APPEND PLATFORMS_LIST "avx2")
     list(APPEND PLATFORMS_LIST "avx512")
 endmacro(get_list_of_supported_optimizations)
 
@@ -253,6 +254,20 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}scan_i.cpp "}\n")
 
+        #
+        # Write scan_program table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_program.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "scan_program_table_t ${PLATFORM_PREFIX}scan_program_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "\t${PLATFORM_PREFIX}qplc_scan_program_8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "\t${PLATFORM_PREFIX}qplc_scan_program_16u8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "\t${PLATFORM_PREFIX}qplc_scan_program_32u8u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_program.cpp "}\n")
+
         #
         # Write pack_index table
         #
@@ -360,7 +375,18 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "namespace qpl::core_sw::dispatcher\n{\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "crc64_table_t ${PLATFORM_PREFIX}crc64_table = {\n")
 
-        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t${PLATFORM_PREFIX}qplc_crc64};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64_init_constants),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64_fold)};\n")
+
+        # VPCLMULQDQ isn't a part of the avx512 feature set, so the kernel has a separate table selected by CPUID
+        if (${PLATFORM_VALUE} MATCHES "avx512")
+            file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "crc64_table_t ${PLATFORM_PREFIX}vpclmulqdq_crc64_table = {\n")
+
+            file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64),\n")
+            file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64_init_constants),\n")
+            file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64_fold_vpclmulqdq)};\n")
+        endif()
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "}\n")
 
@@ -376,6 +402,21 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}xor_checksum.cpp "}\n")
 
+        #
+        # Write zero_compress function table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "zero_compress_table_t ${PLATFORM_PREFIX}zero_compress_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "\t${PLATFORM_PREFIX}qplc_zero_compress_16u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "\t${PLATFORM_PREFIX}qplc_zero_compress_32u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "\t${PLATFORM_PREFIX}qplc_zero_decompress_16u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "\t${PLATFORM_PREFIX}qplc_zero_decompress_32u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "}\n")
+
         #
         # Write deflate functions table
         #
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_BATCH_H_
+#define QPL_BATCH_H_
+
+#include "qpl/c_api/job.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup JOB_API_DEFINITIONS
+ * @{
+ */
+
+/**
+ * @brief Structure for a group of jobs that are submitted and polled together
+ *
+ * @note All arrays are allocated at the application side: `statuses_ptr` must hold `jobs_count` elements
+ *       and `completion_bitmap_ptr` must hold `(jobs_count + 63) / 64` elements.
+ */
+typedef struct {
+    qpl_job    **jobs_ptr;                /**< Array of pointers to initialized jobs */
+    uint32_t   jobs_count;                /**< Number of jobs in the batch */
+    uint32_t   threads_count;             /**< Maximal number of threads running software jobs (including the calling one) */
+    qpl_status *statuses_ptr;             /**< Array with statuses of the jobs, valid for completed jobs only */
+    uint64_t   *completion_bitmap_ptr;    /**< Bit `i` is set once the job `jobs_ptr[i]` is completed */
+    uint32_t   completed_count;           /**< Number of completed jobs */
+} qpl_batch;
+
+/** @} */
+
+/**
+ * @addtogroup JOB_API_FUNCTIONS
+ * @{
+ */
+
+/**
+ * @brief Submits all jobs of the batch
+ *
+ * @param[in,out]  batch_ptr  Pointer to the @ref qpl_batch structure
+ *
+ * @details Jobs that are supported on the hardware path are enqueued back-to-back without waiting for each other.
+ *          Other jobs (and @ref qpl_path_auto jobs that couldn't be enqueued) are executed on the software path
+ *          by the internal thread pool before the function returns, so they are completed at once.
+ *          Completion bitmap, statuses and completed jobs counter are reset on every submission.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_SIZE_ERR if the batch is empty.
+ */
+QPL_API(qpl_status, qpl_submit_batch, (qpl_batch * batch_ptr))
+
+/**
+ * @brief Polls every incomplete job of the batch once and updates the completion bitmap
+ *
+ * @param[in,out]  batch_ptr  Pointer to the @ref qpl_batch structure
+ *
+ * @return
+ *     - @ref QPL_STS_OK if all jobs are completed (statuses of the jobs are kept in `statuses_ptr`);
+ *     - @ref QPL_STS_BEING_PROCESSED if some jobs are still in progress;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_check_batch, (qpl_batch * batch_ptr))
+
+/**
+ * @brief Waits until all jobs of the batch are completed
+ *
+ * @param[in,out]  batch_ptr  Pointer to the @ref qpl_batch structure
+ *
+ * @return
+ *     - @ref QPL_STS_OK (statuses of the jobs are kept in `statuses_ptr`);
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_wait_batch, (qpl_batch * batch_ptr))
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_BATCH_H_
@@ -83,7 +83,7 @@ extern "C" {
 #define QPL_FLAG_LAST 0x0002u
 
 /**
- * Polynomial 0x11edc6f41 is used, which is the one used by iSCSI
+ * Polynomial 0x11edc6f41 is used, which is the one used by iSCSI (filtering and zero operations)
  */
 #define QPL_FLAG_CRC32C 0x0004u
 
@@ -177,7 +177,7 @@ extern "C" {
 
 /* Data Integrity & Aggregates flags */
 /**
- * Filtering only: don't calculate CRC and XOR checksums
+ * Filtering and zero operations only: don't calculate CRC and XOR checksums
  */
 #define QPL_FLAG_OMIT_CHECKSUMS 0x00100000u
 
@@ -186,6 +186,25 @@ extern "C" {
  */
 #define QPL_FLAG_OMIT_AGGREGATES 0x00200000u
 
+/* Source-2 flags */
+/**
+ * Select and expand only: Source-2 is decompressed and streamed along with Source-1 (software path only)
+ */
+#define QPL_FLAG_SRC2_DECOMPRESS_ENABLE 0x00800000u
+
+/**
+ * Select and expand only: Source-2 is stored in the Parquet RLE format (software path only)
+ */
+#define QPL_FLAG_SRC2_PRLE 0x01000000u
+
+/* Analytics flags */
+/**
+ * Scan only: element count, buffer lengths and bit-vector aggregates are taken from and returned to
+ * the 64-bit fields of the job, the 32-bit counterparts are left intact except the truncated sum_value.
+ * Supports uncompressed packed-array sources and nominal output (software path only)
+ */
+#define QPL_FLAG_ANALYTICS_64 0x02000000u
+
 /** @} */
 
 /**
@@ -226,6 +245,11 @@ typedef enum {
 
     qpl_op_crc64      = 0x05u,    /**< Performs @ref CRC_OPERATION */
 
+    qpl_op_z_decompress32 = 0x08u,    /**< Performs Zero Decompress operation for 32-bit words (@ref ZERO_OPERATIONS group) */
+    qpl_op_z_decompress16 = 0x09u,    /**< Performs Zero Decompress operation for 16-bit words (@ref ZERO_OPERATIONS group) */
+    qpl_op_z_compress32   = 0x0Cu,    /**< Performs Zero Compress operation for 32-bit words (@ref ZERO_OPERATIONS group) */
+    qpl_op_z_compress16   = 0x0Du,    /**< Performs Zero Compress operation for 16-bit words (@ref ZERO_OPERATIONS group) */
+
     // start filter operations
     /**
      * Affiliation to boolean histogram filter operation (@ref ANALYTIC_OPERATIONS group)
@@ -273,9 +297,70 @@ typedef enum {
     /**
      * Compare "not-in-range" filter operation (@ref ANALYTIC_OPERATIONS group)
      */
-    qpl_op_scan_not_range = 0x27u
+    qpl_op_scan_not_range = 0x27u,
+
+    /**
+     * Scan evaluating several comparisons combined with AND/OR/NOT, see @ref qpl_scan_program
+     * (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_scan_program = 0x28u
 } qpl_operation;
 
+/**
+ * @brief Maximal number of instructions in a @ref qpl_scan_program
+ */
+#define QPL_SCAN_PROGRAM_MAX_SIZE 16u
+
+/**
+ * @brief Maximal number of @ref qpl_scan_predicate instructions in a @ref qpl_scan_program
+ */
+#define QPL_SCAN_PROGRAM_MAX_PREDICATES 8u
+
+/**
+ * @brief Enumerates instructions of the @ref qpl_scan_program
+ */
+typedef enum {
+    qpl_scan_predicate = 0u,    /**< Pushes the results of the comparison of each element */
+    qpl_scan_and       = 1u,    /**< Replaces two topmost results with their conjunction */
+    qpl_scan_or        = 2u,    /**< Replaces two topmost results with their disjunction */
+    qpl_scan_not       = 3u     /**< Inverts the topmost result */
+} qpl_scan_instruction_type;
+
+/**
+ * @brief Single instruction of the @ref qpl_scan_program
+ */
+typedef struct {
+    qpl_scan_instruction_type type;          /**< Instruction type */
+    qpl_operation             comparison;    /**< One of qpl_op_scan_eq ... qpl_op_scan_not_range, used by @ref qpl_scan_predicate only */
+    uint32_t                  param_low;     /**< Low parameter of the comparison */
+    uint32_t                  param_high;    /**< High parameter of the comparison */
+} qpl_scan_instruction;
+
+/**
+ * @brief Predicate program evaluated by the @ref qpl_op_scan_program operation.
+ *
+ * @details Instructions are written in postfix notation and evaluated for each element, e.g.
+ *          `a BETWEEN x AND y AND a <> z` is `{range x y}, {ne z}, {and}`.
+ *          The program must leave exactly one result.
+ */
+typedef struct {
+    uint32_t             instructions_count;                       /**< Number of instructions used */
+    qpl_scan_instruction instructions[QPL_SCAN_PROGRAM_MAX_SIZE];  /**< Instructions in postfix order */
+} qpl_scan_program;
+
+/**
+ * @brief Enumerates groups of operations sharing the same internal job buffers.
+ *        A job laid out for a class can perform the operations of this class only.
+ */
+typedef enum {
+    qpl_op_class_all       = 0u,    /**< Any @ref qpl_operation, the layout of @ref qpl_init_job */
+    qpl_op_class_analytics = 1u,    /**< Filter operations (@ref ANALYTIC_OPERATIONS group) */
+    qpl_op_class_inflate   = 2u,    /**< @ref qpl_op_decompress operation */
+    qpl_op_class_deflate   = 3u,    /**< @ref qpl_op_compress operation on any compression level */
+    qpl_op_class_crc64     = 4u,    /**< @ref qpl_op_crc64 operation */
+    qpl_op_class_zero      = 5u     /**< Zero compress and zero decompress operations (@ref ZERO_OPERATIONS group) */
+} qpl_operation_class;
+
 /**
  * @brief Enumerates mini-blocks sizes for the @ref qpl_op_compress and @ref qpl_op_decompress operations.
  */
@@ -344,7 +429,7 @@ typedef enum {
  */
 typedef enum {
     qpl_level_1 = 1,                 /**< The fastest compression with low compression ratio*/
-    qpl_level_2 = 2,                 /**< Not supported */
+    qpl_level_2 = 2,                 /**< Software only, shorter match search than @ref qpl_level_3 */
     qpl_level_3 = 3,                 /**< Medium compression speed, medium compression ratio*/
     qpl_level_4 = 4,                 /**< Not supported */
     qpl_level_5 = 5,                 /**< Not supported */
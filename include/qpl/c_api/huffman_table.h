@@ -189,7 +189,7 @@ qpl_status qpl_huffman_table_get_type(const qpl_huffman_table_t table,
 
 /**
  * @brief API to get size of the table to be serialized.
- * @note Serialization is only supported for serialization_raw format.
+ * @note Serialization is only supported for deflate tables.
  *
  * @param[in]  table    @ref qpl_huffman_table_t object to serialize
  * @param[in]  options  @ref serialization_options_t
@@ -203,7 +203,7 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
 
 /**
  * @brief Serializes qpl_huffman_table_t object.
- * @note Serialization is only supported for serialization_raw format.
+ * @note Serialization is only supported for deflate tables.
  *
  * @param[in] table @ref qpl_huffman_table_t object to serialize
  * @param[out] dump_buffer_ptr serialized object buffer
@@ -232,6 +232,26 @@ qpl_status qpl_huffman_table_deserialize(const uint8_t *const dump_buffer_ptr,
                                          allocator_t allocator,
                                          qpl_huffman_table_t *table_ptr);
 
+/**
+ * @brief Creates huffman table that uses previously serialized tables directly from the buffer without copying.
+ * Buffer must be serialized in @ref serialization_raw format with @ref QPL_SERIALIZATION_FLAG_IN_PLACE flag.
+ *
+ * @note Only the table object itself is allocated, the buffer is neither copied nor owned by the table:
+ * it must be 64-byte aligned, writable (e.g. memory-mapped with MAP_PRIVATE) and stay valid
+ * until the table is destroyed with @ref qpl_huffman_table_destroy.
+ *
+ * @param[in] dump_buffer_ptr serialized object buffer
+ * @param[in] dump_buffer_size serialized object buffer size
+ * @param[in] allocator allocator that must be used
+ * @param[out] table_ptr output parameter for created object
+ *
+ * @return status from @ref qpl_status
+ */
+qpl_status qpl_huffman_table_deserialize_in_place(uint8_t *const dump_buffer_ptr,
+                                                  const size_t dump_buffer_size,
+                                                  allocator_t allocator,
+                                                  qpl_huffman_table_t *table_ptr);
+
 /** @} */
 
 #ifdef __cplusplus
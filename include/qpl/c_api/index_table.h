@@ -115,6 +115,38 @@ QPL_API(qpl_status, qpl_find_mini_block_index, (qpl_index_table * table_ptr,
                                                 uint32_t mini_block_number,
                                                 uint32_t * block_index_ptr))
 
+/**
+ * @brief Decompresses all mini-blocks of an indexed deflate stream on the software path using several threads
+ *
+ * @param table_ptr         Pointer to the table with indices written during the stream compression
+ * @param mini_block_size   Mini-block size used during the stream compression
+ * @param source_ptr        Compressed stream, bit offsets in the table are counted from this pointer
+ * @param source_size       Size of the compressed stream
+ * @param destination_ptr   Destination for the decompressed data
+ * @param destination_size  Size of the destination
+ * @param threads_count     Maximal number of threads to use (including the calling one)
+ * @param output_size_ptr   Is set to the number of decompressed bytes
+ *
+ * @details Mini-block `i` is decompressed into `destination_ptr + i * <mini-block size in bytes>`, and the CRC
+ *          of every decompressed mini-block is checked against the cumulative CRCs stored in the table.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_SIZE_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if `threads_count` is zero;
+ *     - @ref QPL_STS_MORE_OUTPUT_NEEDED if the destination is too small;
+ *     - @ref QPL_STS_INTL_VERIFY_ERR if a mini-block doesn't match the table.
+ */
+QPL_API(qpl_status, qpl_decompress_mini_blocks_parallel, (qpl_index_table * table_ptr,
+                                                          qpl_mini_block_size mini_block_size,
+                                                          uint8_t * source_ptr,
+                                                          uint32_t source_size,
+                                                          uint8_t * destination_ptr,
+                                                          uint32_t destination_size,
+                                                          uint32_t threads_count,
+                                                          uint32_t * output_size_ptr))
+
 /** @} */
 
 #ifdef __cplusplus
@@ -31,12 +31,14 @@ extern "C" {
  * @brief @ref qpl_job extension that holds internal buffers and context for @ref qpl_operation
  */
 struct qpl_aux_data {
-    uint8_t    *compress_state_ptr;      /**< @ref qpl_op_compress operation state */
-    uint8_t    *decompress_state_ptr;    /**< @ref qpl_op_decompress operation state */
-    uint8_t    *analytics_state_ptr;     /**< Analytics @ref qpl_operation buffers */
-    uint8_t    *middle_layer_buffer_ptr; /**< Internal middle-level layer buffer */
-    uint8_t    *hw_state_ptr;            /**< Hardware path execution context */
-    qpl_path_t path;                     /**< @ref qpl_path_t marker */
+    uint8_t             *compress_state_ptr;      /**< @ref qpl_op_compress operation state */
+    uint8_t             *decompress_state_ptr;    /**< @ref qpl_op_decompress operation state */
+    uint8_t             *analytics_state_ptr;     /**< Analytics @ref qpl_operation buffers */
+    uint8_t             *middle_layer_buffer_ptr; /**< Internal middle-level layer buffer */
+    uint8_t             *hw_state_ptr;            /**< Hardware path execution context */
+    qpl_path_t          path;                     /**< @ref qpl_path_t marker */
+    qpl_operation_class op_class;                 /**< @ref qpl_operation_class the buffers are laid out for */
+    uint32_t            async_status;             /**< Status of the job executed by the software executor, accessed atomically */
 };
 
 typedef struct qpl_aux_data qpl_data; /**< Hidden internal state structure */
@@ -60,12 +62,15 @@ typedef struct {
     uint32_t               last_bit_offset;    /**< Actual bits in the last written byte (or word for BE16 format) */
     qpl_compression_levels level;              /**< Compression level - default or high */
     qpl_statistics_mode    statistics_mode;    /**< Represents mode in which deflate should be performed */
+    uint32_t               incompressible_threshold; /**< Software dynamic deflate stores data estimated to compress to at least `incompressible_threshold` percent of its size, 0 uses the default, values above 100 disable the check */
 
     // Tables
     qpl_huffman_table_t   huffman_table;      /**< Huffman table for compression */
 
     qpl_dictionary *dictionary;    /**< The dictionary used for compression / decompression */
 
+    uint32_t verify_interval;    /**< Software path verifies one of every `verify_interval` compressed streams, 0 verifies all */
+
     // Fields for indexing
     qpl_mini_block_size mini_block_size;    /**< Index block (mini-block) size */
     uint64_t            *idx_array;         /**< Index array address */
@@ -103,6 +108,11 @@ typedef struct {
      */
     uint32_t param_high;
 
+    /**
+     * Predicate program for the @ref qpl_op_scan_program operation
+     */
+    const qpl_scan_program *scan_program;
+
     /**
      * Number of initial bytes to be dropped at the start of the Analytics portion of the pipeline
      */
@@ -124,6 +134,21 @@ typedef struct {
     uint32_t last_index_max_value;     /**< Output aggregate value - index of the last max value */
     uint32_t sum_value;                /**< Output aggregate value - sum of all values */
 
+    /**
+     * Output aggregate value - sum of all values without the 32-bit wrap-around.
+     * The accelerator reports a 32-bit sum only, so on the hardware path this field equals @ref sum_value
+     */
+    uint64_t sum_value_64;
+
+    // 64-bit Analytics Values, used instead of the 32-bit ones with QPL_FLAG_ANALYTICS_64
+    uint64_t num_input_elements_64;       /**< Number of input elements */
+    uint64_t available_in_64;             /**< Number of bytes available at next_in_ptr */
+    uint64_t total_in_64;                 /**< Total number of bytes read */
+    uint64_t available_out_64;            /**< Number of bytes available at next_out_ptr */
+    uint64_t total_out_64;                /**< Total number of bytes written */
+    uint64_t first_index_min_value_64;    /**< Output aggregate value - index of the first set bit */
+    uint64_t last_index_max_value_64;     /**< Output aggregate value - index of the last set bit */
+
     // NUMA ID
     int32_t numa_id; /**< ID of the NUMA. Set it to -1 for auto detecting */
 
@@ -177,6 +202,45 @@ QPL_API(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t * job_size_
  */
 QPL_API(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Calculates the amount of memory, in bytes, required for the qpl_job structure
+ *        that performs operations of a single @ref qpl_operation_class only.
+ *
+ * @param[in]   qpl_path      type of implementation path to use - @ref qpl_path_auto,
+ *                            @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]   op_class      @ref qpl_operation_class of the job
+ * @param[out]  job_size_ptr  a pointer to uint32_t, where the qpl_job size (in bytes) is stored
+ *
+ * @note Analytics, inflate and CRC64 jobs don't need the compression states,
+ *       so they take a fraction of the memory returned by @ref qpl_get_job_size.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if `op_class` is incorrect.
+ */
+QPL_API(qpl_status, qpl_get_job_size_for_class, (qpl_path_t qpl_path,
+                                                 qpl_operation_class op_class,
+                                                 uint32_t * job_size_ptr))
+
+/**
+ * @brief Initializes the qpl_job structure allocated with the size returned by @ref qpl_get_job_size_for_class.
+ *
+ * @param[in]      qpl_path     type of implementation path to use - @ref qpl_path_auto,
+ *                              @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]      op_class     @ref qpl_operation_class of the job
+ * @param[in,out]  qpl_job_ptr  a pointer to the @ref qpl_job structure
+ *
+ * @note Submission of an operation that doesn't belong to `op_class` fails with @ref QPL_STS_BAD_JOB_STRUCT_ERR.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if `op_class` is incorrect;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_init_job_for_class, (qpl_path_t qpl_path, qpl_operation_class op_class, qpl_job * qpl_job_ptr))
+
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
  *
@@ -186,9 +250,36 @@ QPL_API(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job * qpl_job_ptr))
  */
 QPL_API(qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Executes the @ref qpl_op_compress or @ref qpl_op_decompress job on the software path
+ *        splitting the work between several threads
+ *
+ * @param[in,out]  qpl_job_ptr    Pointer to the initialized @ref qpl_job structure
+ * @param[in]      threads_count  Maximal number of threads to use (including the calling one)
+ *
+ * @details For compression, the source is divided into segments that are compressed simultaneously by an internal
+ *          thread pool. Each segment uses the last 32 KB of the preceding one as a history, the results are stitched
+ *          into a single deflate stream (with GZIP or ZLIB wrapper if requested) and CRC32/Adler32 checksums
+ *          of the segments are combined into the checksums of the whole source.
+ *
+ *          For decompression with @ref QPL_FLAG_GZIP_MODE, the source can consist of several concatenated gzip
+ *          members (e.g. BGZF files). Member boundaries are taken from the BGZF `BC` extra subfield when present
+ *          or found by walking the members otherwise. The members are decompressed simultaneously into
+ *          one contiguous destination and `CRC32`/`ISIZE` trailer of every member is verified.
+ *
+ * @note The function is equivalent to @ref qpl_execute_job for jobs that can't be split: non-software path
+ *       or other operations, jobs without both @ref QPL_FLAG_FIRST and @ref QPL_FLAG_LAST,
+ *       canned, Huffman only, indexing and dictionary modes, sources that fit into a single segment
+ *       and gzip streams of a single member.
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_execute_job_parallel, (qpl_job * qpl_job_ptr, uint32_t threads_count))
+
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
- *        In case of software solution, it is an alias for execute_job.
+ *        In case of software solution, it is an alias for execute_job,
+ *        unless the software executor is enabled with @ref qpl_set_software_async_threads.
  *
  * @param[in,out]  qpl_job_ptr  Pointer to the initialized @ref qpl_job structure
  *
@@ -217,6 +308,26 @@ QPL_API(qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr))
  */
 QPL_API(qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Sets the number of threads executing @ref qpl_path_software jobs submitted by @ref qpl_submit_job
+ *
+ * @param[in]  threads_count  Number of threads, 0 disables the software executor
+ *
+ * @details When the executor is enabled, @ref qpl_submit_job queues the software path jobs and returns at once,
+ *          and the jobs are completed by the executor threads. Status of a job is returned by @ref qpl_check_job
+ *          and @ref qpl_wait_job, so the same application code overlaps the jobs with and without the accelerator.
+ *          @ref qpl_execute_job and jobs of @ref qpl_path_auto that fall back to the software path are completed
+ *          on return as before. Jobs queued before the call are completed before the function returns.
+ *          The executor is disabled by default.
+ *
+ * @note The job must not be changed, submitted again or finalized until its processing is completed.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NO_MEM_ERR if the executor or its threads can't be created, the previous executor is kept.
+ */
+QPL_API(qpl_status, qpl_set_software_async_threads, (uint32_t threads_count))
+
 /**
  * @brief Completes @ref qpl_job lifecycle: disconnects from the internal library context, frees internal resources.
  *
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_JOB_POOL_H_
+#define QPL_JOB_POOL_H_
+
+#include "qpl/c_api/job.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup JOB_API_DEFINITIONS
+ * @{
+ */
+
+/**
+ * @typedef qpl_job_pool_t
+ * @brief Opaque pointer to a set of preallocated jobs sharing a single memory arena
+ */
+typedef struct qpl_job_pool *qpl_job_pool_t;
+
+/** @} */
+
+/**
+ * @addtogroup JOB_API_FUNCTIONS
+ * @{
+ */
+
+/**
+ * @brief Allocates and initializes a pool of jobs
+ *
+ * @param[in]  qpl_path    @ref qpl_path_t of the jobs
+ * @param[in]  op_class    @ref qpl_operation_class of the jobs, every job holds the buffers of this class only
+ * @param[in]  jobs_count  number of jobs in the pool
+ * @param[in]  allocator   @ref allocator_t used for the arena, default allocator is used if fields are not set
+ * @param[out] pool_ptr    output parameter for the created pool
+ *
+ * @details All jobs are placed into one arena and initialized once (the way @ref qpl_init_job does).
+ *          Jobs of the @ref qpl_path_hardware path acquire the accelerator context at this point.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_SIZE_ERR if `jobs_count` is zero;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if `op_class` is incorrect;
+ *     - @ref QPL_STS_OBJECT_ALLOCATION_ERR;
+ *     - statuses of @ref qpl_init_job.
+ */
+qpl_status qpl_job_pool_create(qpl_path_t qpl_path,
+                               qpl_operation_class op_class,
+                               uint32_t jobs_count,
+                               const allocator_t allocator,
+                               qpl_job_pool_t *pool_ptr);
+
+/**
+ * @brief Takes a free job from the pool
+ *
+ * @param[in]  pool     @ref qpl_job_pool_t object
+ * @param[out] job_ptr  output parameter for the job, ready for setting the operation fields
+ *
+ * @note Only the @ref qpl_job fields and small per-operation states are reset, so taking a job
+ *       doesn't clear hundreds of kilobytes as @ref qpl_init_job does. The function is thread-safe.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_JOB_POOL_EXHAUSTED_ERR if all jobs of the pool are taken.
+ */
+qpl_status qpl_job_pool_acquire(qpl_job_pool_t pool, qpl_job **job_ptr);
+
+/**
+ * @brief Returns the completed job to the pool
+ *
+ * @param[in] pool     @ref qpl_job_pool_t object
+ * @param[in] job_ptr  job previously taken with @ref qpl_job_pool_acquire
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if the job doesn't belong to the pool or is already released.
+ */
+qpl_status qpl_job_pool_release(qpl_job_pool_t pool, qpl_job *job_ptr);
+
+/**
+ * @brief Finalizes all jobs of the pool and deallocates the arena
+ *
+ * @param[in] pool  @ref qpl_job_pool_t object
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - statuses of @ref qpl_fini_job.
+ */
+qpl_status qpl_job_pool_destroy(qpl_job_pool_t pool);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_JOB_POOL_H_
@@ -29,19 +29,27 @@ extern "C" {
  * Describes how to perform serialization
  */
 typedef enum {
-    serialization_compact,   /**< More compact representation, useful for saving up memory on the disk */
+    serialization_compact,   /**< More compact representation, useful for saving up memory on the disk;
+                                  only code lengths are stored and the tables are rebuilt during deserialization */
     serialization_raw,       /**< Faster but more straightforward implementation, use to save speed of serialization/deserialization in case high load */
 } qpl_serialization_format_e;
 
 typedef uint64_t serialization_flags_t; /**< Type of serialization flags */
 
+/**
+ * Store tables as 64-byte aligned images, so that a table could use them directly from the serialized buffer
+ * (e.g. memory-mapped file) without copying, see @ref qpl_huffman_table_deserialize_in_place.
+ * Supported for @ref serialization_raw format only.
+ */
+#define QPL_SERIALIZATION_FLAG_IN_PLACE 0x01u
+
 /**
  * @struct serialization_options_t
  * @brief Describes serialization options
  */
 typedef struct {
     qpl_serialization_format_e format;  /**< @ref qpl_serialization_format_e of serialized object */
-    serialization_flags_t flags;        /**< Advanced serialization options, placeholder for later */
+    serialization_flags_t flags;        /**< Advanced serialization options, e.g. @ref QPL_SERIALIZATION_FLAG_IN_PLACE */
 } serialization_options_t;
 
 #define DEFAULT_SERIALIZATION_OPTIONS {serialization_raw, 0} /**< Default serialization options */
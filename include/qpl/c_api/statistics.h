@@ -72,6 +72,32 @@ QPL_API(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
                                                     const qpl_compression_levels level,
                                                     const qpl_path_t path))
 
+/**
+ * @brief Gathers approximate deflate statistics from a part of the source
+ *
+ * @details The source is split into windows of 16 KB, and the statistics are gathered from one
+ * of every `sampling_interval` windows only. The counts are scaled to the whole source before they are
+ * added to the histogram. The size of the compressed data estimated from the scaled counts can be used
+ * to choose the compression mode, e.g. to store the data if it is not compressible.
+ *
+ * @param[in]   source_ptr          Pointer to source vector that should be processed
+ * @param[in]   source_length       Source vector length
+ * @param[out]  histogram_ptr       Pointer to histogram to be updated
+ * @param[in]   sampling_interval   Distance between the gathered windows, 0 and 1 gather the whole source
+ * @param[out]  estimated_size_ptr  Estimated size of the compressed source without headers, can be NULL
+ * @param[in]   level               Level of compression algorithm
+ * @param[in]   path                Execution path
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_gather_deflate_statistics_sampled, (uint8_t * source_ptr,
+                                                            const uint32_t source_length,
+                                                            qpl_histogram *histogram_ptr,
+                                                            const uint32_t sampling_interval,
+                                                            uint32_t *estimated_size_ptr,
+                                                            const qpl_compression_levels level,
+                                                            const qpl_path_t path))
+
 /** @} */
 
 #ifdef __cplusplus
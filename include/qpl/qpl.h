@@ -23,5 +23,7 @@
 #include "c_api/defs.h"
 #include "c_api/job.h"
 #include "c_api/index_table.h"
+#include "c_api/batch.h"
+#include "c_api/job_pool.h"
 
 #endif /* //QPL_H__ */
@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+// C_API headers
+#include "qpl/qpl.h"
+#include "job.hpp"
+#include "job_execution.hpp"
+
+// Middle layer headers
+#include "util/thread_pool.hpp"
+
+// Legacy
+#include "own_defs.h"
+#include "legacy_hw_path/async_hw_api.h"
+#include "legacy_hw_path/hardware_state.h"
+
+#include <memory>
+#include <new>
+
+namespace {
+
+constexpr uint32_t bitmap_word_bits = 64u;
+
+inline void mark_completed(qpl_batch *batch_ptr, uint32_t index, qpl_status status) noexcept {
+    batch_ptr->statuses_ptr[index] = status;
+    batch_ptr->completion_bitmap_ptr[index / bitmap_word_bits] |= 1ULL << (index % bitmap_word_bits);
+    batch_ptr->completed_count++;
+}
+
+inline auto is_completed(const qpl_batch *batch_ptr, uint32_t index) noexcept -> bool {
+    return batch_ptr->completion_bitmap_ptr[index / bitmap_word_bits] & (1ULL << (index % bitmap_word_bits));
+}
+
+/**
+ * @brief Enqueues the job to the accelerator the same way as @ref qpl_submit_job does
+ *
+ * @return false if the job should be executed on the software path
+ */
+auto try_to_enqueue(qpl_job *job_ptr, qpl_status &status) noexcept -> bool {
+    using namespace qpl;
+
+    status = hw_submit_job(job_ptr);
+
+    if (QPL_STS_OK == status) {
+        reinterpret_cast<qpl_hw_state *>(job::get_state(job_ptr))->job_is_submitted = true;
+
+        return true;
+    }
+
+    // Call SW-path fallback in case if HW limits are exceeded
+    return qpl_path_auto != job_ptr->data_ptr.path;
+}
+
+} // namespace
+
+QPL_FUN("C" qpl_status, qpl_submit_batch, (qpl_batch * batch_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR2_RET(batch_ptr, batch_ptr->jobs_ptr);
+    QPL_BAD_PTR2_RET(batch_ptr->statuses_ptr, batch_ptr->completion_bitmap_ptr);
+    OWN_RETURN_ERROR(0u == batch_ptr->jobs_count, QPL_STS_SIZE_ERR);
+
+    const uint32_t jobs_count = batch_ptr->jobs_count;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        QPL_BAD_PTR_RET(batch_ptr->jobs_ptr[i]);
+    }
+
+    for (uint32_t i = 0u; i < (jobs_count + bitmap_word_bits - 1u) / bitmap_word_bits; i++) {
+        batch_ptr->completion_bitmap_ptr[i] = 0u;
+    }
+
+    batch_ptr->completed_count = 0u;
+
+    std::unique_ptr<uint32_t[]> software_jobs(new (std::nothrow) uint32_t[jobs_count]);
+
+    if (!software_jobs) {
+        return QPL_STS_NO_MEM_ERR;
+    }
+
+    uint32_t software_jobs_count = 0u;
+
+    // Enqueue all hardware jobs back-to-back first, so the accelerator works while software jobs are processed
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        qpl_job *job_ptr = batch_ptr->jobs_ptr[i];
+
+        if (!job::is_operation_in_class(job_ptr)) {
+            mark_completed(batch_ptr, i, QPL_STS_BAD_JOB_STRUCT_ERR);
+            continue;
+        }
+
+        if (!job::is_supported_on_hardware(job_ptr)) {
+            software_jobs[software_jobs_count++] = i;
+            continue;
+        }
+
+        qpl_status status = QPL_STS_OK;
+
+        if (try_to_enqueue(job_ptr, status)) {
+            if (QPL_STS_OK == status) {
+                batch_ptr->statuses_ptr[i] = QPL_STS_BEING_PROCESSED;
+            } else {
+                mark_completed(batch_ptr, i, status);
+            }
+        } else {
+            software_jobs[software_jobs_count++] = i;
+        }
+    }
+
+    // Software jobs are completed by the thread pool before returning
+    ml::util::thread_pool::get_instance().parallel_for(software_jobs_count,
+                                                       batch_ptr->threads_count,
+                                                       [batch_ptr, &software_jobs](uint32_t index) {
+        qpl_job *job_ptr = batch_ptr->jobs_ptr[software_jobs[index]];
+
+        const qpl_path_t path = job_ptr->data_ptr.path;
+
+        // Jobs of the auto path get here only if they couldn't be enqueued
+        if (qpl_path_auto == path) {
+            job_ptr->data_ptr.path = qpl_path_software;
+        }
+
+        batch_ptr->statuses_ptr[software_jobs[index]] = qpl::submit_job(job_ptr, false);
+
+        job_ptr->data_ptr.path = path;
+    });
+
+    for (uint32_t i = 0u; i < software_jobs_count; i++) {
+        mark_completed(batch_ptr, software_jobs[i], batch_ptr->statuses_ptr[software_jobs[i]]);
+    }
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN("C" qpl_status, qpl_check_batch, (qpl_batch * batch_ptr)) {
+    QPL_BAD_PTR2_RET(batch_ptr, batch_ptr->jobs_ptr);
+    QPL_BAD_PTR2_RET(batch_ptr->statuses_ptr, batch_ptr->completion_bitmap_ptr);
+
+    for (uint32_t i = 0u; i < batch_ptr->jobs_count && batch_ptr->completed_count < batch_ptr->jobs_count; i++) {
+        if (is_completed(batch_ptr, i)) {
+            continue;
+        }
+
+        qpl_status status = qpl_check_job(batch_ptr->jobs_ptr[i]);
+
+        if (QPL_STS_BEING_PROCESSED != status) {
+            mark_completed(batch_ptr, i, status);
+        }
+    }
+
+    return (batch_ptr->completed_count == batch_ptr->jobs_count) ? QPL_STS_OK : QPL_STS_BEING_PROCESSED;
+}
+
+QPL_FUN("C" qpl_status, qpl_wait_batch, (qpl_batch * batch_ptr)) {
+    qpl_status status = QPL_STS_OK;
+
+    do {
+        status = qpl_check_batch(batch_ptr);
+    } while (QPL_STS_BEING_PROCESSED == status);
+
+    return status;
+}
@@ -24,6 +24,8 @@ extern "C" {
 typedef struct {
     uint32_t middle_layer_compression_style;
     uint32_t adler32;
+    uint32_t streams_count;        /**< Number of streams compressed by the job */
+    uint32_t is_stream_verified;   /**< Verification decision taken by the first job of the current stream */
 } own_compression_state_t;
 
 #ifdef __cplusplus
@@ -13,6 +13,7 @@
 #include "common/linear_allocator.hpp"
 
 #include "compression/deflate/deflate.hpp"
+#include "compression/deflate/parallel_deflate.hpp"
 #include "compression/deflate/streams/deflate_state_builder.hpp"
 
 #include "compression/huffman_only/huffman_only.hpp"
@@ -69,6 +70,10 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
 
     const qpl::ml::util::linear_allocator allocator(state_buffer);
 
+    const bool is_verification_enabled = (qpl::ml::execution_path_t::software == path) ?
+                                         job::is_stream_verification_enabled(job_ptr) :
+                                         !(job_ptr->flags & QPL_FLAG_OMIT_VERIFY);
+
     operation_result_t result{};
 
     if (job::is_huffman_only_compression(job_ptr)) { // Huffman only mode
@@ -78,7 +83,7 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
                .be_output(job_ptr->flags & QPL_FLAG_HUFFMAN_BE)
                .collect_statistics_step(job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN)
                .crc_seed(job_ptr->crc)
-               .verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+               .verify(is_verification_enabled)
                .total_out(job_ptr->total_out);
 
         if (job_ptr->huffman_table != nullptr) {
@@ -131,7 +136,7 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
                .compression_level(static_cast<compression_level_t>(job_ptr->level))
                .crc_seed({job_ptr->crc, 1})
                .terminate(job_ptr->flags & QPL_FLAG_LAST)
-               .verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+               .verify(is_verification_enabled)
                .load_current_position(job_ptr->total_out); // Shall be deprecated
 
         if (job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN) {
@@ -166,7 +171,11 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
             }
         }
 
-        auto state = builder.verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+        if constexpr (qpl::ml::execution_path_t::software == path) {
+            builder.incompressible_threshold(job_ptr->incompressible_threshold);
+        }
+
+        auto state = builder.verify(is_verification_enabled)
                             .build();
 
         if (job_ptr->flags & QPL_FLAG_CANNED_MODE) { // LZ Only
@@ -197,6 +206,73 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
 
     job::update(job_ptr, result);
 
+    if (job_ptr->flags & QPL_FLAG_LAST && result.status_code_ == qpl::ml::status_list::ok) {
+        job::update_streams_count(job_ptr);
+    }
+
+    return result.status_code_;
+}
+
+uint32_t perform_parallel_compression(qpl_job *const job_ptr, uint32_t threads_count) noexcept {
+    using namespace qpl::ml::compression;
+
+    constexpr auto single_job_flags = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+    // Only single jobs producing an ordinary deflate stream can be split into segments
+    if ((job_ptr->flags & single_job_flags) != single_job_flags ||
+        job_ptr->flags & (QPL_FLAG_CANNED_MODE | QPL_FLAG_START_NEW_BLOCK) ||
+        job::is_huffman_only_compression(job_ptr) ||
+        job::is_indexing_enabled(job_ptr) ||
+        job_ptr->dictionary != nullptr ||
+        job_ptr->available_in <= parallel_deflate_segment_size) {
+        return qpl::ml::status_list::not_supported_err;
+    }
+
+    OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_operation::qpl_op_compress>(job_ptr));
+
+    job::reset<qpl_op_compress>(job_ptr);
+
+    qpl::ml::allocation_buffer_t state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr,
+                                              job_ptr->data_ptr.hw_state_ptr);
+
+    const qpl::ml::util::linear_allocator allocator(state_buffer);
+
+    parallel_deflate_settings_t settings{};
+
+    settings.level                   = static_cast<compression_level_t>(job_ptr->level);
+    settings.threads_count           = threads_count;
+    settings.is_verification_enabled = job::is_stream_verification_enabled(job_ptr);
+    settings.incompressible_threshold = job_ptr->incompressible_threshold;
+
+    if (job_ptr->flags & QPL_FLAG_GZIP_MODE) {
+        settings.header = gzip_header_t;
+    } else if (job_ptr->flags & QPL_FLAG_ZLIB_MODE) {
+        settings.header = zlib_header_t;
+    }
+
+    if (job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN) {
+        settings.mode = dynamic_mode;
+    } else if (job_ptr->huffman_table) {
+        OWN_QPL_CHECK_STATUS(check_huffman_table_is_correct<compression_algorithm_e::deflate>(job_ptr->huffman_table))
+        auto table_impl = use_as_huffman_table<compression_algorithm_e::deflate>(job_ptr->huffman_table);
+
+        settings.mode          = static_mode;
+        settings.huffman_table = reinterpret_cast<qpl_compression_huffman_table *>(
+                table_impl->compression_huffman_table<qpl::ml::execution_path_t::software>());
+    }
+
+    auto result = deflate_parallel(job_ptr->next_in_ptr,
+                                   job_ptr->available_in,
+                                   job_ptr->next_out_ptr,
+                                   job_ptr->available_out,
+                                   settings,
+                                   allocator);
+
+    if (result.status_code_ == qpl::ml::status_list::ok) {
+        job::update(job_ptr, result);
+        job::update_streams_count(job_ptr);
+    }
+
     return result.status_code_;
 }
 
@@ -88,8 +88,12 @@ namespace qpl {
  *    The @ref QPL_FLAG_START_NEW_BLOCK flag is used to finish current deflate block
  *    and start new (possibly with different Huffman table)
  *
+ *    On the software path, dynamic deflate probes a sample of every block before match searching
+ *    and writes the block as stored if it looks incompressible, see @ref qpl_job.incompressible_threshold.
+ *
  *    The compressor performs post verification of the compressed stream.
  *    The @ref QPL_FLAG_OMIT_VERIFY flag must be set to disable this step.
+ *    On the software path, @ref qpl_job.verify_interval set to N verifies one of every N streams only.
  *
  * <b> `Huffman Only Mode:` </b><br>
  *    Compressor supports Huffman only mode that implements encoding of literals using Huffman codes
@@ -146,6 +150,22 @@ namespace qpl {
 template <qpl::ml::execution_path_t path>
 uint32_t perform_compression(qpl_job *const job_ptr) noexcept;
 
+/**
+ * @brief Compresses `Input` stream on the software path splitting it between several threads
+ *
+ * @param [in,out] job_ptr        pointer onto user specified @ref qpl_job
+ * @param [in]     threads_count  maximal number of threads to use (including the calling one)
+ *
+ * @details The job must be a single one (@ref QPL_FLAG_FIRST and @ref QPL_FLAG_LAST) producing an ordinary deflate
+ *          stream: canned, Huffman only, indexing and dictionary modes are not supported.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR if the job can't be split
+ *    - any other status if the parallel compression failed
+ */
+uint32_t perform_parallel_compression(qpl_job *const job_ptr, uint32_t threads_count) noexcept;
+
 /**
  * @brief Decompresses data that is compressed using deflate format
  *
@@ -237,6 +257,23 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept;
 template <qpl::ml::execution_path_t path>
 uint32_t perform_decompress(qpl_job *const job_ptr) noexcept;
 
+/**
+ * @brief Decompresses a stream of concatenated gzip members on the software path using several threads
+ *
+ * @param [in,out] job_ptr        pointer onto user specified @ref qpl_job
+ * @param [in]     threads_count  maximal number of threads to use (including the calling one)
+ *
+ * @details The job must be a single one (@ref QPL_FLAG_FIRST and @ref QPL_FLAG_LAST) with @ref QPL_FLAG_GZIP_MODE
+ *          and without a dictionary. Member boundaries are read from BGZF extra fields or found by walking
+ *          the members, the members are decompressed simultaneously and their trailers are verified.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR if the job can't be split (e.g. the stream consists of a single member)
+ *    - any other status if the decompression failed
+ */
+uint32_t perform_parallel_decompression(qpl_job *const job_ptr, uint32_t threads_count) noexcept;
+
 }
 
 /** @} */
@@ -21,6 +21,7 @@
 #include "compression/huffman_table/inflate_huffman_table.hpp"
 #include "compression/inflate/inflate.hpp"
 #include "compression/inflate/inflate_state.hpp"
+#include "compression/inflate/parallel_inflate.hpp"
 #include "compression/huffman_only/huffman_only.hpp"
 #include "compression/stream_decorators/gzip_decorator.hpp"
 #include "compression/stream_decorators/zlib_decorator.hpp"
@@ -226,6 +227,35 @@ uint32_t perform_decompress(qpl_job *const job_ptr) noexcept {
     return result.status_code_;
 }
 
+uint32_t perform_parallel_decompression(qpl_job *const job_ptr, uint32_t threads_count) noexcept {
+    using namespace qpl::ml::compression;
+
+    constexpr auto single_job_flags = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+    // Only single gzip jobs can be split into members
+    if ((job_ptr->flags & single_job_flags) != single_job_flags ||
+        !(job_ptr->flags & QPL_FLAG_GZIP_MODE) ||
+        job_ptr->flags & (QPL_FLAG_NO_HDRS | QPL_FLAG_RND_ACCESS | QPL_FLAG_CANNED_MODE) ||
+        job_ptr->dictionary != nullptr) {
+        return qpl::ml::status_list::not_supported_err;
+    }
+
+    OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_decompress>(job_ptr));
+
+    auto result = inflate_gzip_members_parallel(job_ptr->next_in_ptr,
+                                                job_ptr->available_in,
+                                                job_ptr->next_out_ptr,
+                                                job_ptr->available_out,
+                                                threads_count);
+
+    if (result.status_code_ == qpl::ml::status_list::ok) {
+        job::reset<qpl_op_decompress>(job_ptr);
+        job::update(job_ptr, result);
+    }
+
+    return result.status_code_;
+}
+
 template
 uint32_t perform_decompress<qpl::ml::execution_path_t::hardware>(qpl_job *const job_ptr) noexcept;
 
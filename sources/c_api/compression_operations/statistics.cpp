@@ -19,7 +19,7 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
 
     OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr));
 
-    if (level != qpl_high_level && level != qpl_default_level) {
+    if (level != qpl_high_level && level != qpl_level_2 && level != qpl_default_level) {
         return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
     }
 
@@ -48,4 +48,55 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
     }
 }
 
+QPL_FUN(qpl_status, qpl_gather_deflate_statistics_sampled, (uint8_t * source_ptr,
+        const uint32_t               source_length,
+        qpl_histogram                *histogram_ptr,
+        const uint32_t               sampling_interval,
+        uint32_t                     *estimated_size_ptr,
+        const qpl_compression_levels level,
+        const qpl_path_t             path)) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr));
+
+    if (level != qpl_high_level && level != qpl_level_2 && level != qpl_default_level) {
+        return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
+
+    qpl_ml_status status         = status_list::ok;
+    uint32_t      estimated_size = 0u;
+
+    const uint8_t *const begin = source_ptr;
+    const uint8_t *const end = source_ptr + source_length;
+
+    switch (path) {
+        case qpl_path_auto:
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+
+        case qpl_path_hardware:
+            status = compression::update_histogram_sampled<execution_path_t::hardware>(begin,
+                                                                                       end,
+                                                                                       *histogram_ptr,
+                                                                                       sampling_interval,
+                                                                                       estimated_size);
+            break;
+        case qpl_path_software:
+            status = compression::update_histogram_sampled<execution_path_t::software>(begin,
+                                                                                       end,
+                                                                                       *histogram_ptr,
+                                                                                       sampling_interval,
+                                                                                       estimated_size,
+                                                                                       level);
+            break;
+        default:
+            return QPL_STS_PATH_ERR;
+    }
+
+    if (estimated_size_ptr != nullptr) {
+        *estimated_size_ptr = estimated_size;
+    }
+
+    return static_cast<qpl_status>(status);
+}
+
 }
@@ -106,8 +106,10 @@ static inline qpl_status check_bad_arguments(const qpl_job *const job_ptr) {
         QPL_BADARG_RET((expected_source_byte_length > (uint64_t)job_ptr->available_in), QPL_STS_SRC_IS_SHORT_ERR)
     }
 
-    uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
-    QPL_BADARG_RET((expected_mask_byte_length > job_ptr->available_src2), QPL_STS_SRC_IS_SHORT_ERR)
+    if (!is_source2_packed(job_ptr)) {
+        uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
+        QPL_BADARG_RET((expected_mask_byte_length > job_ptr->available_src2), QPL_STS_SRC_IS_SHORT_ERR)
+    }
 
     if ((qpl_ow_nom != job_ptr->out_bit_width) &&
         (1u == job_ptr->src1_bit_width)) {
@@ -134,8 +136,10 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
     QPL_BADARG_RET(job_ptr->initial_output_index, QPL_STS_INVALID_PARAM_ERR);
 
     // num_input_elements reflect elements in source-2 for expand operation
-    uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
-    QPL_BADARG_RET((expected_mask_byte_length > job_ptr->available_src2), QPL_STS_SRC_IS_SHORT_ERR);
+    if (!is_source2_packed(job_ptr)) {
+        uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
+        QPL_BADARG_RET((expected_mask_byte_length > job_ptr->available_src2), QPL_STS_SRC_IS_SHORT_ERR);
+    }
 
     return status_list::ok;
 }
@@ -202,6 +206,75 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 }
 }
 
+namespace scan_program {
+static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    const qpl_scan_program *const program_ptr = job_ptr->scan_program;
+
+    if (nullptr == program_ptr) {
+        return QPL_STS_NULL_PTR_ERR;
+    }
+
+    if (0u == program_ptr->instructions_count || QPL_SCAN_PROGRAM_MAX_SIZE < program_ptr->instructions_count) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    // The program is evaluated on a stack of results, it shall never underflow and leave exactly one result
+    uint32_t predicates_count = 0u;
+    uint32_t stack_depth      = 0u;
+
+    for (uint32_t i = 0u; i < program_ptr->instructions_count; i++) {
+        const qpl_scan_instruction &instruction = program_ptr->instructions[i];
+
+        switch (instruction.type) {
+            case qpl_scan_predicate: {
+                if (instruction.comparison < qpl_op_scan_eq || instruction.comparison > qpl_op_scan_not_range) {
+                    return QPL_STS_INVALID_PARAM_ERR;
+                }
+
+                predicates_count++;
+                stack_depth++;
+                break;
+            }
+            case qpl_scan_and:
+            case qpl_scan_or: {
+                if (stack_depth < 2u) {
+                    return QPL_STS_INVALID_PARAM_ERR;
+                }
+
+                stack_depth--;
+                break;
+            }
+            case qpl_scan_not: {
+                if (stack_depth < 1u) {
+                    return QPL_STS_INVALID_PARAM_ERR;
+                }
+
+                break;
+            }
+            default: {
+                return QPL_STS_INVALID_PARAM_ERR;
+            }
+        }
+    }
+
+    if (QPL_SCAN_PROGRAM_MAX_PREDICATES < predicates_count || 1u != stack_depth) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+}
+
+}
+
+template<>
+inline auto validate_operation<qpl_op_scan_program>(const qpl_job *const job_ptr) noexcept {
+    OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_scan_program>(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::scanning::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::scan_program::check_bad_arguments(job_ptr));
+
+    return QPL_STS_OK;
 }
 
 template<>
@@ -284,7 +357,8 @@ static inline auto update_job(qpl_job *job_ptr, const analytic_operation_result_
 
     job_ptr->first_index_min_value = operation_result.aggregates_.min_value_;
     job_ptr->last_index_max_value  = operation_result.aggregates_.max_value_;
-    job_ptr->sum_value             = operation_result.aggregates_.sum_;
+    job_ptr->sum_value             = static_cast<uint32_t>(operation_result.aggregates_.sum_);
+    job_ptr->sum_value_64          = operation_result.aggregates_.sum_;
     job_ptr->last_bit_offset       = operation_result.last_bit_offset_;
     job_ptr->xor_checksum          = operation_result.checksums_.xor_;
     job_ptr->crc                   = operation_result.checksums_.crc32_;
@@ -26,8 +26,9 @@ uint32_t perform_expand(qpl_job *job_ptr,
 
     const auto input_stream_format  = get_stream_format(job_ptr->parser);
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
-    const auto mask_stream_format   = job_ptr->flags & QPL_FLAG_SRC2_BE ? stream_format_t::be_format
-                                                                        : stream_format_t::le_format;
+    const auto mask_stream_format   = job_ptr->flags & QPL_FLAG_SRC2_PRLE ? stream_format_t::prle_format
+                                    : job_ptr->flags & QPL_FLAG_SRC2_BE   ? stream_format_t::be_format
+                                                                          : stream_format_t::le_format;
     const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? stream_format_t::be_format
                                                                          : stream_format_t::le_format;
     const auto crc_type             = job_ptr->flags & QPL_FLAG_CRC32C ? analytics::input_stream_t::crc_t::iscsi
@@ -44,8 +45,16 @@ uint32_t perform_expand(qpl_job *job_ptr,
     auto *decompress_buffer_begin = analytics_state_ptr->inflate_buf_ptr;
     auto *decompress_buffer_end   = decompress_buffer_begin + analytics_state_ptr->inflate_buf_size;
 
+    auto *mask_decompress_buffer_begin = analytics_state_ptr->src2_inflate_buf_ptr;
+    auto *mask_decompress_buffer_end   = mask_decompress_buffer_begin + analytics_state_ptr->src2_inflate_buf_size;
+
     allocation_buffer_t state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr, job_ptr->data_ptr.hw_state_ptr);
 
+    // Inflate state of the compressed source-2 follows the source-1 one
+    allocation_buffer_t mask_state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr +
+                                          compression::inflate_state<execution_path_t::software>::get_buffer_size(),
+                                          job_ptr->data_ptr.hw_state_ptr);
+
     analytic_operation_result_t result{};
 
     switch (job_ptr->data_ptr.path) {
@@ -156,9 +165,14 @@ uint32_t perform_expand(qpl_job *job_ptr,
                     .build<execution_path_t::software>(state_buffer);
 
             auto mask_stream = analytics::input_stream_t::builder(mask_begin, mask_end)
-                    .element_count((job_ptr->available_src2 * byte_bits_size) / job_ptr->src2_bit_width)
+                    .element_count(job::is_source2_packed(job_ptr)
+                                   ? job_ptr->num_input_elements
+                                   : (job_ptr->available_src2 * byte_bits_size) / job_ptr->src2_bit_width)
+                    .compressed(job_ptr->flags & QPL_FLAG_SRC2_DECOMPRESS_ENABLE)
+                    .decompress_buffer<execution_path_t::software>(mask_decompress_buffer_begin,
+                                                                   mask_decompress_buffer_end)
                     .stream_format(mask_stream_format, job_ptr->src2_bit_width)
-                    .build<execution_path_t::software>();
+                    .build<execution_path_t::software>(mask_state_buffer);
 
             auto output_stream = analytics::output_stream_t<analytics::array_stream>::builder(dst_begin, dst_end)
                     .stream_format(output_stream_format)
@@ -173,6 +187,17 @@ uint32_t perform_expand(qpl_job *job_ptr,
                 return bad_arg_status;
             }
 
+            bad_arg_status = validate_input_stream(mask_stream, 1u, 1u);
+
+            if (bad_arg_status != status_list::ok) {
+                return bad_arg_status;
+            }
+
+            // Bit width of PRLE-encoded source-2 is stored in the stream
+            if (1u != mask_stream.bit_width()) {
+                return status_list::bit_width_error;
+            }
+
             // Configure buffers
             limited_buffer_t source_buffer(unpack_buffer_ptr, unpack_buffer_ptr + unpack_buffer_size, input_stream.bit_width());
             limited_buffer_t mask_buffer(mask_buffer_ptr, mask_buffer_ptr + mask_buffer_size, byte_bits_size);
@@ -40,6 +40,7 @@
  *               - @ref qpl_job.first_index_min_value;
  *               - @ref qpl_job.last_index_max_value;
  *               - @ref qpl_job.sum_value;
+ *               - @ref qpl_job.sum_value_64;
  *           - <b> `Checksum calculation:` </b><br>
  *               Crc32 and Xor checksums are calculated and then written into:
  *               - @ref qpl_job.crc;
@@ -86,6 +87,7 @@ namespace qpl {
  *      | qpl_op_scan_range     |  qpl_job_ptr.param_low >= qpl_job_ptr.next_in_ptr[i] <= qpl_job_ptr.param_high |
  *      | qpl_op_scan_not_range |  qpl_job_ptr.next_in_ptr[i] < qpl_job_ptr.param_low && qpl_job_ptr.param_high
  *                                                                                  > qpl_job_ptr.next_in_ptr[i] |
+ *      | qpl_op_scan_program   |  @ref qpl_job.scan_program is true for qpl_job_ptr.next_in_ptr[i] (software path only) |
  *
  * @note 2: `Output` formats:
  *      - If output format is @ref qpl_ow_nom, output will be bit vector.
@@ -114,6 +116,8 @@ namespace qpl {
  *    - @ref QPL_STS_PARSER_ERR
  *    - @ref QPL_STS_OPERATION_ERR
  *    - @ref QPL_STS_OUTPUT_OVERFLOW_ERR
+ *    - @ref QPL_STS_INVALID_PARAM_ERR
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR
  *
  * Example of main usage:
  * @snippet low-level-api/scan_example.cpp QPL_LOW_LEVEL_SCAN_EXAMPLE
@@ -127,6 +131,20 @@ namespace qpl {
  */
 uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size);
 
+/**
+ * @brief Performs the scan of @ref qpl_job with @ref QPL_FLAG_ANALYTICS_64, the element count and buffer lengths
+ *        are taken from the 64-bit fields and the source is processed by chunks with @ref perform_scan
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job
+ * @param [in] buffer_ptr  unpack buffer
+ * @param [in] buffer_size unpack buffer size
+ *
+ * @return
+ *    - Statuses of @ref perform_scan
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR for compressed or Parquet RLE source and non-nominal output
+ */
+uint32_t perform_scan_64(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size);
+
 /**
  * @brief Extracts a sub-vector from the `Source` starting from index param_low and finishing at index param_high
  *
@@ -4,10 +4,13 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+
 #include "analytics_state_t.h"
 #include "filter_operations.hpp"
 #include "arguments_check.hpp"
 #include "analytics/scan.hpp"
+#include "util/checksum.hpp"
 
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
@@ -16,10 +19,57 @@
 
 namespace qpl {
 
+/**
+ * @brief Converts the validated public scan program to the program of core-sw kernels
+ */
+static inline auto build_scan_program(const qpl_scan_program &program) noexcept -> qplc_scan_program_t {
+    qplc_scan_program_t kernel_program{};
+
+    kernel_program.size = program.instructions_count;
+
+    for (uint32_t i = 0u; i < program.instructions_count; i++) {
+        const qpl_scan_instruction &instruction        = program.instructions[i];
+        qplc_scan_instruction_t    &kernel_instruction = kernel_program.instructions[i];
+
+        switch (instruction.type) {
+            case qpl_scan_and: {
+                kernel_instruction.opcode = qplc_scan_program_and;
+                break;
+            }
+            case qpl_scan_or: {
+                kernel_instruction.opcode = qplc_scan_program_or;
+                break;
+            }
+            case qpl_scan_not: {
+                kernel_instruction.opcode = qplc_scan_program_not;
+                break;
+            }
+            case qpl_scan_predicate: {
+                // Comparisons follow the order of the scan operations
+                kernel_instruction.opcode     = static_cast<uint32_t>(instruction.comparison - qpl_op_scan_eq);
+                kernel_instruction.low_value  = instruction.param_low;
+                kernel_instruction.high_value = instruction.param_high;
+                break;
+            }
+            default: {
+                // Unreachable for a validated program, the kernels reject the opcode
+                kernel_instruction.opcode = UINT32_MAX;
+                break;
+            }
+        }
+    }
+
+    return kernel_program;
+}
+
 uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size) {
     using namespace qpl::ml;
 
-    OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_scan_eq>(job_ptr))
+    if (qpl_op_scan_program == job_ptr->op) {
+        OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_scan_program>(job_ptr))
+    } else {
+        OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_scan_eq>(job_ptr))
+    }
 
     const auto input_stream_format  = analytics::get_stream_format(job_ptr->parser);
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
@@ -153,6 +203,12 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                                                         job_ptr->numa_id);
                     break;
                 }
+                case qpl_op_scan_program: {
+                    // Scan programs are evaluated on the software path only
+                    scan_result.output_bytes_ = 0u;
+                    scan_result.status_code_  = QPL_STS_NOT_SUPPORTED_MODE_ERR;
+                    break;
+                }
                 default: {
                     scan_result.output_bytes_ = 0u;
                     scan_result.status_code_  = QPL_STS_OPERATION_ERR;
@@ -266,6 +322,13 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                                                         temporary_buffer);
                     break;
                 }
+                case qpl_op_scan_program: {
+                    scan_result = analytics::call_scan_program_sw(input_stream,
+                                                                  output_stream,
+                                                                  build_scan_program(*job_ptr->scan_program),
+                                                                  temporary_buffer);
+                    break;
+                }
                 default: {
                     scan_result.output_bytes_ = 0u;
                     scan_result.status_code_  = QPL_STS_OPERATION_ERR;
@@ -284,6 +347,145 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
     return scan_result.status_code_;
 }
 
+/**
+ * @brief Number of elements scanned by one chunk of a 64-bit job, multiple of 16 to keep the source
+ *        and the bit vector of every chunk byte and BE16 word aligned
+ */
+constexpr uint64_t scan_64_chunk_elements = 1ull << 24u;
+
+/**
+ * @brief Number of bytes covered by one call of the checksum kernels, even to keep XOR words aligned
+ */
+constexpr uint64_t scan_64_checksum_chunk_size = 1ull << 30u;
+
+uint32_t perform_scan_64(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size) {
+    using namespace qpl::ml;
+
+    const uint32_t bit_width = job_ptr->src1_bit_width;
+
+    OWN_RETURN_ERROR((job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE)
+                     || qpl_p_parquet_rle == job_ptr->parser
+                     || qpl_ow_nom != job_ptr->out_bit_width, QPL_STS_NOT_SUPPORTED_MODE_ERR)
+    OWN_RETURN_ERROR(0u == bit_width || bit_width > 32u, QPL_STS_BIT_WIDTH_ERR)
+    OWN_RETURN_ERROR(0u == job_ptr->num_input_elements_64
+                     || 0u == job_ptr->available_in_64
+                     || 0u == job_ptr->available_out_64, QPL_STS_SIZE_ERR)
+
+    const uint64_t elements_count = job_ptr->num_input_elements_64;
+    const uint64_t source_size    = job_ptr->drop_initial_bytes
+                                    + (elements_count / 8u) * bit_width
+                                    + util::bit_to_byte(static_cast<uint32_t>(elements_count % 8u) * bit_width);
+
+    OWN_RETURN_ERROR(source_size > job_ptr->available_in_64, QPL_STS_SRC_IS_SHORT_ERR)
+    OWN_RETURN_ERROR((elements_count + 7u) / 8u > job_ptr->available_out_64, QPL_STS_DST_IS_SHORT_ERR)
+
+    // The fields are used to pass chunks to the regular scan and are restored afterwards
+    const uint32_t user_flags              = job_ptr->flags;
+    const uint32_t user_num_input_elements = job_ptr->num_input_elements;
+    const uint32_t user_drop_initial_bytes = job_ptr->drop_initial_bytes;
+    const uint32_t user_available_in       = job_ptr->available_in;
+    const uint32_t user_available_out      = job_ptr->available_out;
+    const uint32_t user_total_in           = job_ptr->total_in;
+    const uint32_t user_total_out          = job_ptr->total_out;
+    const uint32_t user_first_index        = job_ptr->first_index_min_value;
+    const uint32_t user_last_index         = job_ptr->last_index_max_value;
+
+    uint8_t *const source_begin = job_ptr->next_in_ptr;
+    uint8_t *const destination_begin = job_ptr->next_out_ptr;
+
+    uint64_t elements_done = 0u;
+    uint64_t bytes_read    = 0u;
+    uint64_t bytes_written = 0u;
+    uint64_t sum           = 0u;
+    uint64_t first_index   = UINT64_MAX;
+    uint64_t last_index    = 0u;
+    uint32_t status        = QPL_STS_OK;
+
+    while (elements_done < elements_count) {
+        const uint64_t chunk_elements = std::min(elements_count - elements_done, scan_64_chunk_elements);
+        const bool     is_last_chunk  = elements_done + chunk_elements == elements_count;
+        const uint32_t drop_bytes     = 0u == elements_done ? user_drop_initial_bytes : 0u;
+
+        // The last chunk gets the rest of the source to keep the original source size in the checksums
+        const uint64_t chunk_source_size = is_last_chunk
+                                           ? job_ptr->available_in_64 - bytes_read
+                                           : drop_bytes + chunk_elements / 8u * bit_width;
+
+        job_ptr->next_in_ptr           = source_begin + bytes_read;
+        job_ptr->available_in          = static_cast<uint32_t>(std::min<uint64_t>(chunk_source_size, UINT32_MAX));
+        job_ptr->next_out_ptr          = destination_begin + bytes_written;
+        job_ptr->available_out         = static_cast<uint32_t>(std::min<uint64_t>(job_ptr->available_out_64
+                                                                                   - bytes_written, UINT32_MAX));
+        job_ptr->num_input_elements    = static_cast<uint32_t>(chunk_elements);
+        job_ptr->drop_initial_bytes    = drop_bytes;
+        job_ptr->flags                 = user_flags | QPL_FLAG_OMIT_CHECKSUMS;
+        job_ptr->total_in              = 0u;
+        job_ptr->total_out             = 0u;
+        job_ptr->first_index_min_value = UINT32_MAX;
+
+        status = perform_scan(job_ptr, buffer_ptr, buffer_size);
+
+        if (QPL_STS_OK != status) {
+            break;
+        }
+
+        if (0u != job_ptr->sum_value_64) {
+            first_index = std::min(first_index, elements_done + job_ptr->first_index_min_value);
+            last_index  = elements_done + job_ptr->last_index_max_value;
+        }
+
+        sum           += job_ptr->sum_value_64;
+        bytes_read    += job_ptr->total_in;
+        bytes_written += job_ptr->total_out;
+        elements_done += chunk_elements;
+    }
+
+    job_ptr->flags                 = user_flags;
+    job_ptr->num_input_elements    = user_num_input_elements;
+    job_ptr->drop_initial_bytes    = user_drop_initial_bytes;
+    job_ptr->available_in          = user_available_in;
+    job_ptr->available_out         = user_available_out;
+    job_ptr->total_in              = user_total_in;
+    job_ptr->total_out             = user_total_out;
+    job_ptr->first_index_min_value = user_first_index;
+    job_ptr->last_index_max_value  = user_last_index;
+    job_ptr->next_in_ptr           = source_begin + bytes_read;
+    job_ptr->next_out_ptr          = destination_begin + bytes_written;
+
+    job_ptr->available_in_64  -= bytes_read;
+    job_ptr->total_in_64       = bytes_read;
+    job_ptr->available_out_64 -= bytes_written;
+    job_ptr->total_out_64      = bytes_written;
+
+    if (QPL_STS_OK != status) {
+        return status;
+    }
+
+    job_ptr->sum_value_64             = sum;
+    job_ptr->sum_value                = static_cast<uint32_t>(sum);
+    job_ptr->first_index_min_value_64 = first_index;
+    job_ptr->last_index_max_value_64  = last_index;
+
+    if (!(user_flags & QPL_FLAG_OMIT_CHECKSUMS)) {
+        uint32_t crc          = 0u;
+        uint32_t xor_checksum = 0u;
+
+        for (uint64_t offset = 0u; offset < bytes_read; offset += scan_64_checksum_chunk_size) {
+            const uint8_t *const begin = source_begin + offset;
+            const uint8_t *const end   = begin + std::min(bytes_read - offset, scan_64_checksum_chunk_size);
+
+            crc = (user_flags & QPL_FLAG_CRC32C) ? util::crc32_iscsi_inv(begin, end, crc)
+                                                 : util::crc32_gzip(begin, end, crc);
+            xor_checksum = util::xor_checksum(begin, end, xor_checksum);
+        }
+
+        job_ptr->crc          = crc;
+        job_ptr->xor_checksum = xor_checksum;
+    }
+
+    return status;
+}
+
 } // namespace qpl
 
 #if defined(__GNUC__) && !defined(__clang__)
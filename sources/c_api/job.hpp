@@ -15,6 +15,7 @@
 #include "common/defs.hpp"
 #include "qpl/c_api/job.h"
 #include "compression_operations/compression_state_t.h"
+#include "compression/dictionary/dictionary_defs.hpp"
 
 namespace qpl::job {
 
@@ -64,7 +65,7 @@ static inline bool is_dictionary(const qpl_job *const job_ptr) noexcept {
 }
 
 static inline bool is_high_level_compression(const qpl_job *const job_ptr) noexcept{
-    return (qpl_op_compress == job_ptr->op) && (qpl_high_level == job_ptr->level);
+    return (qpl_op_compress == job_ptr->op) && (qpl_level_2 == job_ptr->level || qpl_high_level == job_ptr->level);
 }
 
 static inline bool is_canned_mode_compression(const qpl_job *const job_ptr) noexcept {
@@ -113,6 +114,10 @@ static inline bool is_scan(const qpl_job *const job_ptr) noexcept {
     return qpl_op_scan_eq <= job_ptr->op;
 }
 
+static inline bool is_scan_program(const qpl_job *const job_ptr) noexcept {
+    return qpl_op_scan_program == job_ptr->op;
+}
+
 static inline bool is_select(const qpl_job *const job_ptr) noexcept {
     return qpl_op_select == job_ptr->op;
 }
@@ -121,10 +126,55 @@ static inline bool is_expand(const qpl_job *const job_ptr) noexcept {
     return qpl_op_expand == job_ptr->op;
 }
 
+static inline bool is_zero_decompression(const qpl_job *const job_ptr) noexcept {
+    return qpl_op_z_decompress32 == job_ptr->op || qpl_op_z_decompress16 == job_ptr->op;
+}
+
+static inline bool is_zero_operation(const qpl_job *const job_ptr) noexcept {
+    return is_zero_decompression(job_ptr) || qpl_op_z_compress32 == job_ptr->op || qpl_op_z_compress16 == job_ptr->op;
+}
+
+/**
+ * @brief Checks that internal buffers of the job were laid out for the operation set in it
+ */
+static inline bool is_operation_in_class(const qpl_job *const job_ptr) noexcept {
+    switch (job_ptr->data_ptr.op_class) {
+        case qpl_op_class_all:
+            return true;
+        case qpl_op_class_analytics:
+            return is_extract(job_ptr) || is_scan(job_ptr) || is_select(job_ptr) || is_expand(job_ptr);
+        case qpl_op_class_inflate:
+            return is_decompression(job_ptr);
+        case qpl_op_class_deflate:
+            return is_compression(job_ptr);
+        case qpl_op_class_crc64:
+            return qpl_op_crc64 == job_ptr->op;
+        case qpl_op_class_zero:
+            return is_zero_operation(job_ptr);
+        default:
+            return false;
+    }
+}
+
 static inline bool is_zlib_flag_set(const qpl_job *const job_ptr) noexcept {
     return QPL_FLAG_ZLIB_MODE & job_ptr->flags;
 }
 
+/**
+ * @brief Check if the current compressed stream should be verified on the software path.
+ * The decision is taken by the first job of the stream, so all jobs of the stream follow it
+*/
+static inline bool is_stream_verification_enabled(const qpl_job *const job_ptr) noexcept {
+    auto *data_ptr = (own_compression_state_t *) job_ptr->data_ptr.compress_state_ptr;
+
+    if (job_ptr->flags & QPL_FLAG_FIRST) {
+        data_ptr->is_stream_verified = job_ptr->verify_interval <= 1u ||
+                                       data_ptr->streams_count % job_ptr->verify_interval == 0u;
+    }
+
+    return !(job_ptr->flags & QPL_FLAG_OMIT_VERIFY) && data_ptr->is_stream_verified;
+}
+
 static inline bool is_verification_supported(const qpl_job *const qpl_job_ptr) noexcept {
     bool stream_should_be_verified = false;
 
@@ -138,11 +188,39 @@ static inline bool is_verification_supported(const qpl_job *const qpl_job_ptr) n
 }
 
 /**
- * @brief Check for skipping high level compression on hardware/auto execution paths.
+ * @brief Check for compressed or PRLE-encoded source-2 of select and expand, supported on software path only.
+*/
+static inline bool is_source2_packed(const qpl_job *const job_ptr) noexcept {
+    return (qpl_op_select == job_ptr->op || qpl_op_expand == job_ptr->op)
+           && (job_ptr->flags & (QPL_FLAG_SRC2_DECOMPRESS_ENABLE | QPL_FLAG_SRC2_PRLE));
+}
+
+/**
+ * @brief Check for dictionary larger than the accelerator history (4k), supported on software path only.
+*/
+static inline bool is_large_dictionary(const qpl_job *const job_ptr) noexcept {
+    return job_ptr->dictionary != nullptr
+           && job_ptr->dictionary->raw_dictionary_size > qpl::ml::max_history_size;
+}
+
+/**
+ * @brief Check for scan with 64-bit element count and buffer lengths, supported on software path only.
+*/
+static inline bool is_analytics_64(const qpl_job *const job_ptr) noexcept {
+    return job_ptr->flags & QPL_FLAG_ANALYTICS_64;
+}
+
+/**
+ * @brief Check for skipping high level compression, packed source-2, large dictionaries, scan programs
+ *        and 64-bit analytics on hardware/auto execution paths.
 */
 static inline bool is_supported_on_hardware(const qpl_job *const qpl_ptr) {
     return ((qpl_path_hardware == qpl_ptr->data_ptr.path || qpl_path_auto == qpl_ptr->data_ptr.path)
-            && !is_high_level_compression(qpl_ptr));
+            && !is_high_level_compression(qpl_ptr)
+            && !is_source2_packed(qpl_ptr)
+            && !is_large_dictionary(qpl_ptr)
+            && !is_scan_program(qpl_ptr)
+            && !is_analytics_64(qpl_ptr));
 }
 
 // ------ JOB SETTERS ------ //
@@ -185,10 +263,19 @@ static inline void update_aggregates(qpl_job *const qpl_job_ptr,
                                      const uint32_t min_first_agg,
                                      const uint32_t max_last_agg) noexcept {
     qpl_job_ptr->sum_value             = sum_agg;
+    qpl_job_ptr->sum_value_64          = sum_agg;
     qpl_job_ptr->first_index_min_value = min_first_agg;
     qpl_job_ptr->last_index_max_value  = max_last_agg;
 }
 
+/**
+ * @brief count the completed compressed stream for sampled verification
+*/
+static inline void update_streams_count(qpl_job *const qpl_job_ptr) noexcept {
+    auto *data_ptr = (own_compression_state_t *) qpl_job_ptr->data_ptr.compress_state_ptr;
+    data_ptr->streams_count++;
+}
+
 static inline void update_input_stream(qpl_job *const qpl_job_ptr, const uint32_t size) noexcept {
     qpl_job_ptr->next_in_ptr += size;
     qpl_job_ptr->available_in -= size;
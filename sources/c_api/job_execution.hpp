@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_SOURCES_C_API_JOB_EXECUTION_HPP_
+#define QPL_SOURCES_C_API_JOB_EXECUTION_HPP_
+
+#include "qpl/c_api/job.h"
+
+namespace qpl {
+
+/**
+ * @brief Submits the job the same way as @ref qpl_submit_job
+ *
+ * @param[in,out]  qpl_job_ptr       Pointer to the initialized @ref qpl_job structure
+ * @param[in]      is_async_allowed  If false, software path jobs are completed on return
+ *                                   even if the software executor is enabled
+ */
+auto submit_job(qpl_job *qpl_job_ptr, bool is_async_allowed) noexcept -> qpl_status;
+
+} // namespace qpl
+
+#endif //QPL_SOURCES_C_API_JOB_EXECUTION_HPP_
@@ -12,76 +12,74 @@
 // C_API headers
 #include "qpl/qpl.h"
 #include "job.hpp"
+#include "job_execution.hpp"
 #include "compression_operations/compressor.hpp"
 #include "filter_operations/filter_operations.hpp"
 #include "filter_operations/analytics_state_t.h"
 #include "other_operations/crc64.hpp"
+#include "other_operations/zero.hpp"
 
 // Middle layer headers
 #include "util/checksum.hpp"
+#include "util/thread_pool.hpp"
 
 // Legacy
 #include "own_defs.h"
 #include "legacy_hw_path/async_hw_api.h"
 #include "legacy_hw_path/hardware_state.h"
 
-//#define KEEP_DESCRIPTOR_ENABLED
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
 
-QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
-    using namespace qpl;
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
-    QPL_BAD_PTR_RET(qpl_job_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.decompress_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
-    QPL_BAD_OP_RET(qpl_job_ptr->op);
+//#define KEEP_DESCRIPTOR_ENABLED
 
-    uint32_t status = QPL_STS_OK;
+namespace {
 
-    qpl_path_t path = qpl_job_ptr->data_ptr.path;
+std::mutex                                  software_executor_mutex;
+std::shared_ptr<qpl::ml::util::thread_pool> software_executor_ptr;
 
-    if ((qpl_path_hardware == path)
-        && (qpl_op_compress == qpl_job_ptr->op)
-        && (qpl_high_level == qpl_job_ptr->level)) {
-            return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
-    }
+auto get_software_executor() noexcept -> std::shared_ptr<qpl::ml::util::thread_pool> {
+    std::lock_guard<std::mutex> lock(software_executor_mutex);
 
-    if (qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path) {
-        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+    return software_executor_ptr;
+}
 
-#if defined(KEEP_DESCRIPTOR_ENABLED)
-        if (state_ptr->descriptor_not_submitted) {
-            status = hw_enqueue_descriptor(&state_ptr->desc_ptr, qpl_job_ptr->numa_id);
+/**
+ * @brief Stores the status of the job executed by the software executor, results of the job become visible
+ *        to the thread that loads the status, like a completion record of the accelerator
+ */
+inline void set_async_status(qpl_job *const qpl_job_ptr, uint32_t status) noexcept {
+#if defined(_MSC_VER)
+    _InterlockedExchange(reinterpret_cast<volatile long *>(&qpl_job_ptr->data_ptr.async_status),
+                         static_cast<long>(status));
+#else
+    __atomic_store_n(&qpl_job_ptr->data_ptr.async_status, status, __ATOMIC_RELEASE);
+#endif
+}
 
-            if (status == QPL_STS_OK) {
-                state_ptr->descriptor_not_submitted = false;
-            }
+inline auto get_async_status(const qpl_job *const qpl_job_ptr) noexcept -> qpl_status {
+#if defined(_MSC_VER)
+    auto *const status_ptr = const_cast<volatile long *>(
+            reinterpret_cast<const volatile long *>(&qpl_job_ptr->data_ptr.async_status));
 
-            return static_cast<qpl_status>(status);
-        }
+    return static_cast<qpl_status>(_InterlockedCompareExchange(status_ptr, 0, 0));
+#else
+    return static_cast<qpl_status>(__atomic_load_n(&qpl_job_ptr->data_ptr.async_status, __ATOMIC_ACQUIRE));
 #endif
+}
 
-        status = hw_submit_job(qpl_job_ptr);
-
-        if (status == QPL_STS_OK) {
-            state_ptr->job_is_submitted = true;
-        }
+auto execute_software_job(qpl_job *const qpl_job_ptr) noexcept -> uint32_t {
+    using namespace qpl;
 
-#if defined(KEEP_DESCRIPTOR_ENABLED)
-        if (status == QPL_STS_QUEUES_ARE_BUSY_ERR && qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
-            state_ptr->descriptor_not_submitted = true;
-        }
-#endif
+    uint32_t status = QPL_STS_OK;
 
-        // Call SW-path fallback in case if HW limits are exceeded
-        if (status != QPL_STS_OK && qpl_job_ptr->data_ptr.path == qpl_path_auto) {
-            qpl_job_ptr->data_ptr.path = qpl_path_software;
-        } else {
-            return static_cast<qpl_status>(status);
-        }
-    }
+    OWN_RETURN_ERROR(job::is_analytics_64(qpl_job_ptr) && !job::is_scan(qpl_job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR);
 
     qpl_job_ptr->first_index_min_value = UINT32_MAX;
 
@@ -108,6 +106,13 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
             status = perform_crc64(qpl_job_ptr);
             break;
         }
+        case qpl_op_z_compress16:
+        case qpl_op_z_compress32:
+        case qpl_op_z_decompress16:
+        case qpl_op_z_decompress32: {
+            status = perform_zero(qpl_job_ptr);
+            break;
+        }
         case qpl_op_scan_eq:
         case qpl_op_scan_ne:
         case qpl_op_scan_lt:
@@ -115,7 +120,15 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         case qpl_op_scan_gt:
         case qpl_op_scan_ge:
         case qpl_op_scan_range:
-        case qpl_op_scan_not_range: {
+        case qpl_op_scan_not_range:
+        case qpl_op_scan_program: {
+            if (job::is_analytics_64(qpl_job_ptr)) {
+                status = perform_scan_64(qpl_job_ptr,
+                                         analytics_state_ptr->unpack_buf_ptr,
+                                         analytics_state_ptr->unpack_buf_size);
+                break;
+            }
+
             status = perform_scan(qpl_job_ptr,
                                   analytics_state_ptr->unpack_buf_ptr,
                                   analytics_state_ptr->unpack_buf_size);
@@ -158,17 +171,112 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         }
     }
 
+    return status;
+}
+
+} // namespace
+
+auto qpl::submit_job(qpl_job *const qpl_job_ptr, bool is_async_allowed) noexcept -> qpl_status {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.decompress_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
+    QPL_BAD_OP_RET(qpl_job_ptr->op);
+    OWN_RETURN_ERROR(!job::is_operation_in_class(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+
+    uint32_t status = QPL_STS_OK;
+
+    qpl_path_t path = qpl_job_ptr->data_ptr.path;
+
+    if ((qpl_path_hardware == path) && job::is_high_level_compression(qpl_job_ptr)) {
+            return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
+
+    const bool is_software_only = job::is_source2_packed(qpl_job_ptr)
+                                  || job::is_large_dictionary(qpl_job_ptr)
+                                  || job::is_scan_program(qpl_job_ptr)
+                                  || job::is_analytics_64(qpl_job_ptr);
+
+    if (qpl_path_hardware == path && is_software_only) {
+        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+    }
+
+    if (qpl_path_auto == path && is_software_only) {
+        qpl_job_ptr->data_ptr.path = qpl_path_software;
+    }
+
+    if (qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path) {
+        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+
+#if defined(KEEP_DESCRIPTOR_ENABLED)
+        if (state_ptr->descriptor_not_submitted) {
+            status = hw_enqueue_descriptor(&state_ptr->desc_ptr, qpl_job_ptr->numa_id);
+
+            if (status == QPL_STS_OK) {
+                state_ptr->descriptor_not_submitted = false;
+            }
+
+            return static_cast<qpl_status>(status);
+        }
+#endif
+
+        status = hw_submit_job(qpl_job_ptr);
+
+        if (status == QPL_STS_OK) {
+            state_ptr->job_is_submitted = true;
+        }
+
+#if defined(KEEP_DESCRIPTOR_ENABLED)
+        if (status == QPL_STS_QUEUES_ARE_BUSY_ERR && qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
+            state_ptr->descriptor_not_submitted = true;
+        }
+#endif
+
+        // Call SW-path fallback in case if HW limits are exceeded
+        if (status != QPL_STS_OK && qpl_job_ptr->data_ptr.path == qpl_path_auto) {
+            qpl_job_ptr->data_ptr.path = qpl_path_software;
+        } else {
+            return static_cast<qpl_status>(status);
+        }
+    }
+
+    if (qpl_path_software == path && is_async_allowed) {
+        auto executor_ptr = get_software_executor();
+
+        if (executor_ptr) {
+            set_async_status(qpl_job_ptr, QPL_STS_BEING_PROCESSED);
+
+            if (executor_ptr->submit([qpl_job_ptr]() { set_async_status(qpl_job_ptr, execute_software_job(qpl_job_ptr)); })) {
+                return QPL_STS_OK;
+            }
+        }
+    }
+
+    set_async_status(qpl_job_ptr, QPL_STS_OK);
+
+    status = execute_software_job(qpl_job_ptr);
+
     qpl_job_ptr->data_ptr.path = path;
 
     return static_cast<qpl_status>(status);
 }
 
+QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
+    return qpl::submit_job(qpl_job_ptr, true);
+}
+
 QPL_FUN("C" qpl_status, qpl_check_job, (qpl_job *qpl_job_ptr)) {
     QPL_BAD_PTR_RET(qpl_job_ptr);
     uint32_t status = QPL_STS_OK;
 
     if (qpl::job::is_supported_on_hardware(qpl_job_ptr)) {
         status = hw_check_job(qpl_job_ptr);
+    } else if (qpl_path_software == qpl_job_ptr->data_ptr.path) {
+        status = get_async_status(qpl_job_ptr);
     }
 
     return static_cast<qpl_status>(status);
@@ -183,6 +291,11 @@ QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job *qpl_job_ptr)) {
         do {
             status = hw_check_job(qpl_job_ptr);
         } while (QPL_STS_BEING_PROCESSED == status);
+    } else if (qpl_path_software == qpl_job_ptr->data_ptr.path) {
+        // The job is executed by a thread of the software executor, so the core is given away while waiting
+        while (QPL_STS_BEING_PROCESSED == (status = get_async_status(qpl_job_ptr))) {
+            std::this_thread::yield();
+        }
     }
 
     return static_cast<qpl_status>(status);
@@ -192,6 +305,7 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(qpl_job_ptr);
+    OWN_RETURN_ERROR(!job::is_operation_in_class(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
 
     if (job::is_supported_on_hardware(qpl_job_ptr)) {
         auto *const analytics_state_ptr = reinterpret_cast<own_analytics_state_t *>(qpl_job_ptr->data_ptr.analytics_state_ptr);
@@ -232,6 +346,10 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
             return static_cast<qpl_status>(perform_decompress<ml::execution_path_t::hardware>(qpl_job_ptr));
         }
 
+        if (job::is_zero_operation(qpl_job_ptr)) {
+            return static_cast<qpl_status>(perform_zero(qpl_job_ptr));
+        }
+
         if (job::is_compression(qpl_job_ptr) &&
             !(job::is_indexing_enabled(qpl_job_ptr) && job::is_multi_job(qpl_job_ptr))) {
             return static_cast<qpl_status>(perform_compression<ml::execution_path_t::hardware>(qpl_job_ptr));
@@ -247,5 +365,80 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
         return (QPL_STS_OK == status) ? qpl_wait_job(qpl_job_ptr) : status;
     }
 
-    return qpl_submit_job(qpl_job_ptr);
+    return submit_job(qpl_job_ptr, false);
+}
+
+QPL_FUN("C" qpl_status, qpl_set_software_async_threads, (uint32_t threads_count)) {
+    using namespace qpl;
+
+    std::shared_ptr<ml::util::thread_pool> executor_ptr;
+
+    if (threads_count > 0u) {
+        auto *const new_executor_ptr = new (std::nothrow) ml::util::thread_pool(threads_count);
+
+        if (new_executor_ptr == nullptr) {
+            return QPL_STS_NO_MEM_ERR;
+        }
+
+        // The pool skips the threads that the system can't start
+        if (new_executor_ptr->size() < threads_count) {
+            delete new_executor_ptr;
+
+            return QPL_STS_NO_MEM_ERR;
+        }
+
+        executor_ptr.reset(new_executor_ptr);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(software_executor_mutex);
+        software_executor_ptr.swap(executor_ptr);
+    }
+
+    // Jobs queued to the previous executor are completed before its threads are stopped
+    executor_ptr.reset();
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN("C" qpl_status, qpl_execute_job_parallel, (qpl_job * qpl_job_ptr, uint32_t threads_count)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    if (threads_count > 1u &&
+        qpl_path_software == qpl_job_ptr->data_ptr.path &&
+        job::is_compression(qpl_job_ptr)) {
+        QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
+        QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
+        QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
+        OWN_RETURN_ERROR(!job::is_operation_in_class(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+
+        // Jobs that can't be split are processed as usual
+        const auto status = static_cast<qpl_status>(perform_parallel_compression(qpl_job_ptr, threads_count));
+
+        if (QPL_STS_OK == status) {
+            qpl_job_ptr->first_index_min_value = UINT32_MAX;
+        }
+
+        if (QPL_STS_NOT_SUPPORTED_MODE_ERR != status) {
+            return status;
+        }
+    }
+
+    if (threads_count > 1u &&
+        qpl_path_software == qpl_job_ptr->data_ptr.path &&
+        qpl_op_decompress == qpl_job_ptr->op) {
+        QPL_BAD_PTR2_RET(qpl_job_ptr->next_in_ptr, qpl_job_ptr->next_out_ptr);
+        OWN_RETURN_ERROR(!job::is_operation_in_class(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+
+        // Streams of a single member are decompressed as usual
+        const auto status = static_cast<qpl_status>(perform_parallel_decompression(qpl_job_ptr, threads_count));
+
+        if (QPL_STS_NOT_SUPPORTED_MODE_ERR != status) {
+            return status;
+        }
+    }
+
+    return qpl_execute_job(qpl_job_ptr);
 }
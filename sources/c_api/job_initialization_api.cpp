@@ -23,6 +23,7 @@
 #include "legacy_hw_path/async_hw_api.h"
 #include "legacy_hw_path/hardware_state.h"
 #include "compression_operations/own_deflate_job.h" // @todo check if could be removed
+#include "own_job_layout.h"
 
 // get_buffer_size functions for middle-layer buffer allocation
 #include "compression/deflate/streams/sw_deflate_state.hpp"
@@ -38,48 +39,91 @@ extern "C" {
 
 QPL_INLINE uint32_t own_get_job_size_compress  (qpl_path_t qpl_path);
 QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t qpl_path);
-QPL_INLINE uint32_t own_get_job_size_analytics (qpl_path_t qpl_path);
-uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path);
+QPL_INLINE uint32_t own_get_job_size_analytics (qpl_path_t qpl_path, qpl_operation_class op_class);
+uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path, qpl_operation_class op_class);
 
 QPL_INLINE void own_init_compress  (qpl_job *qpl_job_ptr);
 QPL_INLINE void own_init_decompress(qpl_job *qpl_job_ptr);
 QPL_INLINE void own_init_analytics (qpl_job *qpl_job_ptr);
 
 QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t *job_size_ptr)) {
-    using namespace qpl;
+    QPL_BAD_PTR_RET(job_size_ptr);
+    QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+
+    *job_size_ptr = own_get_job_size(qpl_path, qpl_op_class_all);
+
+    return QPL_STS_OK;
+}
 
+QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
+    QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    return own_init_job(qpl_path, qpl_op_class_all, qpl_job_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_get_job_size_for_class, (qpl_path_t qpl_path,
+                                                 qpl_operation_class op_class,
+                                                 uint32_t *job_size_ptr)) {
     QPL_BAD_PTR_RET(job_size_ptr);
     QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET (qpl_op_class_zero < op_class, QPL_STS_INVALID_PARAM_ERR);
+
+    *job_size_ptr = own_get_job_size(qpl_path, op_class);
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN(qpl_status, qpl_init_job_for_class, (qpl_path_t qpl_path,
+                                             qpl_operation_class op_class,
+                                             qpl_job *qpl_job_ptr)) {
+    QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET (qpl_op_class_zero < op_class, QPL_STS_INVALID_PARAM_ERR);
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    return own_init_job(qpl_path, op_class, qpl_job_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_fini_job, (qpl_job *qpl_job_ptr)) {
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+    uint32_t status = QPL_STS_OK;
 
+    if (qpl_path_software != qpl_job_ptr->data_ptr.path) {
+        status = hw_accelerator_finalize(&((qpl_hw_state *) qpl_job_ptr->data_ptr.hw_state_ptr)->accel_context);
+    }
+
+    return static_cast<qpl_status>(status);
+}
+
+uint32_t own_get_job_size(qpl_path_t qpl_path, qpl_operation_class op_class) {
     // qpl_job_ptr can have any alignment,
     // therefore need to add additional bytes to be able to align pointers
-    *job_size_ptr  = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT) + QPL_DEFAULT_ALIGNMENT;
+    uint32_t size = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT) + QPL_DEFAULT_ALIGNMENT;
 
     // add storage required for internal stuctures
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    size += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    size += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    size += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_class), QPL_DEFAULT_ALIGNMENT);
+    size += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_class), QPL_DEFAULT_ALIGNMENT);
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
-        *job_size_ptr += QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
+        size += QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
     }
 
-    return QPL_STS_OK;
+    return size;
 }
 
-QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
+qpl_status own_init_job(qpl_path_t qpl_path, qpl_operation_class op_class, qpl_job *qpl_job_ptr) {
     using namespace qpl;
 
-    QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
-    QPL_BAD_PTR_RET(qpl_job_ptr);
-
     uint32_t       status                   = QPL_STS_OK;
     const uint32_t job_size                 = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
     const uint32_t comp_size                = QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
     const uint32_t decomp_size              = QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_class),
+                                                               QPL_DEFAULT_ALIGNMENT);
+    const uint32_t middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_class),
+                                                               QPL_DEFAULT_ALIGNMENT);
 
     core_sw::util::set_zeros((uint8_t *) qpl_job_ptr, job_size);
 
@@ -92,6 +136,7 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
     qpl_job_ptr->data_ptr.middle_layer_buffer_ptr = qpl_job_ptr->data_ptr.analytics_state_ptr + analytics_size;
     qpl_job_ptr->data_ptr.hw_state_ptr            = qpl_job_ptr->data_ptr.middle_layer_buffer_ptr + middle_layer_buffer_size;
     qpl_job_ptr->data_ptr.path                    = qpl_path;
+    qpl_job_ptr->data_ptr.op_class                = op_class;
 
 #ifdef __linux__
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
@@ -127,20 +172,40 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
     // note: ml is just a raw buffer, so no need
     own_init_compress(qpl_job_ptr);
     own_init_decompress(qpl_job_ptr);
-    own_init_analytics(qpl_job_ptr);
+
+    if (0u != analytics_size) {
+        own_init_analytics(qpl_job_ptr);
+    }
 
     return static_cast<qpl_status>(status);
 }
 
-QPL_FUN(qpl_status, qpl_fini_job, (qpl_job *qpl_job_ptr)) {
-    QPL_BAD_PTR_RET(qpl_job_ptr);
-    uint32_t status = QPL_STS_OK;
+void own_reset_job(qpl_path_t qpl_path, qpl_job *qpl_job_ptr) {
+    using namespace qpl;
 
-    if (qpl_path_software != qpl_job_ptr->data_ptr.path) {
-        status = hw_accelerator_finalize(&((qpl_hw_state *) qpl_job_ptr->data_ptr.hw_state_ptr)->accel_context);
-    }
+    const qpl_data data = qpl_job_ptr->data_ptr;
 
-    return static_cast<qpl_status>(status);
+    // Middle-layer states are created from scratch by the first job of every stream,
+    // and analytics buffers hold temporary data only, so neither of them is cleared here
+    core_sw::util::set_zeros((uint8_t *) qpl_job_ptr, sizeof(qpl_job));
+
+    qpl_job_ptr->data_ptr              = data;
+    qpl_job_ptr->data_ptr.path         = qpl_path;
+    qpl_job_ptr->data_ptr.async_status = QPL_STS_OK;
+
+    core_sw::util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.compress_state_ptr, sizeof(own_compression_state_t));
+    own_init_compress(qpl_job_ptr);
+
+    if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
+        qpl_job_ptr->numa_id = -1;
+
+        auto *const hw_state_ptr = (qpl_hw_state *) (qpl_job_ptr->data_ptr.hw_state_ptr);
+        const hw_accelerator_context accel_context = hw_state_ptr->accel_context;
+
+        core_sw::util::set_zeros((uint8_t *) hw_state_ptr, sizeof(qpl_hw_state));
+
+        hw_state_ptr->accel_context = accel_context;
+    }
 }
 
 /**
@@ -166,14 +231,20 @@ QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(
  *
  * @note Holds allocations required for performin various analytics operations.
  */
-QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path),
+                                               qpl_operation_class op_class) {
     uint32_t size = 0u;
 
+    if (qpl_op_class_all != op_class && qpl_op_class_analytics != op_class) {
+        return size;
+    }
+
     size += QPL_ALIGNED_SIZE(sizeof(own_analytics_state_t), QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_UNPACK_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_SET_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_SRC2_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    size += QPL_ALIGNED_SIZE(OWN_SRC2_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
 
     return size;
 }
@@ -187,36 +258,63 @@ QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER
  * Job structure currently is supposed to be used for either deflate or huffman only mode,
  * and not both at the same time, so it is not necessary to allocate memory required for both states,
  * hence the std::max usage below.
+ * Select and expand may decompress both sources at once, so analytics needs room for two inflate states.
+ * Jobs laid out for a single @ref qpl_operation_class get only the states this class constructs.
  */
-uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path, qpl_operation_class op_class) {
     using namespace qpl;
 
     uint32_t size = 0u;
 
+    if (qpl_op_class_crc64 == op_class || qpl_op_class_zero == op_class) {
+        return size;
+    }
+
+    const bool is_compression_used         = (qpl_op_class_all == op_class || qpl_op_class_deflate == op_class);
+    const bool is_huffman_only_decode_used = (qpl_op_class_analytics != op_class);
+    const bool is_analytics_used           = (qpl_op_class_all == op_class || qpl_op_class_analytics == op_class);
+
     if (qpl_path_software == qpl_path || qpl_path_auto == qpl_path) {
         uint32_t deflate_size      = 0;
         uint32_t huffman_only_size = 0;
+        uint32_t analytics_size    = 0;
+
+        if (is_compression_used) {
+            deflate_size += ml::compression::deflate_state<ml::execution_path_t::software>::get_buffer_size();
+            deflate_size += ml::compression::verify_state<ml::execution_path_t::software>::get_buffer_size();
+
+            huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::software>::get_buffer_size();
+        }
 
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::software>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::software>::get_buffer_size();
         deflate_size += ml::compression::inflate_state<ml::execution_path_t::software>::get_buffer_size();
 
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::software>::get_buffer_size();
-        huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::software>::get_buffer_size();
+        if (is_huffman_only_decode_used) {
+            huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::software>::get_buffer_size();
+        }
 
-        size += std::max(deflate_size, huffman_only_size);
+        if (is_analytics_used) {
+            analytics_size += 2u * ml::compression::inflate_state<ml::execution_path_t::software>::get_buffer_size();
+        }
+
+        size += std::max({deflate_size, huffman_only_size, analytics_size});
     }
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
         uint32_t deflate_size      = 0;
         uint32_t huffman_only_size = 0;
 
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::hardware>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::hardware>::get_buffer_size();
+        if (is_compression_used) {
+            deflate_size += ml::compression::deflate_state<ml::execution_path_t::hardware>::get_buffer_size();
+            deflate_size += ml::compression::verify_state<ml::execution_path_t::hardware>::get_buffer_size();
+
+            huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::hardware>::get_buffer_size();
+        }
+
         deflate_size += ml::compression::inflate_state<ml::execution_path_t::hardware>::get_buffer_size();
 
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::hardware>::get_buffer_size();
-        huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::hardware>::get_buffer_size();
+        if (is_huffman_only_decode_used) {
+            huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::hardware>::get_buffer_size();
+        }
 
         size += std::max(deflate_size, huffman_only_size);
     }
@@ -233,22 +331,27 @@ QPL_INLINE void own_init_compress(qpl_job *qpl_job_ptr) {
 
     data_ptr->middle_layer_compression_style = 0u;
     data_ptr->adler32 = 0u;
+    data_ptr->streams_count = 0u;
+    data_ptr->is_stream_verified = 0u;
 }
 
 QPL_INLINE void own_init_analytics(qpl_job *qpl_job_ptr) {
     auto *analytics_state_ptr = (own_analytics_state_t *) qpl_job_ptr->data_ptr.analytics_state_ptr;
-    analytics_state_ptr->inflate_buf_size = QPL_ALIGNED_SIZE(OWN_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
-    analytics_state_ptr->unpack_buf_size  = QPL_ALIGNED_SIZE(OWN_UNPACK_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
-    analytics_state_ptr->set_buf_size     = QPL_ALIGNED_SIZE(OWN_SET_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
-    analytics_state_ptr->src2_buf_size    = QPL_ALIGNED_SIZE(OWN_SRC2_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
-    analytics_state_ptr->inflate_buf_ptr =
+    analytics_state_ptr->inflate_buf_size      = QPL_ALIGNED_SIZE(OWN_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    analytics_state_ptr->unpack_buf_size       = QPL_ALIGNED_SIZE(OWN_UNPACK_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    analytics_state_ptr->set_buf_size          = QPL_ALIGNED_SIZE(OWN_SET_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    analytics_state_ptr->src2_buf_size         = QPL_ALIGNED_SIZE(OWN_SRC2_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    analytics_state_ptr->src2_inflate_buf_size = QPL_ALIGNED_SIZE(OWN_SRC2_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
+    analytics_state_ptr->inflate_buf_ptr       =
             (uint8_t *) analytics_state_ptr + QPL_ALIGNED_SIZE(sizeof(own_analytics_state_t), QPL_DEFAULT_ALIGNMENT);
-    analytics_state_ptr->unpack_buf_ptr  =
+    analytics_state_ptr->unpack_buf_ptr        =
             (uint8_t *) analytics_state_ptr->inflate_buf_ptr + analytics_state_ptr->inflate_buf_size;
-    analytics_state_ptr->set_buf_ptr     =
+    analytics_state_ptr->set_buf_ptr           =
             (uint8_t *) analytics_state_ptr->unpack_buf_ptr + analytics_state_ptr->unpack_buf_size;
-    analytics_state_ptr->src2_buf_ptr    =
+    analytics_state_ptr->src2_buf_ptr          =
             (uint8_t *) analytics_state_ptr->set_buf_ptr + analytics_state_ptr->set_buf_size;
+    analytics_state_ptr->src2_inflate_buf_ptr  =
+            (uint8_t *) analytics_state_ptr->src2_buf_ptr + analytics_state_ptr->src2_buf_size;
 }
 
 
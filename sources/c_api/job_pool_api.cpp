@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include "qpl/qpl.h"
+#include "compression/huffman_table/huffman_table_utils.hpp"
+
+// Legacy
+#include "own_defs.h"
+#include "own_job_layout.h"
+
+struct qpl_job_pool {
+    std::mutex          mutex;
+    allocator_t         allocator;
+    qpl_path_t          path;
+    qpl_operation_class op_class;
+    uint32_t            jobs_count;
+    uint32_t            job_stride;
+    uint32_t            free_jobs_count;
+    uint32_t            *free_jobs_ptr;   /**< Stack of indices of the jobs that can be acquired */
+    uint8_t             *is_taken_ptr;    /**< Marks of the jobs that are acquired */
+    uint8_t             *arena_ptr;       /**< Jobs placed one after another */
+};
+
+namespace {
+
+inline auto get_job(const qpl_job_pool *pool_ptr, uint32_t index) noexcept -> qpl_job * {
+    return reinterpret_cast<qpl_job *>(pool_ptr->arena_ptr + static_cast<size_t>(index) * pool_ptr->job_stride);
+}
+
+void finalize_jobs(qpl_job_pool *pool_ptr, uint32_t jobs_count, qpl_status &status) noexcept {
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        qpl_job *job_ptr = get_job(pool_ptr, i);
+
+        // Auto path jobs are switched to the software path on fallback, restore the path they were initialized with
+        job_ptr->data_ptr.path = pool_ptr->path;
+
+        auto fini_status = qpl_fini_job(job_ptr);
+
+        if (QPL_STS_OK == status) {
+            status = fini_status;
+        }
+    }
+}
+
+void deallocate(qpl_job_pool *pool_ptr) noexcept {
+    const allocator_t allocator = pool_ptr->allocator;
+
+    std::destroy_at(pool_ptr);
+    allocator.deallocator(pool_ptr);
+}
+
+} // namespace
+
+extern "C" {
+
+qpl_status qpl_job_pool_create(qpl_path_t qpl_path,
+                               qpl_operation_class op_class,
+                               uint32_t jobs_count,
+                               const allocator_t allocator,
+                               qpl_job_pool_t *pool_ptr) {
+    using namespace qpl::ml::compression;
+
+    QPL_BAD_PTR_RET(pool_ptr);
+    QPL_BADARG_RET(qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET(qpl_op_class_zero < op_class, QPL_STS_INVALID_PARAM_ERR);
+    OWN_RETURN_ERROR(0u == jobs_count, QPL_STS_SIZE_ERR);
+
+    *pool_ptr = nullptr;
+
+    const allocator_t pool_allocator = details::get_allocator(allocator);
+
+    const size_t job_stride  = QPL_ALIGNED_SIZE(own_get_job_size(qpl_path, op_class), QPL_DEFAULT_ALIGNMENT);
+    const size_t header_size = QPL_ALIGNED_SIZE(sizeof(qpl_job_pool), QPL_DEFAULT_ALIGNMENT);
+    const size_t arena_size  = job_stride * jobs_count;
+    const size_t free_size   = sizeof(uint32_t) * jobs_count;
+    const size_t marks_size  = sizeof(uint8_t) * jobs_count;
+
+    // Extra alignment bytes as the allocator isn't required to align the buffer to the cache line
+    auto *buffer = reinterpret_cast<uint8_t *>(pool_allocator.allocator(header_size + QPL_DEFAULT_ALIGNMENT +
+                                                                        arena_size + free_size + marks_size));
+
+    if (!buffer) {
+        return QPL_STS_OBJECT_ALLOCATION_ERR;
+    }
+
+    auto *pool = new (buffer) qpl_job_pool();
+
+    pool->allocator       = pool_allocator;
+    pool->path            = qpl_path;
+    pool->op_class        = op_class;
+    pool->jobs_count      = jobs_count;
+    pool->job_stride      = static_cast<uint32_t>(job_stride);
+    pool->free_jobs_count = jobs_count;
+    pool->arena_ptr       = reinterpret_cast<uint8_t *>(QPL_ALIGNED_PTR(buffer + header_size, QPL_DEFAULT_ALIGNMENT));
+    pool->free_jobs_ptr   = reinterpret_cast<uint32_t *>(pool->arena_ptr + arena_size);
+    pool->is_taken_ptr    = reinterpret_cast<uint8_t *>(pool->free_jobs_ptr + jobs_count);
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        auto status = own_init_job(qpl_path, op_class, get_job(pool, i));
+
+        if (QPL_STS_OK != status) {
+            finalize_jobs(pool, i, status);
+            deallocate(pool);
+
+            return status;
+        }
+
+        // Jobs are taken from the top of the stack, so the first jobs of the arena go first
+        pool->free_jobs_ptr[i] = jobs_count - 1u - i;
+        pool->is_taken_ptr[i]  = 0u;
+    }
+
+    // Initialization falls back to the software path if hardware is not available on the platform
+    pool->path = get_job(pool, 0u)->data_ptr.path;
+
+    *pool_ptr = pool;
+
+    return QPL_STS_OK;
+}
+
+qpl_status qpl_job_pool_acquire(qpl_job_pool_t pool, qpl_job **job_ptr) {
+    QPL_BAD_PTR2_RET(pool, job_ptr);
+
+    uint32_t index = 0u;
+
+    {
+        const std::lock_guard<std::mutex> lock(pool->mutex);
+
+        OWN_RETURN_ERROR(0u == pool->free_jobs_count, QPL_STS_JOB_POOL_EXHAUSTED_ERR);
+
+        index = pool->free_jobs_ptr[--pool->free_jobs_count];
+        pool->is_taken_ptr[index] = 1u;
+    }
+
+    *job_ptr = get_job(pool, index);
+
+    own_reset_job(pool->path, *job_ptr);
+
+    return QPL_STS_OK;
+}
+
+qpl_status qpl_job_pool_release(qpl_job_pool_t pool, qpl_job *job_ptr) {
+    QPL_BAD_PTR2_RET(pool, job_ptr);
+
+    const auto *job_begin = reinterpret_cast<const uint8_t *>(job_ptr);
+
+    OWN_RETURN_ERROR(job_begin < pool->arena_ptr, QPL_STS_INVALID_PARAM_ERR);
+
+    const size_t offset = static_cast<size_t>(job_begin - pool->arena_ptr);
+    const size_t index  = offset / pool->job_stride;
+
+    OWN_RETURN_ERROR(0u != offset % pool->job_stride || index >= pool->jobs_count, QPL_STS_INVALID_PARAM_ERR);
+
+    const std::lock_guard<std::mutex> lock(pool->mutex);
+
+    OWN_RETURN_ERROR(0u == pool->is_taken_ptr[index], QPL_STS_INVALID_PARAM_ERR);
+
+    pool->is_taken_ptr[index] = 0u;
+    pool->free_jobs_ptr[pool->free_jobs_count++] = static_cast<uint32_t>(index);
+
+    return QPL_STS_OK;
+}
+
+qpl_status qpl_job_pool_destroy(qpl_job_pool_t pool) {
+    QPL_BAD_PTR_RET(pool);
+
+    qpl_status status = QPL_STS_OK;
+
+    finalize_jobs(pool, pool->jobs_count, status);
+    deallocate(pool);
+
+    return status;
+}
+
+}
@@ -303,10 +303,12 @@ extern "C" qpl_status hw_check_job (qpl_job * qpl_job_ptr) {
         return QPL_STS_JOB_NOT_SUBMITTED;
     }
 
-    if (0u == comp_ptr->status) {
+    if (0u == ml::load_acquire(&comp_ptr->status)) {
         return QPL_STS_BEING_PROCESSED;
     }
 
+    hw_release_descriptor(comp_ptr);
+
     if (TRIVIAL_COMPLETE == comp_ptr->status) {
         job::update_input_stream (qpl_job_ptr, comp_ptr->bytes_completed);
 
@@ -346,6 +348,21 @@ extern "C" qpl_status hw_check_job (qpl_job * qpl_job_ptr) {
         return QPL_STS_OK;
     }
 
+    if (job::is_zero_operation(qpl_job_ptr)) {
+        OWN_QPL_CHECK_STATUS(ml::util::convert_status_iaa_to_qpl(reinterpret_cast<const hw_completion_record *>(comp_ptr)))
+
+        if (qpl_job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS) {
+            job::update_checksums(qpl_job_ptr, 0u, 0u);
+        } else {
+            job::update_checksums(qpl_job_ptr, comp_ptr->crc, comp_ptr->xor_checksum);
+        }
+
+        job::update_input_stream(qpl_job_ptr, desc_ptr->src1_size);
+        job::update_output_stream(qpl_job_ptr, comp_ptr->output_size, 0u);
+
+        return QPL_STS_OK;
+    }
+
     if ((AD_STATUS_SUCCESS != comp_ptr->status) && (AD_STATUS_OUTPUT_OVERFLOW != comp_ptr->status)) {
         return static_cast<qpl_status>(ml::util::convert_status_iaa_to_qpl(reinterpret_cast<const hw_completion_record *>(comp_ptr)));
     }
@@ -259,6 +259,22 @@ static inline qpl_status own_bad_argument_validation(qpl_job *const job_ptr) {
             OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_expand>(job_ptr))
             break;
 
+        case qpl_op_z_compress16:
+            OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_z_compress16>(job_ptr))
+            break;
+
+        case qpl_op_z_compress32:
+            OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_z_compress32>(job_ptr))
+            break;
+
+        case qpl_op_z_decompress16:
+            OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_z_decompress16>(job_ptr))
+            break;
+
+        case qpl_op_z_decompress32:
+            OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_z_decompress32>(job_ptr))
+            break;
+
         case qpl_op_scan_eq:
         case qpl_op_scan_ne:
         case qpl_op_scan_lt:
@@ -303,6 +319,32 @@ static inline qpl_status hw_submit_task (qpl_job *const job_ptr) {
                                          (job_ptr->flags & QPL_FLAG_CRC64_INV) != 0);
             break;
 
+        case qpl_op_z_compress16:
+        case qpl_op_z_compress32:
+        case qpl_op_z_decompress16:
+        case qpl_op_z_decompress32: {
+            uint32_t opcode = QPL_OPCODE_Z_COMP16;
+
+            switch (job_ptr->op) {
+                case qpl_op_z_compress32:   opcode = QPL_OPCODE_Z_COMP32;   break;
+                case qpl_op_z_decompress16: opcode = QPL_OPCODE_Z_DECOMP16; break;
+                case qpl_op_z_decompress32: opcode = QPL_OPCODE_Z_DECOMP32; break;
+                default: break;
+            }
+
+            hw_iaa_descriptor_init_zero_operation(descriptor_ptr,
+                                                  opcode,
+                                                  job_ptr->next_in_ptr,
+                                                  job_ptr->available_in,
+                                                  job_ptr->next_out_ptr,
+                                                  job_ptr->available_out);
+
+            if ((job_ptr->flags & QPL_FLAG_CRC32C) && !(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS)) {
+                hw_iaa_descriptor_set_crc_rfc3720(descriptor_ptr);
+            }
+            break;
+        }
+
         case qpl_op_compress: {
             if (job::is_canned_mode_compression(job_ptr)) {
                 hw_descriptor_compress_init_deflate_canned(job_ptr);
@@ -425,6 +467,14 @@ extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
             return hw_submit_task(qpl_job_ptr);
         case qpl_op_crc64:
             return hw_submit_task(qpl_job_ptr);
+        case qpl_op_z_compress16:
+        case qpl_op_z_compress32:
+        case qpl_op_z_decompress16:
+        case qpl_op_z_decompress32:
+            HW_IMMEDIATELY_RET((std::max(qpl_job_ptr->available_in, qpl_job_ptr->available_out) > MAX_BUF_SIZE),
+                               QPL_STS_BUFFER_TOO_LARGE_ERR);
+            job::reset<qpl_op_z_compress16>(qpl_job_ptr);
+            return hw_submit_task(qpl_job_ptr);
 
         default: {
             break;
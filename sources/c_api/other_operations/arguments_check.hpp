@@ -30,6 +30,44 @@ inline auto validate_operation<qpl_op_crc64>(const qpl_job *const job_ptr) noexc
     return QPL_STS_OK;
 }
 
+namespace details {
+
+inline auto validate_zero_operation(const qpl_job *const job_ptr, const uint32_t word_size) noexcept -> uint32_t {
+    QPL_BAD_PTR2_RET(job_ptr, job_ptr->next_in_ptr);
+    QPL_BAD_PTR_RET(job_ptr->next_out_ptr);
+    QPL_BAD_SIZE_RET(job_ptr->available_in);
+    QPL_BAD_SIZE_RET(job_ptr->available_out);
+
+    // Compressed stream consists of 32-bit tags and words, so it is word aligned too
+    if (0u != job_ptr->available_in % word_size) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+
+} // namespace details
+
+template<>
+inline auto validate_operation<qpl_op_z_compress16>(const qpl_job *const job_ptr) noexcept {
+    return details::validate_zero_operation(job_ptr, sizeof(uint16_t));
+}
+
+template<>
+inline auto validate_operation<qpl_op_z_compress32>(const qpl_job *const job_ptr) noexcept {
+    return details::validate_zero_operation(job_ptr, sizeof(uint32_t));
+}
+
+template<>
+inline auto validate_operation<qpl_op_z_decompress16>(const qpl_job *const job_ptr) noexcept {
+    return details::validate_zero_operation(job_ptr, sizeof(uint16_t));
+}
+
+template<>
+inline auto validate_operation<qpl_op_z_decompress32>(const qpl_job *const job_ptr) noexcept {
+    return details::validate_zero_operation(job_ptr, sizeof(uint32_t));
+}
+
 }
 
 #endif //QPL_SOURCES_C_API_OTHER_OPERATIONS_ARGUMENTS_CHECK_HPP_
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include "job.hpp"
+#include "zero.hpp"
+#include "compression/zero/zero.hpp"
+#include "arguments_check.hpp"
+
+template <qpl_operation operation>
+static inline uint32_t perform_zero(qpl_job *const job_ptr,
+                                    qpl::ml::compression::zero_operation_type operation_type,
+                                    qpl::ml::compression::zero_input_format_t input_format) noexcept {
+    using namespace qpl::ml;
+
+    auto validate_result = qpl::job::validate_operation<operation>(job_ptr);
+
+    if (validate_result) return validate_result;
+
+    auto crc_type = compression::crc_type_t::crc_32;
+
+    if (job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS) {
+        crc_type = compression::crc_type_t::none;
+    } else if (job_ptr->flags & QPL_FLAG_CRC32C) {
+        crc_type = compression::crc_type_t::crc_32c;
+    }
+
+    compression::zero_operation_result_t result;
+
+    switch (qpl::job::get_execution_path(job_ptr)) {
+        case execution_path_t::auto_detect:
+            result = compression::call_zero_operation<execution_path_t::auto_detect>(operation_type,
+                                                                                    input_format,
+                                                                                    crc_type,
+                                                                                    job_ptr->next_in_ptr,
+                                                                                    job_ptr->available_in,
+                                                                                    job_ptr->next_out_ptr,
+                                                                                    job_ptr->available_out,
+                                                                                    job_ptr->numa_id);
+            break;
+        case execution_path_t::hardware:
+            result = compression::call_zero_operation<execution_path_t::hardware>(operation_type,
+                                                                                 input_format,
+                                                                                 crc_type,
+                                                                                 job_ptr->next_in_ptr,
+                                                                                 job_ptr->available_in,
+                                                                                 job_ptr->next_out_ptr,
+                                                                                 job_ptr->available_out,
+                                                                                 job_ptr->numa_id);
+            break;
+        case execution_path_t::software:
+            result = compression::call_zero_operation<execution_path_t::software>(operation_type,
+                                                                                 input_format,
+                                                                                 crc_type,
+                                                                                 job_ptr->next_in_ptr,
+                                                                                 job_ptr->available_in,
+                                                                                 job_ptr->next_out_ptr,
+                                                                                 job_ptr->available_out,
+                                                                                 job_ptr->numa_id);
+            break;
+    }
+
+    if (result.status_code_ != status_list::ok) {
+        return result.status_code_;
+    }
+
+    const uint32_t input_size = job_ptr->available_in;
+
+    qpl::job::update_checksums(job_ptr, result.checksums_.crc32_, result.checksums_.xor_);
+    qpl::job::update_input_stream(job_ptr, input_size);
+    qpl::job::update_output_stream(job_ptr, result.output_bytes_, 0u);
+
+    return result.status_code_;
+}
+
+uint32_t perform_zero(qpl_job *const job_ptr) noexcept {
+    using namespace qpl::ml::compression;
+
+    switch (job_ptr->op) {
+        case qpl_op_z_compress16:
+            return perform_zero<qpl_op_z_compress16>(job_ptr, zero_operation_type::compress, zero_input_format_t::word_16_bit);
+        case qpl_op_z_compress32:
+            return perform_zero<qpl_op_z_compress32>(job_ptr, zero_operation_type::compress, zero_input_format_t::word_32_bit);
+        case qpl_op_z_decompress16:
+            return perform_zero<qpl_op_z_decompress16>(job_ptr, zero_operation_type::decompress, zero_input_format_t::word_16_bit);
+        case qpl_op_z_decompress32:
+            return perform_zero<qpl_op_z_decompress32>(job_ptr, zero_operation_type::decompress, zero_input_format_t::word_32_bit);
+        default:
+            return QPL_STS_OPERATION_ERR;
+    }
+}
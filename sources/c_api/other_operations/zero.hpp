@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (private C++ API)
+ */
+
+#ifndef QPL_SOURCES_C_API_OTHER_OPERATIONS_ZERO_HPP_
+#define QPL_SOURCES_C_API_OTHER_OPERATIONS_ZERO_HPP_
+
+#include "qpl/c_api/defs.h"
+
+
+/**
+ * @anchor ZERO_OPERATIONS
+ * @brief Performs zero compress or zero decompress operation for 16-bit or 32-bit words
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job
+ *
+ * @details For operation execution, you must set the following parameters in `qpl_job_ptr`:
+ *          - @ref qpl_job.next_in_ptr            - start address of the input stream
+ *          - @ref qpl_job.available_in           - number of bytes in the input stream, a multiple of the word size
+ *          - @ref qpl_job.next_out_ptr           - start address of the output stream
+ *          - @ref qpl_job.available_out          - number of bytes in the output stream
+ *
+ * The input is processed in blocks of 32 words, every block is stored as a 32-bit tag with a bit set
+ * for each non-zero word followed by the non-zero words. Zero decompress pads the output with zero words
+ * up to the block size while there is room in the output stream.
+ *
+ * @note Function looks for values @ref QPL_FLAG_CRC32C, @ref QPL_FLAG_OMIT_CHECKSUMS.
+ *
+ * @note CRC32 and XOR checksums of the uncompressed data are available in the @ref qpl_job.crc
+ *       and @ref qpl_job.xor_checksum fields.
+ *
+ * @return
+ *      - @ref QPL_STS_OK
+ *      - @ref QPL_STS_NULL_PTR_ERR
+ *      - @ref QPL_STS_SIZE_ERR
+ *      - @ref QPL_STS_DST_IS_SHORT_ERR
+ *      - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *
+ */
+uint32_t perform_zero(qpl_job *const job_ptr) noexcept;
+
+#endif //QPL_SOURCES_C_API_OTHER_OPERATIONS_ZERO_HPP_
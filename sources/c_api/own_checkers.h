@@ -46,6 +46,10 @@ if(NULL == (expression)) { \
     (1ULL << qpl_op_decompress    ) |\
     (1ULL << qpl_op_compress      ) |\
     (1ULL << qpl_op_crc64         ) |\
+    (1ULL << qpl_op_z_decompress32) |\
+    (1ULL << qpl_op_z_decompress16) |\
+    (1ULL << qpl_op_z_compress32  ) |\
+    (1ULL << qpl_op_z_compress16  ) |\
     (1ULL << qpl_op_extract       ) |\
     (1ULL << qpl_op_select        ) |\
     (1ULL << qpl_op_expand        ) |\
@@ -56,7 +60,8 @@ if(NULL == (expression)) { \
     (1ULL << qpl_op_scan_gt       ) |\
     (1ULL << qpl_op_scan_ge       ) |\
     (1ULL << qpl_op_scan_range    ) |\
-    (1ULL << qpl_op_scan_not_range))
+    (1ULL << qpl_op_scan_not_range) |\
+    (1ULL << qpl_op_scan_program  ))
 
 #define QPL_BAD_OP_RET(op)\
    { QPL_BADARG_RET((0 == (((uint64_t)QPL_VALID_OP >> op) & 1)), QPL_STS_OPERATION_ERR)};
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_SOURCES_C_API_OWN_JOB_LAYOUT_H_
+#define QPL_SOURCES_C_API_OWN_JOB_LAYOUT_H_
+
+#include "qpl/c_api/job.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Returns size of a job holding only the internal buffers required by the operation class
+ */
+uint32_t own_get_job_size(qpl_path_t qpl_path, qpl_operation_class op_class);
+
+/**
+ * @brief Lays out and clears internal buffers of a job allocated with @ref own_get_job_size
+ *
+ * @note For the hardware path the accelerator context is acquired as in @ref qpl_init_job
+ */
+qpl_status own_init_job(qpl_path_t qpl_path, qpl_operation_class op_class, qpl_job *qpl_job_ptr);
+
+/**
+ * @brief Prepares a previously initialized job for reuse
+ *
+ * @note Only the job fields and small per-operation states are cleared, the layout and
+ *       the accelerator context are kept
+ */
+void own_reset_job(qpl_path_t qpl_path, qpl_job *qpl_job_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_SOURCES_C_API_OWN_JOB_LAYOUT_H_
@@ -17,12 +17,24 @@
 #include "util/checkers.hpp" // OWN_QPL_CHECK_STATUS
 #include "own_checkers.h"    // QPL_BADARG_RET
 
+#include <cstring>
+
 extern "C" {
 
 /*
  * Storage scheme for a serialized table:
  * |meta structure|compression table|decompression table|
  *
+ * In compact format only the deflate header (i.e. encoded code lengths) follows the meta structure:
+ * |meta structure|deflate header bit size|deflate header|,
+ * all tables are rebuilt from it during deserialization.
+ *
+ * With QPL_SERIALIZATION_FLAG_IN_PLACE tables are stored as images of the internal structures,
+ * every part of the stream starts at 64-byte aligned offset:
+ * |meta structure|padding|compression table|decompression table|,
+ * so that deserialized table could point directly into the stream.
+ * Layout of the stream is marked in meta.flags.
+ *
  * Whether we have both tables or just one in the buffer is determined
  * by value stored in meta.type (combined, compression or decompression table).
  *
@@ -46,7 +58,9 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
     OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(size_ptr))
     QPL_BADARG_RET(options.format > serialization_raw, QPL_STS_SERIALIZATION_FORMAT_ERROR)
 
-    if (options.format != serialization_raw)
+    const bool is_in_place = (options.flags & QPL_SERIALIZATION_FLAG_IN_PLACE);
+
+    if (options.format == serialization_compact && is_in_place)
         return QPL_STS_NOT_SUPPORTED_MODE_ERR;
 
     auto meta_ptr = reinterpret_cast<huffman_table_meta_t*>(table);
@@ -57,6 +71,22 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
     size_t meta_size = 0;
     qpl::ml::serialization::get_meta_size(*meta_ptr, &meta_size);
 
+    if (options.format == serialization_compact) {
+        auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
+
+        *size_ptr = meta_size + table_impl->get_compact_stream_size();
+
+        return QPL_STS_OK;
+    }
+
+    if (is_in_place) {
+        qpl::ml::serialization::get_in_place_meta_size(*meta_ptr, &meta_size);
+
+        *size_ptr = meta_size + qpl::ml::serialization::get_in_place_tables_size(meta_ptr->type);
+
+        return QPL_STS_OK;
+    }
+
     // todo: consider moving to a separate function to get table sizes,
     //       might be useful for the future, if we decide to use actual
     //       flatten size vs sizeof(struct) or if the internal table impl
@@ -98,12 +128,47 @@ qpl_status qpl_huffman_table_serialize(const qpl_huffman_table_t table,
     if (stream_buffer_size == 0)
         return QPL_STS_SIZE_ERR;
 
-    if (options.format != serialization_raw)
-        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+    size_t required_size = 0;
+
+    auto status = qpl_huffman_table_get_serialized_size(table, options, &required_size);
+    if (status != QPL_STS_OK)
+        return status;
+
+    if (stream_buffer_size < required_size)
+        return QPL_STS_SIZE_ERR;
 
     auto meta_ptr = reinterpret_cast<huffman_table_meta_t*>(table);
-    if (meta_ptr->algorithm != compression_algorithm_e::deflate)
-        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+
+    // layout of the stream is marked in the flags of serialized meta
+    // to choose the proper way of deserialization later
+    huffman_table_meta_t stream_meta = *meta_ptr;
+
+    if (options.format == serialization_compact) {
+        stream_meta.flags |= qpl::ml::serialization::compact_stream_flag;
+
+        qpl::ml::serialization::serialize_meta(stream_meta, stream_buffer);
+
+        size_t offset = 0;
+        qpl::ml::serialization::get_meta_size(stream_meta, &offset);
+
+        auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
+
+        return static_cast<qpl_status>(table_impl->write_to_compact_stream(stream_buffer + offset));
+    }
+
+    if (options.flags & QPL_SERIALIZATION_FLAG_IN_PLACE) {
+        stream_meta.flags |= qpl::ml::serialization::in_place_stream_flag;
+
+        size_t offset = 0;
+        qpl::ml::serialization::get_in_place_meta_size(stream_meta, &offset);
+
+        std::memset(stream_buffer, 0, offset);
+        qpl::ml::serialization::serialize_meta(stream_meta, stream_buffer);
+
+        auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
+
+        return static_cast<qpl_status>(table_impl->write_to_in_place_stream(stream_buffer + offset));
+    }
 
     // todo: move impl to a special namespace to reflect meta struct version,
     // to accommodate future implementations
@@ -199,7 +264,20 @@ qpl_status qpl_huffman_table_deserialize(const uint8_t *const stream_buffer,
     if (meta_ptr->algorithm == compression_algorithm_e::deflate) {
         auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(*table_ptr);
 
-        status = static_cast<qpl_status>(table_impl->init_with_stream(stream_buffer + offset));
+        if (meta_ptr->flags & qpl::ml::serialization::compact_stream_flag) {
+            status = (stream_buffer_size > offset)
+                     ? static_cast<qpl_status>(table_impl->init_with_compact_stream(stream_buffer + offset,
+                                                                                    stream_buffer_size - offset))
+                     : QPL_STS_SIZE_ERR;
+        } else if (meta_ptr->flags & qpl::ml::serialization::in_place_stream_flag) {
+            qpl::ml::serialization::get_in_place_meta_size(*meta_ptr, &offset);
+
+            status = (stream_buffer_size >= offset + qpl::ml::serialization::get_in_place_tables_size(meta_ptr->type))
+                     ? static_cast<qpl_status>(table_impl->init_with_in_place_stream(stream_buffer + offset))
+                     : QPL_STS_SIZE_ERR;
+        } else {
+            status = static_cast<qpl_status>(table_impl->init_with_stream(stream_buffer + offset));
+        }
     }
     if (meta_ptr->algorithm == compression_algorithm_e::huffman_only) {
         auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::huffman_only>*>(*table_ptr);
@@ -210,7 +288,78 @@ qpl_status qpl_huffman_table_deserialize(const uint8_t *const stream_buffer,
     std::destroy_at(meta_ptr);
     meta_allocator.deallocator(buffer);
 
+    if (status != QPL_STS_OK) {
+        qpl_huffman_table_destroy(*table_ptr);
+        *table_ptr = nullptr;
+    }
+
     return status;
 }
 
+/**
+ * @brief Function that creates Huffman table on top of the tables stored in the memory buffer,
+ * that was serialized for in-place usage. The buffer is neither copied nor owned by the table.
+ */
+qpl_status qpl_huffman_table_deserialize_in_place(uint8_t *const stream_buffer,
+                                                  const size_t stream_buffer_size,
+                                                  allocator_t allocator,
+                                                  qpl_huffman_table_t *table_ptr) {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(table_ptr))
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(stream_buffer))
+    if (stream_buffer_size == 0)
+        return QPL_STS_SIZE_ERR;
+
+    // tables are used directly from the buffer, hardware path requires them to be aligned
+    if (reinterpret_cast<uintptr_t>(stream_buffer) % qpl::ml::serialization::in_place_alignment != 0)
+        return QPL_STS_INVALID_PARAM_ERR;
+
+    *table_ptr = nullptr;
+
+    huffman_table_meta_t meta{};
+
+    size_t offset = 0;
+    qpl::ml::serialization::get_in_place_meta_size(meta, &offset);
+
+    if (stream_buffer_size < offset)
+        return QPL_STS_SIZE_ERR;
+
+    qpl::ml::serialization::deserialize_meta(stream_buffer, meta);
+
+    if (meta.version != LAST_VERSION ||
+        meta.algorithm != compression_algorithm_e::deflate ||
+        !(meta.flags & qpl::ml::serialization::in_place_stream_flag))
+        return QPL_STS_SERIALIZATION_FORMAT_ERROR;
+
+    if (stream_buffer_size < offset + qpl::ml::serialization::get_in_place_tables_size(meta.type))
+        return QPL_STS_SIZE_ERR;
+
+    allocator_t table_allocator = details::get_allocator(allocator);
+
+    auto buffer = table_allocator.allocator(sizeof(huffman_table_t<compression_algorithm_e::deflate>));
+
+    if (!buffer) {
+        return QPL_STS_OBJECT_ALLOCATION_ERR;
+    }
+
+    huffman_table_t<compression_algorithm_e::deflate>* huffman_table_ptr = new (buffer) huffman_table_t<compression_algorithm_e::deflate>();
+
+    auto status = huffman_table_ptr->create_in_place(meta.type,
+                                                     meta.path,
+                                                     (allocator_t) allocator,
+                                                     stream_buffer + offset);
+    if (status != status_list::ok) {
+        std::destroy_at(huffman_table_ptr);
+        table_allocator.deallocator(buffer);
+
+        return static_cast<qpl_status>(status);
+    }
+
+    *table_ptr = reinterpret_cast<qpl_huffman_table_t>(huffman_table_ptr);
+
+    return QPL_STS_OK;
+}
+
 }
@@ -65,6 +65,16 @@ HW_PATH_GENERAL_API(hw_accelerator_status, accelerator_submit_descriptor, (hw_ac
  *
  */
 hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id);
+
+/**
+ * @brief hw_release_descriptor - stops counting the completed descriptor in the load of its work queue
+ *
+ * @param[in]   completion_record_ptr  - pointer to completion record of the descriptor
+ *
+ * @note Calling it for the descriptor that isn't in flight has no effect
+ *
+ */
+void hw_release_descriptor(const void *completion_record_ptr);
 #ifdef __cplusplus
 }
 #endif
@@ -62,6 +62,25 @@ HW_PATH_IAA_API(void, descriptor_init_crc64, (hw_descriptor * descriptor_ptr,
                                               uint64_t      polynomial,
                                               bool          is_be_bit_order,
                                               bool          is_inverse));
+
+/**
+ * @brief Inits @ref hw_descriptor for zero compress or zero decompress operation
+ * @param[in,out] descriptor_ptr        pointer to allocated descriptor to init
+ * @param[in] opcode                    one of zero operations @ref HW_OPCODES
+ * @param[in] source_ptr                pointer to the source
+ * @param[in] source_size               number of bytes in the source
+ * @param[out] destination_ptr          pointer to the destination
+ * @param[in] destination_size          capacity of the destination in bytes
+ *
+ * @note CRC32 of the uncompressed data is calculated by default, use @ref hw_iaa_descriptor_set_crc_rfc3720 to switch to CRC32C
+ *
+ */
+HW_PATH_IAA_API(void, descriptor_init_zero_operation, (hw_descriptor * descriptor_ptr,
+                                                       uint32_t      opcode,
+                                                       const uint8_t *source_ptr,
+                                                       uint32_t      source_size,
+                                                       uint8_t       *destination_ptr,
+                                                       uint32_t      destination_size));
 /** @} */
 
 
@@ -25,6 +25,10 @@ typedef uint64_t hw_operation_flags_t; /**< Represents operation's flags */
 #define QPL_OPCODE_DECOMPRESS   0x42u    /**< Intel® IAA decompress operation code */
 #define QPL_OPCODE_COMPRESS     0x43u    /**< Intel® IAA compress operation code */
 #define QPL_OPCODE_CRC64        0x44u    /**< Intel® IAA crc64 operation code */
+#define QPL_OPCODE_Z_DECOMP32   0x48u    /**< Intel® IAA zero decompress operation code for 32-bit words */
+#define QPL_OPCODE_Z_DECOMP16   0x49u    /**< Intel® IAA zero decompress operation code for 16-bit words */
+#define QPL_OPCODE_Z_COMP32     0x4Cu    /**< Intel® IAA zero compress operation code for 32-bit words */
+#define QPL_OPCODE_Z_COMP16     0x4Du    /**< Intel® IAA zero compress operation code for 16-bit words */
 #define QPL_OPCODE_SCAN         0x50u    /**< Intel® IAA scan operation code */
 #define QPL_OPCODE_EXTRACT      0x52u    /**< Intel® IAA extract operation code */
 #define QPL_OPCODE_SELECT       0x53u    /**< Intel® IAA select operation code */
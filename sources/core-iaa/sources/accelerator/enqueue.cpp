@@ -13,6 +13,9 @@
 #include "hw_descriptors_api.h"
 #include "dispatcher/hw_dispatcher.hpp"
 #include "dispatcher/numa.hpp"
+#include "dispatcher/hw_scheduler.hpp"
+
+#include <array>
 
 extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id) {
     auto result = HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
@@ -31,27 +34,49 @@ extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t d
     int32_t numa_id = (device_numa_id == -1) ? qpl::ml::util::get_numa_id()
                                              : device_numa_id;
 
-    for (uint64_t try_count = 0u; try_count < device_count; ++try_count) {
-        const auto &device = dispatcher.device(device_idx);
-        device_idx = (device_idx+1) % device_count;
-
-        /*
-         * the purpose of the check below is to ensure that job would be
-         * launched on the device requested by user, meaning
-         * if user specified device_numa_id, we check that the program is
-         * indeed run on the requested NUMA node
-         *
-         * explanation regarding (device.numa_id() != (uint64_t)(-1)):
-         * accfg_device_get_numa_node() at sources/middle-layer/dispatcher/hw_device.cpp
-         * currently returns -1 in case of VM and/or when NUMA is not configured,
-         * here is the temporary w/a, so that we don't exit in this case,
-         * but just use current device
-         *
-         * @todo address w/a and remove (device.numa_id() != (uint64_t)(-1)) check
-         */
-        if ((device.numa_id() != (uint64_t)numa_id) && (device.numa_id() != (uint64_t)(-1))) {
-            continue;
+    /*
+     * Devices of the requested NUMA node are tried from the least loaded one.
+     * If the node wasn't requested by user, devices of other nodes are tried next
+     * while they are not occupied too much (bounded spill-over)
+     *
+     * explanation regarding (device.numa_id() != (uint64_t)(-1)):
+     * accfg_device_get_numa_node() at sources/middle-layer/dispatcher/hw_device.cpp
+     * currently returns -1 in case of VM and/or when NUMA is not configured,
+     * here is the temporary w/a, so that we don't exit in this case,
+     * but just use current device
+     *
+     * @todo address w/a and remove (device.numa_id() != (uint64_t)(-1)) check
+     */
+    const auto is_local = [&](uint32_t idx) {
+        const auto &device = dispatcher.device(idx);
+
+        return (device.numa_id() == (uint64_t)numa_id) || (device.numa_id() == (uint64_t)(-1));
+    };
+
+    std::array<uint32_t, MAX_NUM_DEV> order{};
+    std::array<uint32_t, MAX_NUM_DEV> candidates{};
+    uint32_t                          local_count  = 0u;
+    uint32_t                          remote_count = 0u;
+
+    qpl::ml::dispatcher::order_by_load(static_cast<uint32_t>(device_count),
+                                       [&](uint32_t idx) { return dispatcher.device(idx).load(); },
+                                       device_idx++,
+                                       order.data());
+
+    for (uint32_t i = 0u; i < device_count; ++i) {
+        if (is_local(order[i])) {
+            candidates[local_count++] = order[i];
+        }
+    }
+
+    for (uint32_t i = 0u; i < device_count && device_numa_id == -1; ++i) {
+        if (!is_local(order[i]) && qpl::ml::dispatcher::is_spill_over_allowed(dispatcher.device(order[i]).load())) {
+            candidates[local_count + remote_count++] = order[i];
         }
+    }
+
+    for (uint32_t try_count = 0u; try_count < local_count + remote_count; ++try_count) {
+        const auto &device = dispatcher.device(candidates[try_count]);
 
         hw_iaa_descriptor_hint_cpu_cache_as_destination((hw_descriptor *) desc_ptr, device.get_cache_write_available());
 
@@ -62,8 +87,6 @@ extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t d
             result = HW_ACCELERATOR_STATUS_OK;
             break;
         }
-
-
     }
 #else
     // Not supported on Windows yet
@@ -73,6 +96,12 @@ extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t d
     return result;
 }
 
+extern "C" void hw_release_descriptor(const void *completion_record_ptr) {
+#if defined( __linux__ )
+    qpl::ml::dispatcher::hw_inflight_tracker::get_instance().release(completion_record_ptr);
+#endif
+}
+
 extern "C" hw_accelerator_status hw_accelerator_submit_descriptor(hw_accelerator_context *const UNREFERENCED_PARAMETER(accel_context_ptr),
                                                                   const hw_descriptor *const descriptor_ptr,
                                                                   hw_accelerator_submit_options *const submit_options) {
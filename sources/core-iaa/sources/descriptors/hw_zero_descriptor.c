@@ -0,0 +1,27 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "own_hw_definitions.h"
+#include "hw_descriptors_api.h"
+
+#include "simple_memory_ops_c_bind.h"
+
+HW_PATH_IAA_API(void, descriptor_init_zero_operation, (hw_descriptor *const descriptor_ptr,
+                                                       const uint32_t opcode,
+                                                       const uint8_t *const source_ptr,
+                                                       const uint32_t source_size,
+                                                       uint8_t *const destination_ptr,
+                                                       const uint32_t destination_size)) {
+    call_c_set_zeros_uint8_t((uint8_t *) descriptor_ptr, sizeof(hw_descriptor));
+
+    hw_iaa_analytics_descriptor *const this_ptr = (hw_iaa_analytics_descriptor *) descriptor_ptr;
+
+    this_ptr->op_code_op_flags = ADOF_OPCODE(opcode);
+    this_ptr->src1_ptr         = (uint8_t *) source_ptr;
+    this_ptr->src1_size        = source_size;
+    this_ptr->dst_ptr          = destination_ptr;
+    this_ptr->max_dst_size     = destination_size;
+}
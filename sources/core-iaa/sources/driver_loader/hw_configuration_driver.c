@@ -40,6 +40,7 @@ static qpl_desc_t functions_table[] = {
         {NULL, "accfg_device_get_version"},
         {NULL, "accfg_wq_get_block_on_fault"},
         {NULL, "accfg_device_get_iaa_cap"},
+        {NULL, "accfg_wq_get_size"},
 
         // Terminate list/init
         {NULL, NULL}
@@ -160,6 +161,10 @@ int accfg_device_get_iaa_cap(struct accfg_device *device, uint64_t *iaa_cap) {
     return ((accfg_device_get_iaa_cap_ptr) functions_table[18].function) (device, iaa_cap);
 }
 
+uint64_t accfg_wq_get_size(accfg_wq *wq) {
+    return ((accfg_wq_get_size_ptr) functions_table[19].function)(wq);
+}
+
 /* ------ Internal functions implementation ------ */
 
 bool own_load_configuration_functions(void *driver_instance_ptr) {
@@ -39,11 +39,26 @@ unsigned long long _xgetbv(unsigned int index) {
 #define CPUID_AVX512DQ      0x00020000
 #define EXC_OSXSAVE         0x08000000 // 27th  bit
 
+#define CPUID_AVX2          0x00000020
+#define CPUID_BMI1          0x00000008
+#define CPUID_BMI2          0x00000100
+#define CPUID_FMA           0x00001000
+#define CPUID_MOVBE         0x00400000
+#define CPUID_POPCNT        0x00800000
+#define CPUID_AVX           0x10000000
+#define CPUID_EXT_LZCNT     0x00000020
+#define CPUID_VPCLMULQDQ    0x00000400 // 10th bit of ECX, leaf 7
+
 // CPUID_AVX512_MASK covers all the instructions used in middle-layer.
 // Intel® Intelligent Storage Acceleration Library (Intel® ISA-L) component has
 // a standalone dispatching logic and has its own masks.
 #define CPUID_AVX512_MASK (CPUID_AVX512F | CPUID_AVX512CD | CPUID_AVX512VL | CPUID_AVX512BW | CPUID_AVX512DQ)
 
+// CPUID_AVX2_MASK and CPUID_AVX2_ECX_MASK cover the Haswell feature set the avx2 kernels are compiled for
+// (-march=haswell), so the compiler is free to use BMI/LZCNT/MOVBE/FMA instructions in the avx2 build.
+#define CPUID_AVX2_MASK     (CPUID_AVX2 | CPUID_BMI1 | CPUID_BMI2)
+#define CPUID_AVX2_ECX_MASK (CPUID_AVX | CPUID_FMA | CPUID_MOVBE | CPUID_POPCNT)
+
 namespace qpl::core_sw::dispatcher {
 class kernel_dispatcher_singleton
 {
@@ -56,63 +71,92 @@ public:
 static kernel_dispatcher_singleton g_kernel_dispatcher_singleton;
 
 extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
 extern unpack_table_t avx512_unpack_table;
 
 extern pack_index_table_t px_pack_index_table;
+extern pack_index_table_t avx2_pack_index_table;
 extern pack_index_table_t avx512_pack_index_table;
 
 extern unpack_prle_table_t px_unpack_prle_table;
+extern unpack_prle_table_t avx2_unpack_prle_table;
 extern unpack_prle_table_t avx512_unpack_prle_table;
 
 extern scan_i_table_t px_scan_i_table;
+extern scan_i_table_t avx2_scan_i_table;
 extern scan_i_table_t avx512_scan_i_table;
 
 extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
 extern scan_table_t avx512_scan_table;
 
+extern scan_program_table_t px_scan_program_table;
+extern scan_program_table_t avx2_scan_program_table;
+extern scan_program_table_t avx512_scan_program_table;
+
 extern pack_table_t px_pack_table;
+extern pack_table_t avx2_pack_table;
 extern pack_table_t avx512_pack_table;
 
 extern extract_table_t px_extract_table;
+extern extract_table_t avx2_extract_table;
 extern extract_table_t avx512_extract_table;
 
 extern extract_i_table_t px_extract_i_table;
+extern extract_i_table_t avx2_extract_i_table;
 extern extract_i_table_t avx512_extract_i_table;
 
 extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
 extern aggregates_table_t avx512_aggregates_table;
 
 extern select_table_t px_select_table;
+extern select_table_t avx2_select_table;
 extern select_table_t avx512_select_table;
 
 extern select_i_table_t px_select_i_table;
+extern select_i_table_t avx2_select_i_table;
 extern select_i_table_t avx512_select_i_table;
 
 extern expand_table_t px_expand_table;
+extern expand_table_t avx2_expand_table;
 extern expand_table_t avx512_expand_table;
 
 extern memory_copy_table_t px_memory_copy_table;
+extern memory_copy_table_t avx2_memory_copy_table;
 extern memory_copy_table_t avx512_memory_copy_table;
 
 extern zero_table_t px_zero_table;
+extern zero_table_t avx2_zero_table;
 extern zero_table_t avx512_zero_table;
 
 extern move_table_t px_move_table;
+extern move_table_t avx2_move_table;
 extern move_table_t avx512_move_table;
 
 extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
 extern crc64_table_t avx512_crc64_table;
+extern crc64_table_t avx512_vpclmulqdq_crc64_table;
 
 extern xor_checksum_table_t px_xor_checksum_table;
+extern xor_checksum_table_t avx2_xor_checksum_table;
 extern xor_checksum_table_t avx512_xor_checksum_table;
 
+extern zero_compress_table_t px_zero_compress_table;
+extern zero_compress_table_t avx2_zero_compress_table;
+extern zero_compress_table_t avx512_zero_compress_table;
+
 extern deflate_table_t px_deflate_table;
+extern deflate_table_t avx2_deflate_table;
 extern deflate_table_t avx512_deflate_table;
 
 extern deflate_fix_table_t px_deflate_fix_table;
+extern deflate_fix_table_t avx2_deflate_fix_table;
 extern deflate_fix_table_t avx512_deflate_fix_table;
 
 extern setup_dictionary_table_t px_setup_dictionary_table;
+extern setup_dictionary_table_t avx2_setup_dictionary_table;
 extern setup_dictionary_table_t avx512_setup_dictionary_table;
 
 
@@ -121,17 +165,27 @@ auto detect_platform() -> arch_t {
     int    cpu_info[4];
     cpuid(cpu_info, 7);
     bool avx512_support_cpu  = ((cpu_info[1] & CPUID_AVX512_MASK) == CPUID_AVX512_MASK);
+    bool avx2_support_cpu    = ((cpu_info[1] & CPUID_AVX2_MASK) == CPUID_AVX2_MASK);
+
+    cpuid(cpu_info, 0x80000001);
+    avx2_support_cpu = avx2_support_cpu && (cpu_info[2] & CPUID_EXT_LZCNT);
 
     cpuid(cpu_info, 1);
     bool os_uses_XSAVE_XSTORE = cpu_info[2] & EXC_OSXSAVE;
+    avx2_support_cpu = avx2_support_cpu && ((cpu_info[2] & CPUID_AVX2_ECX_MASK) == CPUID_AVX2_ECX_MASK);
 
     // Check if XGETBV enabled for application use
     if (os_uses_XSAVE_XSTORE) {
         unsigned long long xcr_feature_mask = _xgetbv(0);
-        // Check if OPMASK state and ZMM state are enabled
-        if ((xcr_feature_mask & 0xe0) == 0xe0) {
-             // Check if XMM state and YMM state are enabled
-             if ((xcr_feature_mask & 0x6) == 0x6) {
+        // Check if XMM state and YMM state are enabled
+        if ((xcr_feature_mask & 0x6) == 0x6) {
+            // Check if AVX2 features are supported
+            if (avx2_support_cpu) {
+                detected_platform = arch_t::avx2_arch;
+            }
+
+            // Check if OPMASK state and ZMM state are enabled
+            if ((xcr_feature_mask & 0xe0) == 0xe0) {
                 // Check if AVX512 features are supported
                 if (avx512_support_cpu) {
                     detected_platform = arch_t::avx512_arch;
@@ -143,6 +197,13 @@ auto detect_platform() -> arch_t {
     return detected_platform;
 }
 
+auto is_vpclmulqdq_supported() -> bool {
+    int cpu_info[4];
+    cpuid(cpu_info, 7);
+
+    return cpu_info[2] & CPUID_VPCLMULQDQ;
+}
+
 auto get_unpack_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t {
     uint32_t input_be_shift = (flag_be) ? 32u : 0u;
     // Unpack function table contains 64 entries - starts from 1-32 bit-width for le_format, then 1-32 for BE input
@@ -179,6 +240,13 @@ auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index)
     return scan_index;
 }
 
+auto get_scan_program_index(const uint32_t bit_width) -> uint32_t {
+    // Scan program function table contains 3 entries for 8u, 16u & 32u unpacked data;
+    uint32_t scan_program_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+
+    return scan_program_index;
+}
+
 auto get_extract_index(const uint32_t bit_width) -> uint32_t {
     // Extract function table contains 3 entries for 8u, 16u & 32u unpacked data;
     uint32_t extract_index = BITS_2_DATA_TYPE_INDEX(bit_width);
@@ -207,6 +275,13 @@ auto get_memory_copy_index(const uint32_t bit_width) -> uint32_t {
     return memory_copy_index;
 }
 
+auto get_zero_compress_index(const bool is_decompress, const uint32_t word_bit_width) -> uint32_t {
+    // Zero compress function table contains compress kernels for 16u & 32u words followed by decompress kernels
+    uint32_t zero_compress_index = (32u == word_bit_width) ? 1u : 0u;
+
+    return (is_decompress) ? zero_compress_index + 2u : zero_compress_index;
+}
+
 auto get_pack_bits_index(const uint32_t flag_be,
                          const uint32_t src_bit_width,
                          const uint32_t out_bit_width) -> uint32_t {
@@ -292,6 +367,10 @@ auto kernels_dispatcher::get_scan_table() const noexcept -> const scan_table_t &
     return *scan_table_ptr_;
 }
 
+auto kernels_dispatcher::get_scan_program_table() const noexcept -> const scan_program_table_t & {
+    return *scan_program_table_ptr_;
+}
+
 auto kernels_dispatcher::get_aggregates_table() const noexcept -> const aggregates_table_t & {
     return *aggregates_table_ptr_;
 }
@@ -332,6 +411,10 @@ auto kernels_dispatcher::get_xor_checksum_table() const noexcept -> const xor_ch
     return *xor_checksum_table_ptr_;
 }
 
+auto kernels_dispatcher::get_zero_compress_table() const noexcept -> const zero_compress_table_t & {
+    return *zero_compress_table_ptr_;
+}
+
 auto kernels_dispatcher::get_deflate_table() const noexcept -> const deflate_table_t & {
     return *deflate_table_ptr_;
 }
@@ -352,7 +435,27 @@ auto kernels_dispatcher::get_expand_table() const noexcept -> const expand_table
 kernels_dispatcher::kernels_dispatcher() noexcept {
     arch_ = detect_platform();
 
-    switch (arch_) {
+    set_tables(arch_);
+}
+
+auto kernels_dispatcher::get_arch() const noexcept -> arch_t {
+    return arch_;
+}
+
+auto kernels_dispatcher::set_arch(const arch_t arch) noexcept -> bool {
+    // A tier can be forced only if it is supported by the current CPU
+    if (arch > detect_platform()) {
+        return false;
+    }
+
+    arch_ = arch;
+    set_tables(arch_);
+
+    return true;
+}
+
+void kernels_dispatcher::set_tables(const arch_t arch) noexcept {
+    switch (arch) {
         case arch_t::avx512_arch: {
             unpack_table_ptr_                = &avx512_unpack_table;
             // This is a bug, should be fixed, avx512_prle kernel fails the tests
@@ -361,6 +464,7 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             pack_table_ptr_                  = &avx512_pack_table;
             scan_i_table_ptr_                = &avx512_scan_i_table;
             scan_table_ptr_                  = &avx512_scan_table;
+            scan_program_table_ptr_          = &avx512_scan_program_table;
             extract_table_ptr_               = &avx512_extract_table;
             extract_i_table_ptr_             = &avx512_extract_i_table;
             aggregates_table_ptr_            = &avx512_aggregates_table;
@@ -370,13 +474,41 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             memory_copy_table_ptr_           = &avx512_memory_copy_table;
             zero_table_ptr_                  = &avx512_zero_table;
             move_table_ptr_                  = &avx512_move_table;
-            crc64_table_ptr_                 = &avx512_crc64_table;
+            crc64_table_ptr_                 = (is_vpclmulqdq_supported())
+                                               ? &avx512_vpclmulqdq_crc64_table
+                                               : &avx512_crc64_table;
             xor_checksum_table_ptr_          = &avx512_xor_checksum_table;
+            zero_compress_table_ptr_         = &avx512_zero_compress_table;
             deflate_table_ptr_               = &avx512_deflate_table;
             deflate_fix_table_ptr_           = &avx512_deflate_fix_table;
             setup_dictionary_table_ptr_      = &avx512_setup_dictionary_table;
             break;
         }
+        case arch_t::avx2_arch: {
+            unpack_table_ptr_                = &avx2_unpack_table;
+            unpack_prle_table_ptr_           = &avx2_unpack_prle_table;
+            pack_index_table_ptr_            = &avx2_pack_index_table;
+            pack_table_ptr_                  = &avx2_pack_table;
+            scan_i_table_ptr_                = &avx2_scan_i_table;
+            scan_table_ptr_                  = &avx2_scan_table;
+            scan_program_table_ptr_          = &avx2_scan_program_table;
+            extract_table_ptr_               = &avx2_extract_table;
+            extract_i_table_ptr_             = &avx2_extract_i_table;
+            aggregates_table_ptr_            = &avx2_aggregates_table;
+            select_table_ptr_                = &avx2_select_table;
+            select_i_table_ptr_              = &avx2_select_i_table;
+            expand_table_ptr_                = &avx2_expand_table;
+            memory_copy_table_ptr_           = &avx2_memory_copy_table;
+            zero_table_ptr_                  = &avx2_zero_table;
+            move_table_ptr_                  = &avx2_move_table;
+            crc64_table_ptr_                 = &avx2_crc64_table;
+            xor_checksum_table_ptr_          = &avx2_xor_checksum_table;
+            zero_compress_table_ptr_         = &avx2_zero_compress_table;
+            deflate_table_ptr_               = &avx2_deflate_table;
+            deflate_fix_table_ptr_           = &avx2_deflate_fix_table;
+            setup_dictionary_table_ptr_      = &avx2_setup_dictionary_table;
+            break;
+        }
         default: {
             unpack_table_ptr_                = &px_unpack_table;
             unpack_prle_table_ptr_           = &px_unpack_prle_table;
@@ -384,6 +516,7 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             pack_table_ptr_                  = &px_pack_table;
             scan_i_table_ptr_                = &px_scan_i_table;
             scan_table_ptr_                  = &px_scan_table;
+            scan_program_table_ptr_          = &px_scan_program_table;
             extract_table_ptr_               = &px_extract_table;
             extract_i_table_ptr_             = &px_extract_i_table;
             aggregates_table_ptr_            = &px_aggregates_table;
@@ -395,6 +528,7 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             move_table_ptr_                  = &px_move_table;
             crc64_table_ptr_                 = &px_crc64_table;
             xor_checksum_table_ptr_          = &px_xor_checksum_table;
+            zero_compress_table_ptr_         = &px_zero_compress_table;
             deflate_table_ptr_               = &px_deflate_table;
             deflate_fix_table_ptr_           = &px_deflate_fix_table;
             setup_dictionary_table_ptr_      = &px_setup_dictionary_table;
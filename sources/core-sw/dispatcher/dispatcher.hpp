@@ -20,6 +20,7 @@
 #include "qplc_aggregates.h"
 #include "qplc_expand.h"
 #include "qplc_checksum.h"
+#include "qplc_zero_compress.h"
 
 #define OWN_MIN_(a, b) (a < b) ? a : b
 
@@ -34,6 +35,8 @@ enum arch_t {
 
 auto detect_platform() -> arch_t;
 
+auto is_vpclmulqdq_supported() -> bool;
+
 auto get_unpack_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t;
 
 auto get_pack_index(const uint32_t flag_be, const uint32_t out_bit_width, const uint32_t flag_nominal) -> uint32_t;
@@ -42,6 +45,8 @@ auto get_unpack_prle_index(const uint32_t bit_width) -> uint32_t;
 
 auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index) -> uint32_t;
 
+auto get_scan_program_index(const uint32_t bit_width) -> uint32_t;
+
 auto get_extract_index(const uint32_t bit_width) -> uint32_t;
 
 auto get_select_index(const uint32_t bit_width) -> uint32_t;
@@ -56,6 +61,8 @@ auto get_aggregates_index(const uint32_t src_bit_width) -> uint32_t;
 
 auto get_memory_copy_index(const uint32_t bit_width) -> uint32_t;
 
+auto get_zero_compress_index(const bool is_decompress, const uint32_t word_bit_width) -> uint32_t;
+
 using unpack_table_t = std::array<qplc_unpack_bits_t_ptr, 64>;
 
 using pack_index_table_t = std::array<qplc_pack_index_t_ptr, 8>;
@@ -65,6 +72,9 @@ using unpack_prle_table_t = std::array<qplc_unpack_prle_t_ptr, 3>;
 using scan_i_table_t = std::array<qplc_scan_i_t_ptr, 24>;
 using scan_table_t = std::array<qplc_scan_t_ptr, 24>;
 
+// Contains qplc_scan_program_8u/16u8u/32u8u kernels
+using scan_program_table_t = std::array<qplc_scan_program_t_ptr, 3>;
+
 using pack_table_t = std::array<qplc_pack_bits_t_ptr, 70>;
 
 using extract_table_t = std::array<qplc_extract_t_ptr, 3>;
@@ -81,9 +91,13 @@ using memory_copy_table_t = std::array<qplc_copy_t_ptr, 3>;
 using zero_table_t = std::array<qplc_zero_t_ptr, 1>;
 using move_table_t = std::array<qplc_move_t_ptr, 1>;
 
-using crc64_table_t = std::array<qplc_crc64_t_ptr, 1>;
+// Contains qplc_crc64, qplc_crc64_init_constants and qplc_crc64_fold kernels
+using crc64_table_t = std::array<void *, 3u>;
 using xor_checksum_table_t = std::array<qplc_xor_checksum_t_ptr, 1>;
 
+// Contains qplc_zero_compress_16u/32u and qplc_zero_decompress_16u/32u kernels
+using zero_compress_table_t = std::array<qplc_zero_compress_t_ptr, 4u>;
+
 using deflate_table_t = std::array<void*, 3u>;
 
 using deflate_fix_table_t = std::array<void*, 1u>;
@@ -116,6 +130,8 @@ public:
 
     [[nodiscard]] auto get_scan_table() const noexcept -> const scan_table_t &;
 
+    [[nodiscard]] auto get_scan_program_table() const noexcept -> const scan_program_table_t &;
+
     [[nodiscard]] auto get_extract_table() const noexcept -> const extract_table_t &;
 
     [[nodiscard]] auto get_extract_i_table() const noexcept -> const extract_i_table_t &;
@@ -136,22 +152,37 @@ public:
 
     [[nodiscard]] auto get_xor_checksum_table() const noexcept -> const xor_checksum_table_t &;
 
+    [[nodiscard]] auto get_zero_compress_table() const noexcept -> const zero_compress_table_t &;
+
     [[nodiscard]] auto get_deflate_table() const noexcept -> const deflate_table_t &;
 
     [[nodiscard]] auto get_deflate_fix_table() const noexcept -> const deflate_fix_table_t &;
 
     [[nodiscard]] auto get_setup_dictionary_table() const noexcept -> const setup_dictionary_table_t &;
 
+    [[nodiscard]] auto get_arch() const noexcept -> arch_t;
+
+    /**
+     * @brief Forces kernels of the given tier, e.g. to compare px/avx2/avx512 in benchmarks.
+     *        Not thread-safe, must be called before any operation is executed.
+     *
+     * @return false if the tier is not supported by the current CPU
+     */
+    auto set_arch(arch_t arch) noexcept -> bool;
+
 protected:
     kernels_dispatcher() noexcept;
 
 private:
+    void set_tables(arch_t arch) noexcept;
+
     unpack_table_t                  *unpack_table_ptr_                  = nullptr;
     unpack_prle_table_t             *unpack_prle_table_ptr_             = nullptr;
     pack_index_table_t              *pack_index_table_ptr_              = nullptr;
     pack_table_t                    *pack_table_ptr_                    = nullptr;
     scan_i_table_t                  *scan_i_table_ptr_                  = nullptr;
     scan_table_t                    *scan_table_ptr_                    = nullptr;
+    scan_program_table_t            *scan_program_table_ptr_            = nullptr;
     extract_table_t                 *extract_table_ptr_                 = nullptr;
     extract_i_table_t               *extract_i_table_ptr_               = nullptr;
     aggregates_table_t              *aggregates_table_ptr_              = nullptr;
@@ -163,6 +194,7 @@ private:
     move_table_t                    *move_table_ptr_                    = nullptr;
     crc64_table_t                   *crc64_table_ptr_                   = nullptr;
     xor_checksum_table_t            *xor_checksum_table_ptr_            = nullptr;
+    zero_compress_table_t           *zero_compress_table_ptr_           = nullptr;
     deflate_table_t                 *deflate_table_ptr_                 = nullptr;
     deflate_fix_table_t             *deflate_fix_table_ptr_             = nullptr;
     setup_dictionary_table_t        *setup_dictionary_table_ptr_        = nullptr;
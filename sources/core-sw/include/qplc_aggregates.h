@@ -33,7 +33,7 @@ typedef void (*qplc_aggregates_t_ptr)(const uint8_t *src_ptr,
                                       uint32_t length,
                                       uint32_t *min_value_ptr,
                                       uint32_t *max_value_ptr,
-                                      uint32_t *sum_ptr,
+                                      uint64_t *sum_ptr,
                                       uint32_t *index_ptr);
 
 /**
@@ -45,7 +45,7 @@ typedef void (*qplc_aggregates_t_ptr)(const uint8_t *src_ptr,
  * @param[in]      length         length of source vector in elements (bytes)
  * @param[in,out]  min_value_ptr  pointer to index of the first '1' in source vector
  * @param[in,out]  max_value_ptr  pointer to index of the last '1' in source vector
- * @param[in,out]  sum_ptr        pointer to the sum of all elements in source vector
+ * @param[in,out]  sum_ptr        pointer to the 64-bit sum of all elements in source vector
  * @param[in,out]  index_ptr      pointer to the current element index
  *
  * @note The index incrementing can start from any initial value set in qpl_job_ptr structure.
@@ -58,7 +58,7 @@ OWN_QPLC_API(void, qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *index_ptr))
 /** @} */
 
@@ -71,7 +71,7 @@ OWN_QPLC_API(void, qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
  * @param[in]      length         length of source vector in elements (bytes)
  * @param[in,out]  min_value_ptr  pointer to min value over input vector
  * @param[in,out]  max_value_ptr  pointer to max value over input vector
- * @param[in,out]  sum_ptr        pointer to the sum of all elements in the source vector
+ * @param[in,out]  sum_ptr        pointer to the 64-bit sum of all elements in the source vector
  * @param[in,out]  index_ptr      is not used (unreferenced parameter)
  *
  * @return
@@ -82,21 +82,21 @@ OWN_QPLC_API(void, qplc_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *index_ptr))
 
 OWN_QPLC_API(void, qplc_aggregates_16u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *index_ptr))
 
 OWN_QPLC_API(void, qplc_aggregates_32u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *index_ptr))
 /** @} */
 
@@ -14,6 +14,7 @@
 #include "qplc_memop.h"
 #include "qplc_aggregates.h"
 #include "qplc_checksum.h"
+#include "qplc_zero_compress.h"
 
 #ifndef OWN_QPL_CORE_API_H_
 #define OWN_QPL_CORE_API_H_
@@ -34,6 +35,7 @@ extern "C" {
  *      -   Unpacking input data in PRLE format to 8u, 16u or 32u integers;
  *      -   Unpacking n-bit integers' vector in BE format to 8u, 16u or 32u integers;
  *      -   Scan analytics operation in-place & out-of-place kernels for 8u, 16u and 32u input data and 8u output;
+ *      -   Scan program kernels combining several comparisons for 8u, 16u and 32u input data and 8u output;
  *      -   Extract analytics operation in-place & out-of-place kernels for 8u, 16u and 32u input data;
  *      -   Find Unique analytics operation out-of-place kernels for 8u, 16u and 32u input data;
  *      -   Set Membership analytics operation in-place kernels for 8u, 16u and 32u input data;
@@ -42,7 +44,8 @@ extern "C" {
  *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data;
  *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data in BE format;
  *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation;
- *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation in BE format.
+ *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation in BE format;
+ *      -   Zero compress and zero decompress kernels for 16u and 32u words.
  *
  */
 
@@ -13,6 +13,9 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64
+ *          - @ref qplc_crc64_init_constants
+ *          - @ref qplc_crc64_fold
  *
  */
 
@@ -31,6 +34,30 @@ typedef uint64_t (*qplc_crc64_t_ptr)(const uint8_t *src_ptr,
                                      uint8_t be_flag,
                                      uint8_t inversion_flag);
 
+/**
+ * @brief Per-polynomial constants used by @ref qplc_crc64_fold, see @ref qplc_crc64_init_constants
+ */
+typedef struct {
+    uint64_t polynomial;           /**< Polynomial in the bit order of the calculation */
+    uint64_t barrett;              /**< Constant for Barrett reduction, floor(x^128 / P(x)) */
+    uint64_t fold_64;              /**< Constant to fold 128 bits to 64 bits */
+    uint64_t fold_128[2];          /**< Constants to fold by 128 bits */
+    uint64_t fold_512[2];          /**< Constants to fold by 512 bits */
+    uint64_t fold_2048[2];         /**< Constants to fold by 2048 bits */
+    uint64_t lookup_table[256];    /**< Byte-wise lookup table */
+    uint8_t  polynomial_ending;    /**< The lowest bit of the polynomial, used for Barrett reduction in the reflected bit order */
+    uint8_t  be_flag;              /**< Bit order of the calculation */
+} qplc_crc64_constants_t;
+
+typedef void (*qplc_crc64_init_constants_t_ptr)(uint64_t polynomial,
+                                                uint8_t be_flag,
+                                                qplc_crc64_constants_t *constants_ptr);
+
+typedef uint64_t (*qplc_crc64_fold_t_ptr)(const uint8_t *src_ptr,
+                                          uint32_t length,
+                                          uint64_t crc,
+                                          const qplc_crc64_constants_t *constants_ptr);
+
 typedef uint32_t (*qplc_xor_checksum_t_ptr)(const uint8_t *buf,
                                             uint32_t len,
                                             uint32_t init_xor);
@@ -69,6 +96,52 @@ OWN_QPLC_API(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
         uint8_t be_flag,
         uint8_t inversion_flag))
 
+/**
+ * @brief Calculates constants of CRC64 calculation for the given polynomial
+ *
+ * @param[in]   polynomial      - 64-bit CRC polynomial
+ * @param[in]   be_flag         - endianness flag:
+ *                                  0 - little endian format;
+ *                                  1 - big endian format;
+ * @param[out]  constants_ptr   - pointer to the constants to fill
+ *
+ * @note The constants don't depend on the data, so they can be calculated once per polynomial and reused
+ */
+OWN_QPLC_API(void, qplc_crc64_init_constants, (uint64_t polynomial,
+        uint8_t be_flag,
+        qplc_crc64_constants_t *constants_ptr))
+
+/**
+ * @brief CRC64 update for data buffer using carry-less multiplication folding
+ *
+ * @param[in]  src_ptr          - pointer to the data buffer
+ * @param[in]  length           - length of the buffer
+ * @param[in]  crc              - current CRC value (initial value if it is the first buffer)
+ * @param[in]  constants_ptr    - constants calculated with @ref qplc_crc64_init_constants
+ *
+ * @note No inversion is applied, the caller is responsible for the initial and the final CRC inversion
+ *
+ * @return updated CRC64 value
+ */
+OWN_QPLC_API(uint64_t, qplc_crc64_fold, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint64_t crc,
+        const qplc_crc64_constants_t *constants_ptr))
+
+#if PLATFORM >= K0
+
+/**
+ * @brief Version of @ref qplc_crc64_fold that uses VPCLMULQDQ instructions
+ *
+ * @note Available only for the avx512 build, the caller must check that the CPU supports VPCLMULQDQ
+ */
+OWN_QPLC_API(uint64_t, qplc_crc64_fold_vpclmulqdq, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint64_t crc,
+        const qplc_crc64_constants_t *constants_ptr))
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
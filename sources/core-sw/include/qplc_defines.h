@@ -64,6 +64,7 @@ extern "C" {
  */
 typedef enum {
     QPLC_STS_OK                      = 0u,
+    QPLC_STS_INVALID_PARAM_ERR       = 55u,
     QPLC_STS_OUTPUT_OVERFLOW_ERR     = 221u,
     QPLC_STS_DST_IS_SHORT_ERR        = 225u,
     QPLC_STS_SRC_IS_SHORT_ERR        = 232u,
@@ -17,6 +17,7 @@
  * @details Scan Core APIs implement the following functionalities:
  *      -   Scan analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
  *      -   Scan analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Scan program kernels evaluating several comparisons combined with and/or/not in one pass.
  *
  */
 
@@ -40,6 +41,45 @@ typedef void (*qplc_scan_t_ptr)(const uint8_t *src_ptr,
                                 uint32_t low_value,
                                 uint32_t high_value);
 
+#define QPLC_SCAN_PROGRAM_MAX_SIZE  16u /**< Maximal number of instructions in the scan program */
+#define QPLC_SCAN_PROGRAM_MAX_DEPTH 8u  /**< Maximal number of results kept on the scan program stack */
+
+/**
+ * @brief Scan program opcodes, comparisons go in the order of scan kernels in the dispatcher tables
+ */
+typedef enum {
+    qplc_scan_program_eq        = 0u,
+    qplc_scan_program_ne        = 1u,
+    qplc_scan_program_lt        = 2u,
+    qplc_scan_program_le        = 3u,
+    qplc_scan_program_gt        = 4u,
+    qplc_scan_program_ge        = 5u,
+    qplc_scan_program_range     = 6u,
+    qplc_scan_program_not_range = 7u,
+    qplc_scan_program_and       = 8u,
+    qplc_scan_program_or        = 9u,
+    qplc_scan_program_not       = 10u
+} qplc_scan_program_opcode;
+
+typedef struct {
+    uint32_t opcode;        /**< @ref qplc_scan_program_opcode */
+    uint32_t low_value;     /**< Low value of the comparison */
+    uint32_t high_value;    /**< High value of the comparison */
+} qplc_scan_instruction_t;
+
+/**
+ * @brief Scan program in postfix notation: comparisons push results, and/or/not combine the topmost ones
+ */
+typedef struct {
+    uint32_t                size;
+    qplc_scan_instruction_t instructions[QPLC_SCAN_PROGRAM_MAX_SIZE];
+} qplc_scan_program_t;
+
+typedef qplc_status_t (*qplc_scan_program_t_ptr)(const uint8_t *src_ptr,
+                                                 uint8_t *dst_ptr,
+                                                 uint32_t length,
+                                                 const qplc_scan_program_t *program_ptr);
+
 /**
  * @name qplc_scan_<comparison type><input bit-width><output bit-width>_i
  *
@@ -342,6 +382,41 @@ OWN_QPLC_API(void, qplc_scan_not_range_32u8u, (const uint8_t *src_ptr,
         uint32_t high_value))
 /** @} */
 
+/**
+ * @name qplc_scan_program_<input bit-width><output bit-width>
+ *
+ * @brief Scan program kernels for 8u, 16u and 32u input data and 8u output.
+ *
+ * @param[in]   src_ptr      pointer to source vector
+ * @param[out]  dst_ptr      pointer to destination vector, can be equal to src_ptr
+ * @param[in]   length       length of source and destination vector in elements
+ * @param[in]   program_ptr  pointer to the scan program
+ *
+ * @note The program is expected to be valid: the stack never underflows or exceeds @ref QPLC_SCAN_PROGRAM_MAX_DEPTH
+ *       results and exactly one result is left at the end
+ * @note Destination vector contains result data in 8u format: 1 - program result is true, 0 - otherwise
+ *
+ * @return
+ *      - @ref QPLC_STS_OK;
+ *      - @ref QPLC_STS_INVALID_PARAM_ERR if the program contains an unknown opcode.
+ * @{
+ */
+OWN_QPLC_API(qplc_status_t, qplc_scan_program_8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr))
+
+OWN_QPLC_API(qplc_status_t, qplc_scan_program_16u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr))
+
+OWN_QPLC_API(qplc_status_t, qplc_scan_program_32u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
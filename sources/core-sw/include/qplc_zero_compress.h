@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/17/2026
+ *
+ * @defgroup SW_KERNELS_ZERO_COMPRESS_API Zero Compress API
+ * @ingroup  SW_KERNELS_PRIVATE_API
+ * @{
+ * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for `Zero Compress` and `Zero Decompress` operations
+ *
+ * @details Core APIs implement the following functionalities:
+ *      -   Zero compress kernels for 16u and 32u words;
+ *      -   Zero decompress kernels for 16u and 32u words.
+ *
+ * Input is processed in blocks of 32 words (64 bytes for 16u words, 128 bytes for 32u words).
+ * Every block is written as a 32-bit little-endian tag followed by the non-zero words of the block,
+ * bit i of the tag is set if word i of the block is non-zero. The last block may be partial,
+ * tag bits of the missing words are zero.
+ *
+ */
+
+#include "qplc_defines.h"
+
+#ifndef QPLC_ZERO_COMPRESS_H_
+#define QPLC_ZERO_COMPRESS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define QPLC_ZERO_COMPRESS_BLOCK_WORDS 32u /**< Number of words described by a single tag */
+
+typedef qplc_status_t (*qplc_zero_compress_t_ptr)(const uint8_t *src_ptr,
+                                                  uint32_t src_length,
+                                                  uint8_t *dst_ptr,
+                                                  uint32_t dst_length,
+                                                  uint32_t *output_size_ptr);
+
+/**
+ * @name qplc_zero_compress_<word bit-width>
+ *
+ * @brief Zero compress kernels for 16u and 32u words
+ *
+ * @param[in]   src_ptr          pointer to source vector
+ * @param[in]   src_length       length of source vector in bytes, must be a multiple of the word size
+ * @param[out]  dst_ptr          pointer to destination vector
+ * @param[in]   dst_length       length of destination vector in bytes
+ * @param[out]  output_size_ptr  number of bytes written to the destination
+ *
+ * @return
+ *      - @ref QPLC_STS_OK;
+ *      - @ref QPLC_STS_DST_IS_SHORT_ERR if the compressed stream doesn't fit into the destination.
+ * @{
+ */
+OWN_QPLC_API(qplc_status_t, qplc_zero_compress_16u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr))
+
+OWN_QPLC_API(qplc_status_t, qplc_zero_compress_32u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr))
+/** @} */
+
+/**
+ * @name qplc_zero_decompress_<word bit-width>
+ *
+ * @brief Zero decompress kernels for 16u and 32u words
+ *
+ * @param[in]   src_ptr          pointer to zero compressed stream
+ * @param[in]   src_length       length of source vector in bytes
+ * @param[out]  dst_ptr          pointer to destination vector
+ * @param[in]   dst_length       length of destination vector in bytes
+ * @param[out]  output_size_ptr  number of bytes written to the destination
+ *
+ * @note Every tag is expanded into the whole block, so the output is padded with zero words up to the block size.
+ *       Zero words that don't fit into the destination at the end of the stream are dropped.
+ *
+ * @return
+ *      - @ref QPLC_STS_OK;
+ *      - @ref QPLC_STS_SRC_IS_SHORT_ERR if the stream ends in the middle of a block;
+ *      - @ref QPLC_STS_DST_IS_SHORT_ERR if a non-zero word doesn't fit into the destination.
+ * @{
+ */
+OWN_QPLC_API(qplc_status_t, qplc_zero_decompress_16u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr))
+
+OWN_QPLC_API(qplc_status_t, qplc_zero_decompress_32u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr))
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_ZERO_COMPRESS_H_
+/** @} */
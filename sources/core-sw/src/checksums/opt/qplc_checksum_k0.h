@@ -11,6 +11,9 @@
 *@details Function list :
 *               -@ref k0_qplc_crc32_8u
 *               -@ref k0_qplc_xor_checksum_8u
+*               -@ref k0_qplc_crc64
+*               -@ref k0_qplc_crc64_be
+*               -@ref k0_qplc_crc64_fold
 */
 
 //  See details in the article
@@ -23,6 +26,7 @@
 #include "own_qplc_defs.h"
 #include "own_qplc_data.h"
 #include "immintrin.h"
+#include "qplc_checksum_l9.h"
 
 #if defined _MSC_VER
 #if _MSC_VER <= 1916
@@ -841,4 +845,81 @@ OWN_OPT_FUN(uint64_t, k0_qplc_crc64_be, (const uint8_t *src_ptr,
 #endif
 #endif
 
+OWN_VPCLMULQDQ_TARGET
+OWN_QPLC_INLINE(__m512i, own_k0_crc64_fold_512, (__m512i value, __m512i constants, __m512i data)) {
+    __m512i low  = _mm512_clmulepi64_epi128(value, constants, 0x00);
+    __m512i high = _mm512_clmulepi64_epi128(value, constants, 0x11);
+
+    return _mm512_ternarylogic_epi64(low, high, data, 0x96);
+}
+
+/**
+ * @brief CRC64 folding of the buffer using VPCLMULQDQ, the length must be a non-zero multiple of 16 bytes
+ */
+OWN_VPCLMULQDQ_TARGET
+OWN_OPT_FUN(uint64_t, k0_qplc_crc64_fold, (const uint8_t *src_ptr,
+                                           uint32_t length,
+                                           uint64_t crc,
+                                           const qplc_crc64_constants_t *constants_ptr)) {
+    if (length < 256u) {
+        return own_l9_crc64_fold(src_ptr, length, crc, constants_ptr);
+    }
+
+    const __m512i shuffle_mask = _mm512_broadcast_i32x4(own_l9_crc64_shuffle_mask(constants_ptr->be_flag));
+    const __m512i fold_512     = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)constants_ptr->fold_512));
+    const __m512i fold_2048    = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)constants_ptr->fold_2048));
+    const __m128i fold_128     = _mm_loadu_si128((const __m128i *)constants_ptr->fold_128);
+
+    // The CRC is added to the first 64 bits of the data
+    __m128i crc_mm = (constants_ptr->be_flag) ? _mm_set_epi64x(0, (int64_t)crc) : _mm_set_epi64x((int64_t)crc, 0);
+
+    __m512i zmm0 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)src_ptr), shuffle_mask);
+    __m512i zmm1 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 64u)), shuffle_mask);
+    __m512i zmm2 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 128u)), shuffle_mask);
+    __m512i zmm3 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 192u)), shuffle_mask);
+
+    zmm0 = _mm512_xor_si512(zmm0, _mm512_inserti32x4(_mm512_setzero_si512(), crc_mm, 0));
+
+    src_ptr += 256u;
+    length  -= 256u;
+
+    // 1. Fold 16 lanes by 2048 bits
+    while (length >= 256u) {
+        zmm0 = own_k0_crc64_fold_512(zmm0, fold_2048,
+                                     _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)src_ptr), shuffle_mask));
+        zmm1 = own_k0_crc64_fold_512(zmm1, fold_2048,
+                                     _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 64u)), shuffle_mask));
+        zmm2 = own_k0_crc64_fold_512(zmm2, fold_2048,
+                                     _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 128u)), shuffle_mask));
+        zmm3 = own_k0_crc64_fold_512(zmm3, fold_2048,
+                                     _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)(src_ptr + 192u)), shuffle_mask));
+
+        src_ptr += 256u;
+        length  -= 256u;
+    }
+
+    // 2. Reduce 16 lanes to 4 and fold them by 512 bits
+    zmm0 = own_k0_crc64_fold_512(zmm0, fold_512, zmm1);
+    zmm0 = own_k0_crc64_fold_512(zmm0, fold_512, zmm2);
+    zmm0 = own_k0_crc64_fold_512(zmm0, fold_512, zmm3);
+
+    while (length >= 64u) {
+        zmm0 = own_k0_crc64_fold_512(zmm0, fold_512,
+                                     _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)src_ptr), shuffle_mask));
+
+        src_ptr += 64u;
+        length  -= 64u;
+    }
+
+    // 3. Reduce 4 lanes to one and fold by 128 bits
+    __m128i xmm0 = _mm512_extracti32x4_epi32(zmm0, 0);
+    xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, _mm512_extracti32x4_epi32(zmm0, 1));
+    xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, _mm512_extracti32x4_epi32(zmm0, 2));
+    xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, _mm512_extracti32x4_epi32(zmm0, 3));
+
+    xmm0 = own_l9_crc64_fold_tail_128(xmm0, src_ptr, length, constants_ptr);
+
+    return own_l9_crc64_reduce(xmm0, constants_ptr);
+}
+
 #endif // OWN_CHECKSUM_H
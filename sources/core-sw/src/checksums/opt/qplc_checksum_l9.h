@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+* @brief Contains PCLMULQDQ implementation of functions for checksum
+* @date 10/16/2026
+*
+*@details Function list :
+*               -@ref own_l9_crc64_fold
+*/
+
+//  See details in the article
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+
+#ifndef OWN_CHECKSUM_L9_H
+#define OWN_CHECKSUM_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Folds 128-bit lane with the given constants and adds the data to it
+ */
+OWN_QPLC_INLINE(__m128i, own_l9_crc64_fold_128, (__m128i value, __m128i constants, __m128i data)) {
+    __m128i low  = _mm_clmulepi64_si128(value, constants, 0x00);
+    __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(low, high), data);
+}
+
+/**
+ * @brief Byte shuffle applied to the data before folding,
+ *        in the little endian format the most significant bits go first, so bytes are reversed
+ */
+OWN_QPLC_INLINE(__m128i, own_l9_crc64_shuffle_mask, (uint8_t be_flag)) {
+    if (be_flag) {
+        return _mm_set_epi8(0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08,
+                            0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00);
+    }
+
+    return _mm_set_epi8(0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                        0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F);
+}
+
+OWN_QPLC_INLINE(__m128i, own_l9_crc64_load, (const uint8_t *src_ptr, __m128i shuffle_mask)) {
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src_ptr), shuffle_mask);
+}
+
+/**
+ * @brief Reduces 128-bit folded value to 64-bit CRC using Barrett reduction
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_crc64_reduce, (__m128i value, const qplc_crc64_constants_t *constants_ptr)) {
+    const __m128i fold_64    = _mm_set1_epi64x((int64_t)constants_ptr->fold_64);
+    const __m128i barrett    = _mm_set1_epi64x((int64_t)constants_ptr->barrett);
+    const __m128i polynomial = _mm_set1_epi64x((int64_t)constants_ptr->polynomial);
+    __m128i       tmp_0;
+    __m128i       tmp_1;
+
+    if (!constants_ptr->be_flag) {
+        // 1. Apply 64 bits fold to 64 bits + 64 bits crc(64 zero bits)
+        tmp_0 = _mm_clmulepi64_si128(value, fold_64, 0x11);
+        value = _mm_xor_si128(_mm_slli_si128(value, 8), tmp_0);
+
+        /* 2. Barrett reduction, as u and P(x) are 65-bit values, we use clmul + xor for each multiplication
+         * Step 1: T1(x) = floor(R(x) / x^64)) * u
+         * Step 2: T2(x) = floor(T1(x) / x^64)) * P(x)
+         * Step 3: C(x)  = R(x) xor T2(x) mod x^64 */
+        tmp_0 = _mm_clmulepi64_si128(value, barrett, 0x11);
+        tmp_0 = _mm_xor_si128(tmp_0, _mm_unpackhi_epi64(_mm_setzero_si128(), value));
+
+        tmp_1 = _mm_clmulepi64_si128(tmp_0, polynomial, 0x11);
+        tmp_1 = _mm_xor_si128(tmp_1, _mm_unpackhi_epi64(_mm_setzero_si128(), tmp_0));
+
+        value = _mm_xor_si128(value, tmp_1);
+
+        return (uint64_t)_mm_cvtsi128_si64(value);
+    } else {
+        tmp_0 = _mm_clmulepi64_si128(value, fold_64, 0x00);
+        value = _mm_xor_si128(_mm_srli_si128(value, 8), tmp_0);
+
+        /* Step 1: T1(x)' = (R(x)' mod x^64) * u'
+         * Step 2: T2(x)' = (T1(x)' mod x^64) * P(x)'
+         * Step 3: C(x)   = R(x)' xor T2(x)' mod x^64 */
+        tmp_0 = _mm_clmulepi64_si128(value, barrett, 0x00);
+        tmp_1 = _mm_clmulepi64_si128(tmp_0, polynomial, 0x00);
+
+        if (constants_ptr->polynomial_ending) {
+            tmp_1 = _mm_xor_si128(tmp_1, _mm_slli_si128(tmp_0, 8));
+        }
+
+        value = _mm_xor_si128(value, tmp_1);
+
+        return (uint64_t)_mm_extract_epi64(value, 1);
+    }
+}
+
+/**
+ * @brief Folds the given value by 128 bits with each of the following 16-byte blocks
+ */
+OWN_QPLC_INLINE(__m128i, own_l9_crc64_fold_tail_128, (__m128i value,
+                                                      const uint8_t *src_ptr,
+                                                      uint32_t length,
+                                                      const qplc_crc64_constants_t *constants_ptr)) {
+    const __m128i fold_128     = _mm_loadu_si128((const __m128i *)constants_ptr->fold_128);
+    const __m128i shuffle_mask = own_l9_crc64_shuffle_mask(constants_ptr->be_flag);
+
+    for (uint32_t i = 0u; i < length; i += 16u) {
+        value = own_l9_crc64_fold_128(value, fold_128, own_l9_crc64_load(src_ptr + i, shuffle_mask));
+    }
+
+    return value;
+}
+
+/**
+ * @brief Initial 128-bit value for folding, the CRC is added to the first 64 bits of the data
+ */
+OWN_QPLC_INLINE(__m128i, own_l9_crc64_init_value, (const uint8_t *src_ptr, uint64_t crc, uint8_t be_flag)) {
+    __m128i crc_mm = (be_flag) ? _mm_set_epi64x(0, (int64_t)crc) : _mm_set_epi64x((int64_t)crc, 0);
+
+    return _mm_xor_si128(own_l9_crc64_load(src_ptr, own_l9_crc64_shuffle_mask(be_flag)), crc_mm);
+}
+
+/**
+ * @brief CRC64 folding of the buffer, the length must be a non-zero multiple of 16 bytes
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_crc64_fold, (const uint8_t *src_ptr,
+                                              uint32_t length,
+                                              uint64_t crc,
+                                              const qplc_crc64_constants_t *constants_ptr)) {
+    const __m128i shuffle_mask = own_l9_crc64_shuffle_mask(constants_ptr->be_flag);
+    __m128i       xmm0         = own_l9_crc64_init_value(src_ptr, crc, constants_ptr->be_flag);
+
+    src_ptr += 16u;
+    length  -= 16u;
+
+    // 1. Fold 4 lanes by 512 bits
+    if (length >= 64u) {
+        const __m128i fold_128 = _mm_loadu_si128((const __m128i *)constants_ptr->fold_128);
+        const __m128i fold_512 = _mm_loadu_si128((const __m128i *)constants_ptr->fold_512);
+
+        __m128i xmm1 = own_l9_crc64_load(src_ptr, shuffle_mask);
+        __m128i xmm2 = own_l9_crc64_load(src_ptr + 16u, shuffle_mask);
+        __m128i xmm3 = own_l9_crc64_load(src_ptr + 32u, shuffle_mask);
+
+        src_ptr += 48u;
+        length  -= 48u;
+
+        while (length >= 64u) {
+            xmm0 = own_l9_crc64_fold_128(xmm0, fold_512, own_l9_crc64_load(src_ptr, shuffle_mask));
+            xmm1 = own_l9_crc64_fold_128(xmm1, fold_512, own_l9_crc64_load(src_ptr + 16u, shuffle_mask));
+            xmm2 = own_l9_crc64_fold_128(xmm2, fold_512, own_l9_crc64_load(src_ptr + 32u, shuffle_mask));
+            xmm3 = own_l9_crc64_fold_128(xmm3, fold_512, own_l9_crc64_load(src_ptr + 48u, shuffle_mask));
+
+            src_ptr += 64u;
+            length  -= 64u;
+        }
+
+        // 2. Reduce 4 lanes to one
+        xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, xmm1);
+        xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, xmm2);
+        xmm0 = own_l9_crc64_fold_128(xmm0, fold_128, xmm3);
+    }
+
+    // 3. Fold by 128 bits
+    xmm0 = own_l9_crc64_fold_tail_128(xmm0, src_ptr, length, constants_ptr);
+
+    return own_l9_crc64_reduce(xmm0, constants_ptr);
+}
+
+#endif // OWN_CHECKSUM_L9_H
@@ -13,16 +13,24 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64
+ *          - @ref qplc_crc64_init_constants
+ *          - @ref qplc_crc64_fold
  *
  */
 
 #include "own_qplc_defs.h"
 #include "own_qplc_data.h"
+#include "qplc_checksum.h"
 
 #if PLATFORM >= K0
 
 #include "opt/qplc_checksum_k0.h"
 
+#elif PLATFORM >= L9
+
+#include "opt/qplc_checksum_l9.h"
+
 #endif
 
 /**
@@ -247,3 +255,149 @@ OWN_QPLC_FUN(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
     return crc;
 #endif
 }
+
+/**
+ * @brief bits reflecting in 64-bit value
+ */
+OWN_QPLC_INLINE(uint64_t, own_crc64_reflect, (uint64_t x)) {
+    uint64_t y = 0u;
+
+    for (uint32_t i = 0u; i < 8u; i++) {
+        y |= ((uint64_t)bit_reverse_table[(x >> (i * 8u)) & 0xFF]) << ((7u - i) * 8u);
+    }
+
+    return y;
+}
+
+/**
+ * @brief calculates x^power mod P(x), power must be not less than 64
+ */
+OWN_QPLC_INLINE(uint64_t, own_crc64_x_pow_mod, (uint32_t power, uint64_t polynomial)) {
+    uint64_t crc = polynomial; // x^64 mod poly
+
+    for (uint32_t i = 64u; i < power; i++) {
+        crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief folding constants for the distance in bits:
+ *        x^distance mod poly and x^(distance + 64) mod poly, or reflected x^(distance + 63) mod poly and x^(distance - 1) mod poly
+ */
+OWN_QPLC_INLINE(void, own_crc64_fold_constants, (uint32_t distance, uint64_t polynomial, uint8_t be_flag, uint64_t *fold_ptr)) {
+    if (be_flag) {
+        fold_ptr[0] = own_crc64_reflect(own_crc64_x_pow_mod(distance + 63u, polynomial));
+        fold_ptr[1] = own_crc64_reflect(own_crc64_x_pow_mod(distance - 1u, polynomial));
+    } else {
+        fold_ptr[0] = own_crc64_x_pow_mod(distance, polynomial);
+        fold_ptr[1] = own_crc64_x_pow_mod(distance + 64u, polynomial);
+    }
+}
+
+OWN_QPLC_FUN(void, qplc_crc64_init_constants, (uint64_t polynomial,
+                                               uint8_t be_flag,
+                                               qplc_crc64_constants_t *constants_ptr)) {
+    // 1. calculating constant for Barrett reduction (floor(x^128 / poly))
+    uint64_t crc     = polynomial;
+    uint64_t barrett = 0u;
+
+    for (uint32_t i = 0u; i < 64u; i++) {
+        barrett = (barrett << 1) ^ (crc >> 63u);
+        crc     = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+    }
+
+    // 2. calculating folding constants
+    own_crc64_fold_constants(128u, polynomial, be_flag, constants_ptr->fold_128);
+    own_crc64_fold_constants(512u, polynomial, be_flag, constants_ptr->fold_512);
+    own_crc64_fold_constants(2048u, polynomial, be_flag, constants_ptr->fold_2048);
+
+    constants_ptr->be_flag           = be_flag;
+    constants_ptr->polynomial_ending = (uint8_t)(polynomial & 1u);
+
+    if (be_flag) {
+        constants_ptr->fold_64    = own_crc64_reflect(own_crc64_x_pow_mod(127u, polynomial));
+        constants_ptr->barrett    = (own_crc64_reflect(barrett) << 1) | 1u;
+        constants_ptr->polynomial = own_crc64_reflect(polynomial) << 1;
+    } else {
+        constants_ptr->fold_64    = own_crc64_x_pow_mod(128u, polynomial);
+        constants_ptr->barrett    = barrett;
+        constants_ptr->polynomial = polynomial;
+    }
+
+    // 3. calculating byte-wise lookup table
+    const uint64_t table_polynomial = (be_flag) ? own_crc64_reflect(polynomial) : polynomial;
+
+    for (uint32_t i = 0u; i < 256u; i++) {
+        if (be_flag) {
+            crc = i;
+            for (uint32_t j = 0u; j < 8u; j++) {
+                crc = (crc >> 1) ^ (-(int64_t)(crc & 1u) & table_polynomial);
+            }
+        } else {
+            crc = (uint64_t)i << 56u;
+            for (uint32_t j = 0u; j < 8u; j++) {
+                crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & table_polynomial);
+            }
+        }
+        constants_ptr->lookup_table[i] = crc;
+    }
+}
+
+/**
+ * @brief byte-wise CRC64 update with the lookup table
+ */
+OWN_QPLC_INLINE(uint64_t, own_crc64_update_table, (const uint8_t *src_ptr,
+                                                   uint32_t length,
+                                                   uint64_t crc,
+                                                   const qplc_crc64_constants_t *constants_ptr)) {
+    const uint64_t *table_ptr = constants_ptr->lookup_table;
+
+    if (constants_ptr->be_flag) {
+        for (uint32_t i = 0u; i < length; i++) {
+            crc = table_ptr[(src_ptr[i] ^ crc) & 0xFF] ^ (crc >> 8u);
+        }
+    } else {
+        for (uint32_t i = 0u; i < length; i++) {
+            crc = table_ptr[src_ptr[i] ^ (crc >> 56u)] ^ (crc << 8u);
+        }
+    }
+
+    return crc;
+}
+
+OWN_QPLC_FUN(uint64_t, qplc_crc64_fold, (const uint8_t *src_ptr,
+                                         uint32_t length,
+                                         uint64_t crc,
+                                         const qplc_crc64_constants_t *constants_ptr)) {
+#if PLATFORM >= L9
+    // Whole 16-byte blocks are folded, the rest is processed with the lookup table
+    const uint32_t fold_length = length & ~15u;
+
+    if (fold_length) {
+        crc = own_l9_crc64_fold(src_ptr, fold_length, crc, constants_ptr);
+    }
+
+    return own_crc64_update_table(src_ptr + fold_length, length - fold_length, crc, constants_ptr);
+#else
+    return own_crc64_update_table(src_ptr, length, crc, constants_ptr);
+#endif
+}
+
+#if PLATFORM >= K0
+
+OWN_QPLC_FUN(uint64_t, qplc_crc64_fold_vpclmulqdq, (const uint8_t *src_ptr,
+                                                    uint32_t length,
+                                                    uint64_t crc,
+                                                    const qplc_crc64_constants_t *constants_ptr)) {
+    const uint32_t fold_length = length & ~15u;
+
+    if (fold_length) {
+        crc = CALL_OPT_FUNCTION(k0_qplc_crc64_fold)(src_ptr, fold_length, crc, constants_ptr);
+    }
+
+    return own_crc64_update_table(src_ptr + fold_length, length - fold_length, crc, constants_ptr);
+}
+
+#endif
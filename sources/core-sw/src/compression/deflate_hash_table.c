@@ -36,7 +36,7 @@ OWN_QPLC_FUN(void, deflate_hash_table_reset,(deflate_hash_table_t *const hash_ta
                                 OWN_HIGH_HASH_TABLE_SIZE * 4u);
 }
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void own_deflate_hash_table_update(deflate_hash_table_t *const hash_table_ptr,
                                    const uint32_t new_index,
@@ -19,7 +19,7 @@
 
 /* ------ Internal functions implementation ------ */
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t own_get_match_length_table_index(const uint32_t match_length) {
     // Based on tables on page 11 in RFC 1951
@@ -100,7 +100,7 @@ OWN_QPLC_FUN(void, deflate_histogram_reset, (deflate_histogram_t *const histogra
 }
 
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void deflate_histogram_update_match(deflate_histogram_t *const histogram_ptr, const deflate_match_t match) {
     // Histogram update
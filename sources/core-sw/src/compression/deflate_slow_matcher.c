@@ -10,7 +10,7 @@
 
 #include "deflate_defs.h"
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t compare_strings(const uint8_t *const first_ptr,
                                        const uint8_t *const second_ptr,
@@ -109,7 +109,8 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
 #endif
             best_match.offset = (uint32_t) (string_ptr - current_match_ptr);
 
-            if (best_match.length >= 258u) {
+            // Stop searching when the match is long enough for the level
+            if (best_match.length >= hash_table_ptr->nice_match) {
                 break;
             }
         }
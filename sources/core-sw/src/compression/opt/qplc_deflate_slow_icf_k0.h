@@ -132,9 +132,8 @@ OWN_OPT_FUN(uint32_t, k0_slow_deflate_icf_body,
     uint8_t  length;
 
     {
-        /* The general case has been replaced with a fixed case for perfpormance reason. */
-        //int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256;
+        /* The chain is limited for performance reason, lower levels search less */
+        int chain_length_current = (hash_table_ptr->attempts < 256u) ? (int)hash_table_ptr->attempts : 256;
 
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
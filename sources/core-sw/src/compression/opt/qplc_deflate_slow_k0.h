@@ -143,8 +143,8 @@ OWN_OPT_FUN(uint32_t, k0_slow_deflate_body,(uint8_t* current_ptr,
     uint32_t win_size = QPLC_DEFLATE_MAXIMAL_OFFSET;
 
     {
-        //        int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256; /* temporary */
+        /* The chain is limited for performance reason, lower levels search less */
+        int chain_length_current = (hash_table_ptr->attempts < 256u) ? (int)hash_table_ptr->attempts : 256;
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
         int lazy_match = hash_table_ptr->lazy_match;
@@ -20,13 +20,19 @@
 #include "own_qplc_defs.h"
 #include "immintrin.h"
 
+// Zero-extends 32-bit lanes to 64 bits, so that the sum doesn't wrap for long vectors of large values
+OWN_QPLC_INLINE(__m512i, own_k0_add_epu32_epi64, (__m512i sum, __m512i data)) {
+    sum = _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(data)));
+    return _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(data, 1)));
+}
+
 // ********************** bit ****************************** //
 
 OWN_OPT_FUN(void, k0_qplc_bit_aggregates_8u, (const uint8_t* src_ptr,
     uint32_t length,
     uint32_t* min_value_ptr,
     uint32_t* max_value_ptr,
-    uint32_t* sum_ptr,
+    uint64_t* sum_ptr,
     uint32_t* index_ptr)) {
 
     const uint8_t* src_ptr_start;
@@ -105,7 +111,7 @@ OWN_OPT_FUN(void, k0_qplc_bit_aggregates_8u, (const uint8_t* src_ptr,
             msk64 = _mm512_cmpgt_epu8_mask(z_data, z_zero);
             sum += _mm_popcnt_u64((uint64_t)msk64);
         }
-        *sum_ptr += (uint32_t)sum;
+        *sum_ptr += (uint64_t)sum;
     }
 }
 
@@ -124,7 +130,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
     uint32_t length,
     uint32_t* min_value_ptr,
     uint32_t* max_value_ptr,
-    uint32_t* sum_ptr)) {
+    uint64_t* sum_ptr)) {
     uint32_t    min_value = *min_value_ptr;
     uint32_t    max_value = *max_value_ptr;
     __m512i     z_data;
@@ -143,19 +149,19 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
         if (max_value >= 0xff) {
             for (uint32_t idx = 0u; idx < length; idx += 64) {
                 z_data = _mm512_sad_epu8(z_zero, _mm512_loadu_si512((void const*)(src_ptr + idx))); /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
             }
             if (remind) {
                 msk64 = (__mmask64)_bzhi_u64((uint64_t)((int64_t)(-1)), remind);
                 z_data = _mm512_sad_epu8(z_zero, _mm512_maskz_loadu_epi8(msk64, (void const*)(src_ptr + length))); /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
             }
         } else {
             for (uint32_t idx = 0u; idx < length; idx += 64) {
                 z_data = _mm512_loadu_si512((void const*)(src_ptr + idx));
                 z_max = _mm512_max_epu8(z_max, z_data);                     /* z_max  = max */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
 
             }
             if (remind) {
@@ -163,7 +169,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
                 z_data = _mm512_maskz_loadu_epi8(msk64, (void const*)(src_ptr + length));
                 z_max = _mm512_max_epu8(z_max, z_data);                     /* z_max  = max */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
             }
         }
     } else {
@@ -172,7 +178,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
                 z_data = _mm512_loadu_si512((void const*)(src_ptr + idx));
                 z_min = _mm512_min_epu8(z_min, z_data);                     /* z_min  = min */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
 
             }
             if (remind) {
@@ -180,7 +186,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
                 z_data = _mm512_maskz_loadu_epi8(msk64, (void const*)(src_ptr + length));
                 z_min = _mm512_mask_min_epu8(z_min, msk64, z_min, z_data);  /* z_min  = min */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
             }
         } else {
             for (uint32_t idx = 0u; idx < length; idx += 64) {
@@ -188,7 +194,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
                 z_min = _mm512_min_epu8(z_min, z_data);                     /* z_min  = min */
                 z_max = _mm512_max_epu8(z_max, z_data);                     /* z_max  = max */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
 
             }
             if (remind) {
@@ -197,7 +203,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
                 z_min = _mm512_mask_min_epu8(z_min, msk64, z_min, z_data);  /* z_min  = min */
                 z_max = _mm512_max_epu8(z_max, z_data);                     /* z_max  = max */
                 z_data = _mm512_sad_epu8(z_data, z_zero);                   /* z_data = s7 s6 s5 s4 s3 s2 s1 s0 */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
+                z_sum = _mm512_add_epi64(z_sum, z_data);                    /* z_sum  = S7 S6 S5 S4 S3 S2 S1 S0 */
             }
         }
     }
@@ -223,12 +229,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_8u, (const uint8_t* src_ptr,
         x_data = _mm_max_epu8(x_data, _mm_srli_epi16(x_data, 8));           /* x_data =  mx0 */
         *max_value_ptr = (uint32_t)(_mm_cvtsi128_si32(x_data) & 0xff);
     }
-    y_data = _mm512_extracti64x4_epi64(z_sum, 1);
-    y_data = _mm256_add_epi32(y_data, _mm512_castsi512_si256(z_sum));       /* y_data =S3 S2 S1 S0 */
-    x_data = _mm256_extracti128_si256(y_data, 1);
-    x_data = _mm_add_epi32(x_data, _mm256_castsi256_si128(y_data));         /* x_data = S1 S0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_si128(x_data, 8));              /* x_data = S0 */
-    *sum_ptr += (uint32_t)_mm_cvtsi128_si32(x_data);
+    *sum_ptr += (uint64_t)_mm512_reduce_add_epi64(z_sum);                 /* z_sum = S7 .. S0 */
 }
 #if defined _MSC_VER
 #if _MSC_VER <= 1916
@@ -247,7 +248,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
     uint32_t  length,
     uint32_t* min_value_ptr,
     uint32_t* max_value_ptr,
-    uint32_t* sum_ptr)) {
+    uint64_t* sum_ptr)) {
     const uint16_t* src_16u_ptr = (uint16_t*)src_ptr;
     uint32_t    min_value = *min_value_ptr;
     uint32_t    max_value = *max_value_ptr;
@@ -268,8 +269,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
             for (uint32_t idx = 0u; idx < length; idx += 32) {
                 z_data_0 = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)(src_16u_ptr + idx)));
                 z_data_1 = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)(src_16u_ptr + idx + 16)));
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
             if (remind) {
                 msk32 = (__mmask32)_bzhi_u32((uint32_t)(-1), remind);
@@ -277,8 +277,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 y_data = _mm512_extracti64x4_epi64(z_data_0, 1);
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
         } else  {
             for (uint32_t idx = 0u; idx < length; idx += 32) {
@@ -287,8 +286,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_max = _mm512_max_epu16(z_max, z_data_0);                  /* z_max  = max */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
             if (remind) {
                 msk32 = (__mmask32)_bzhi_u32((uint32_t)(-1), remind);
@@ -297,8 +295,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_max = _mm512_max_epu16(z_max, z_data_0);                  /* z_max  = max */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
         }
     } else {
@@ -309,8 +306,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_min = _mm512_min_epu16(z_min, z_data_0);                  /* z_min  = min */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
             if (remind) {
                 msk32 = (__mmask32)_bzhi_u32((uint32_t)(-1), remind);
@@ -319,8 +315,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_min = _mm512_mask_min_epu16(z_min, msk32, z_min, z_data_0); /* z_min  = min */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
         } else {
             for (uint32_t idx = 0u; idx < length; idx += 32) {
@@ -330,8 +325,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_max = _mm512_max_epu16(z_max, z_data_0);                  /* z_max  = max */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
             if (remind) {
                 msk32 = (__mmask32)_bzhi_u32((uint32_t)(-1), remind);
@@ -341,8 +335,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
                 z_max = _mm512_max_epu16(z_max, z_data_0);                  /* z_max  = max */
                 z_data_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(z_data_0));
                 z_data_1 = _mm512_cvtepu16_epi32(y_data);
-                z_sum = _mm512_add_epi32(z_sum, z_data_0);
-                z_sum = _mm512_add_epi32(z_sum, z_data_1);                  /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_add_epi32(z_data_0, z_data_1));
             }
         }
     }
@@ -366,13 +359,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_16u, (const uint8_t* src_ptr,
         x_data = _mm_max_epu16(x_data, _mm_srli_epi32(x_data, 16));        /* x_data = mx0 */
         *max_value_ptr = (uint32_t)(_mm_cvtsi128_si32(x_data) & 0xffff);
     }
-    y_data = _mm512_extracti64x4_epi64(z_sum, 1);
-    y_data = _mm256_add_epi32(y_data, _mm512_castsi512_si256(z_sum));       /* y_data = S7 .. S0 */
-    x_data = _mm256_extracti128_si256(y_data, 1);
-    x_data = _mm_add_epi32(x_data, _mm256_castsi256_si128(y_data));         /* x_data = S3 .. S0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_si128(x_data, 8));              /* x_data = S1 S0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_epi64(x_data, 32));             /* x_data = S0 */
-    *sum_ptr += (uint32_t)_mm_cvtsi128_si32(x_data);
+    *sum_ptr += (uint64_t)_mm512_reduce_add_epi64(z_sum);                 /* z_sum = S7 .. S0 */
 }
 
 // ********************** 32u ****************************** //
@@ -390,7 +377,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u, (const uint8_t* src_ptr,
     uint32_t  length,
     uint32_t* min_value_ptr,
     uint32_t* max_value_ptr,
-    uint32_t* sum_ptr)) {
+    uint64_t* sum_ptr)) {
     const uint32_t* src_32u_ptr = (uint32_t*)src_ptr;
     uint32_t    min_value = *min_value_ptr;
     uint32_t    max_value = *max_value_ptr;
@@ -411,29 +398,29 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u, (const uint8_t* src_ptr,
             uint32_t    remind_16 = length & 16;
             length -= remind_16;
             for (uint32_t idx = 0u; idx < length; idx += 32) {
-                z_sum   = _mm512_add_epi32(  z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + idx)));
-                z_sum_1 = _mm512_add_epi32(z_sum_1, _mm512_loadu_si512((void const*)(src_32u_ptr + idx + 16)));
+                z_sum   = own_k0_add_epu32_epi64(  z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + idx)));
+                z_sum_1 = own_k0_add_epu32_epi64(z_sum_1, _mm512_loadu_si512((void const*)(src_32u_ptr + idx + 16)));
             }
-            z_sum = _mm512_add_epi32(z_sum, z_sum_1);
+            z_sum = _mm512_add_epi64(z_sum, z_sum_1);
             if (remind_16) {
-                z_sum = _mm512_add_epi32(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + length)));
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + length)));
                 length += 16;
             }
             if (remind) {
                 msk16 = (__mmask16)_bzhi_u32(0xffff, remind);
-                z_sum = _mm512_add_epi32(z_sum, _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length)));
+                z_sum = own_k0_add_epu32_epi64(z_sum, _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length)));
             }
         } else {
             for (uint32_t idx = 0u; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_max = _mm512_max_epu32(z_max, z_data);                    /* z_max = max */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
             if (remind) {
                 msk16 = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_max = _mm512_max_epu32(z_max, z_data);                    /* z_max = max */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
         }
     } else {
@@ -441,27 +428,27 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u, (const uint8_t* src_ptr,
             for (uint32_t idx = 0u; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_min = _mm512_min_epu32(z_min, z_data);                    /* z_min = min */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
             if (remind) {
                 msk16 = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_min = _mm512_mask_min_epu32(z_min, msk16, z_min, z_data); /* z_min = min */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
         } else {
             for (uint32_t idx = 0u; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_min = _mm512_min_epu32(z_min, z_data);                    /* z_min = min */
                 z_max = _mm512_max_epu32(z_max, z_data);                    /* z_max = max */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
             if (remind) {
                 msk16 = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_min = _mm512_mask_min_epu32(z_min, msk16, z_min, z_data); /* z_min = min */
                 z_max = _mm512_max_epu32(z_max, z_data);                    /* z_max = max */
-                z_sum = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum = own_k0_add_epu32_epi64(z_sum, z_data);              /* z_sum = s7 .. s0 */
             }
         }
     }
@@ -483,13 +470,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u, (const uint8_t* src_ptr,
         x_data = _mm_max_epu32(x_data, _mm_srli_epi64(x_data, 32));         /* x_data = mx0 */
         *max_value_ptr = (uint32_t)_mm_cvtsi128_si32(x_data);
     }
-    y_data = _mm512_extracti64x4_epi64(z_sum, 1);
-    y_data = _mm256_add_epi32(y_data, _mm512_castsi512_si256(z_sum));      /* y_data = s7 .. s0 */
-    x_data = _mm256_extracti128_si256(y_data, 1);
-    x_data = _mm_add_epi32(x_data, _mm256_castsi256_si128(y_data));        /* x_data = s3 .. s0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_si128(x_data, 8));             /* x_data = s1 s0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_epi64(x_data, 32));            /* x_data = s0 */
-    *sum_ptr += (uint32_t)_mm_cvtsi128_si32(x_data);
+    *sum_ptr += (uint64_t)_mm512_reduce_add_epi64(z_sum);                 /* z_sum = s7 .. s0 */
 }
 #if defined _MSC_VER
 #if _MSC_VER <= 1916
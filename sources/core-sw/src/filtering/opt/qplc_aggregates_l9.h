@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for calculating aggregates
+  * @date 10/16/2026
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_bit_aggregates_8u
+  *          - @ref l9_qplc_aggregates_8u
+  *          - @ref l9_qplc_aggregates_16u
+  *          - @ref l9_qplc_aggregates_32u
+  */
+#ifndef OWN_AGGREGATES_L9_H
+#define OWN_AGGREGATES_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(uint64_t, own_l9_hsum_epi64, (__m256i x)) {
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+    return (uint64_t) _mm_cvtsi128_si64(sum);
+}
+
+// Zero-extends 32-bit lanes to 64 bits, so that the sum doesn't wrap for long vectors of large values
+OWN_QPLC_INLINE(__m256i, own_l9_add_epu32_epi64, (__m256i sum, __m256i data)) {
+    sum = _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(data)));
+    return _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(data, 1)));
+}
+
+// ********************** bit ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
+    uint32_t length,
+    uint32_t *min_value_ptr,
+    uint32_t *max_value_ptr,
+    uint64_t *sum_ptr,
+    uint32_t *index_ptr)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  zero_mm  = _mm256_setzero_si256();
+    const uint32_t index    = *index_ptr;
+    uint32_t       sum      = 0u;
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i  srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        uint32_t mask  = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(srcmm, zero_mm));
+
+        if (0u != mask) {
+            if (OWN_MAX_32U == *min_value_ptr) {
+                *min_value_ptr = index + idx + _tzcnt_u32(mask);
+            }
+            *max_value_ptr = index + idx + 31u - _lzcnt_u32(mask);
+            sum += (uint32_t) _mm_popcnt_u32(mask);
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (0u != src_ptr[idx]) {
+            if (OWN_MAX_32U == *min_value_ptr) {
+                *min_value_ptr = index + idx;
+            }
+            *max_value_ptr = index + idx;
+            sum++;
+        }
+    }
+
+    *sum_ptr   += sum;
+    *index_ptr += length;
+}
+
+// ********************** 8u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_8u, (const uint8_t *src_ptr,
+    uint32_t length,
+    uint32_t *min_value_ptr,
+    uint32_t *max_value_ptr,
+    uint64_t *sum_ptr)) {
+    const uint32_t length32 = length & (-32);
+    __m256i        min_mm   = _mm256_set1_epi8((char) 0xFF);
+    __m256i        max_mm   = _mm256_setzero_si256();
+    __m256i        sum_mm   = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        min_mm = _mm256_min_epu8(min_mm, srcmm);
+        max_mm = _mm256_max_epu8(max_mm, srcmm);
+        sum_mm = _mm256_add_epi64(sum_mm, _mm256_sad_epu8(srcmm, _mm256_setzero_si256()));
+    }
+
+    uint64_t sum = 0u;
+
+    if (0u != length32) {
+        OWN_ALIGNED_ARRAY(uint8_t min_values[32], 32u);
+        OWN_ALIGNED_ARRAY(uint8_t max_values[32], 32u);
+        _mm256_store_si256((__m256i *) min_values, min_mm);
+        _mm256_store_si256((__m256i *) max_values, max_mm);
+
+        for (uint32_t i = 0u; i < 32u; i++) {
+            *min_value_ptr = (min_values[i] < *min_value_ptr) ? min_values[i] : *min_value_ptr;
+            *max_value_ptr = (max_values[i] > *max_value_ptr) ? max_values[i] : *max_value_ptr;
+        }
+
+        sum = own_l9_hsum_epi64(sum_mm);
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        sum += src_ptr[idx];
+        *min_value_ptr = (src_ptr[idx] < *min_value_ptr) ? src_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_ptr[idx] > *max_value_ptr) ? src_ptr[idx] : *max_value_ptr;
+    }
+
+    *sum_ptr += sum;
+}
+
+// ********************** 16u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_16u, (const uint8_t *src_ptr,
+    uint32_t length,
+    uint32_t *min_value_ptr,
+    uint32_t *max_value_ptr,
+    uint64_t *sum_ptr)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const uint32_t length16     = length & (-16);
+    __m256i        min_mm       = _mm256_set1_epi16((short) 0xFFFF);
+    __m256i        max_mm       = _mm256_setzero_si256();
+    __m256i        sum_mm       = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length16; idx += 16u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+        min_mm = _mm256_min_epu16(min_mm, srcmm);
+        max_mm = _mm256_max_epu16(max_mm, srcmm);
+        sum_mm = own_l9_add_epu32_epi64(sum_mm,
+                                        _mm256_add_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(srcmm)),
+                                                         _mm256_cvtepu16_epi32(_mm256_extracti128_si256(srcmm, 1))));
+    }
+
+    uint64_t sum = 0u;
+
+    if (0u != length16) {
+        OWN_ALIGNED_ARRAY(uint16_t min_values[16], 32u);
+        OWN_ALIGNED_ARRAY(uint16_t max_values[16], 32u);
+        _mm256_store_si256((__m256i *) min_values, min_mm);
+        _mm256_store_si256((__m256i *) max_values, max_mm);
+
+        for (uint32_t i = 0u; i < 16u; i++) {
+            *min_value_ptr = (min_values[i] < *min_value_ptr) ? min_values[i] : *min_value_ptr;
+            *max_value_ptr = (max_values[i] > *max_value_ptr) ? max_values[i] : *max_value_ptr;
+        }
+
+        sum = own_l9_hsum_epi64(sum_mm);
+    }
+
+    for (uint32_t idx = length16; idx < length; idx++) {
+        sum += src_16u_ptr[idx];
+        *min_value_ptr = (src_16u_ptr[idx] < *min_value_ptr) ? src_16u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_16u_ptr[idx] > *max_value_ptr) ? src_16u_ptr[idx] : *max_value_ptr;
+    }
+
+    *sum_ptr += sum;
+}
+
+// ********************** 32u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_32u, (const uint8_t *src_ptr,
+    uint32_t length,
+    uint32_t *min_value_ptr,
+    uint32_t *max_value_ptr,
+    uint64_t *sum_ptr)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const uint32_t length8      = length & (-8);
+    __m256i        min_mm       = _mm256_set1_epi32(-1);
+    __m256i        max_mm       = _mm256_setzero_si256();
+    __m256i        sum_mm       = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length8; idx += 8u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx));
+        min_mm = _mm256_min_epu32(min_mm, srcmm);
+        max_mm = _mm256_max_epu32(max_mm, srcmm);
+        sum_mm = own_l9_add_epu32_epi64(sum_mm, srcmm);
+    }
+
+    uint64_t sum = 0u;
+
+    if (0u != length8) {
+        OWN_ALIGNED_ARRAY(uint32_t min_values[8], 32u);
+        OWN_ALIGNED_ARRAY(uint32_t max_values[8], 32u);
+        _mm256_store_si256((__m256i *) min_values, min_mm);
+        _mm256_store_si256((__m256i *) max_values, max_mm);
+
+        for (uint32_t i = 0u; i < 8u; i++) {
+            *min_value_ptr = (min_values[i] < *min_value_ptr) ? min_values[i] : *min_value_ptr;
+            *max_value_ptr = (max_values[i] > *max_value_ptr) ? max_values[i] : *max_value_ptr;
+        }
+
+        sum = own_l9_hsum_epi64(sum_mm);
+    }
+
+    for (uint32_t idx = length8; idx < length; idx++) {
+        sum += src_32u_ptr[idx];
+        *min_value_ptr = (src_32u_ptr[idx] < *min_value_ptr) ? src_32u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_32u_ptr[idx] > *max_value_ptr) ? src_32u_ptr[idx] : *max_value_ptr;
+    }
+
+    *sum_ptr += sum;
+}
+
+#endif // OWN_AGGREGATES_L9_H
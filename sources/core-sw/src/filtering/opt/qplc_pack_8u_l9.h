@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for vector packing byte integers to 1...8-bit integers
+  * @date 10/16/2026
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_pack_8u1u
+  *
+  */
+#ifndef OWN_PACK_8U_L9_H
+#define OWN_PACK_8U_L9_H
+
+#include "own_qplc_defs.h"
+
+// ********************** 1u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_pack_8u1u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+    dst_ptr[0] &= OWN_BIT_MASK(start_bit);
+    while (0u != start_bit) {
+        *dst_ptr |= *src_ptr << start_bit;
+        num_elements--;
+        src_ptr++;
+        start_bit++;
+        if (OWN_BYTE_WIDTH == start_bit) {
+            dst_ptr++;
+            break;
+        }
+        if (0 == num_elements) {
+            return;
+        }
+    }
+
+    // Shift every byte's least significant bit into its sign position and collect them with movemask
+    while (num_elements >= 32u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) src_ptr);
+        *(uint32_t *) dst_ptr = (uint32_t) _mm256_movemask_epi8(_mm256_slli_epi16(srcmm, 7));
+
+        src_ptr += 32u;
+        dst_ptr += sizeof(uint32_t);
+        num_elements -= 32u;
+    }
+
+    if (0u < num_elements) {
+        uint32_t bit_buf = 0u;
+        for (uint32_t i = 0u; i < num_elements; i++) {
+            bit_buf |= (uint32_t) (OWN_1_BIT_MASK & src_ptr[i]) << i;
+        }
+        for (uint32_t i = 0u; i < OWN_BITS_2_BYTE(num_elements); i++) {
+            dst_ptr[i] = (uint8_t) (bit_buf >> (i * OWN_BYTE_WIDTH));
+        }
+    }
+}
+
+#endif // OWN_PACK_8U_L9_H
@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for scan analytics operation
+ * @date 10/16/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_lt_8u
+ *          - @ref l9_qplc_scan_lt_16u8u
+ *          - @ref l9_qplc_scan_lt_32u8u
+ *          - @ref l9_qplc_scan_le_8u
+ *          - @ref l9_qplc_scan_le_16u8u
+ *          - @ref l9_qplc_scan_le_32u8u
+ *          - @ref l9_qplc_scan_gt_8u
+ *          - @ref l9_qplc_scan_gt_16u8u
+ *          - @ref l9_qplc_scan_gt_32u8u
+ *          - @ref l9_qplc_scan_ge_8u
+ *          - @ref l9_qplc_scan_ge_16u8u
+ *          - @ref l9_qplc_scan_ge_32u8u
+ *          - @ref l9_qplc_scan_eq_8u
+ *          - @ref l9_qplc_scan_eq_16u8u
+ *          - @ref l9_qplc_scan_eq_32u8u
+ *          - @ref l9_qplc_scan_ne_8u
+ *          - @ref l9_qplc_scan_ne_16u8u
+ *          - @ref l9_qplc_scan_ne_32u8u
+ *          - @ref l9_qplc_scan_range_8u
+ *          - @ref l9_qplc_scan_range_16u8u
+ *          - @ref l9_qplc_scan_range_32u8u
+ *          - @ref l9_qplc_scan_not_range_8u
+ *          - @ref l9_qplc_scan_not_range_16u8u
+ *          - @ref l9_qplc_scan_not_range_32u8u
+ *
+ * @note AVX2 has no unsigned compare instructions, so ordered comparisons are expressed
+ *       through unsigned min/max: (a <= b) == (min(a, b) == a), (a >= b) == (max(a, b) == a)
+ */
+
+#ifndef SCAN_L9_OPT_H
+#define SCAN_L9_OPT_H
+
+#include "own_qplc_defs.h"
+
+typedef enum {
+    own_l9_scan_eq = 0,
+    own_l9_scan_ne,
+    own_l9_scan_lt,
+    own_l9_scan_le,
+    own_l9_scan_gt,
+    own_l9_scan_ge,
+    own_l9_scan_range,
+    own_l9_scan_not_range
+} own_l9_scan_flavor_t;
+
+// ------ Scalar predicate used for the tails ------
+
+OWN_QPLC_INLINE(uint8_t, own_l9_scan_scalar, (uint32_t value,
+                                               uint32_t low_value,
+                                               uint32_t high_value,
+                                               own_l9_scan_flavor_t flavor)) {
+    switch (flavor) {
+        case own_l9_scan_eq:        return (value == low_value) ? 1u : 0u;
+        case own_l9_scan_ne:        return (value != low_value) ? 1u : 0u;
+        case own_l9_scan_lt:        return (value <  low_value) ? 1u : 0u;
+        case own_l9_scan_le:        return (value <= low_value) ? 1u : 0u;
+        case own_l9_scan_gt:        return (value >  low_value) ? 1u : 0u;
+        case own_l9_scan_ge:        return (value >= low_value) ? 1u : 0u;
+        case own_l9_scan_range:     return ((value >= low_value) && (value <= high_value)) ? 1u : 0u;
+        default:                    return ((value >= low_value) && (value <= high_value)) ? 0u : 1u;
+    }
+}
+
+// ------ Vector predicates, return all-ones lanes for matched elements ------
+
+#define OWN_L9_SCAN_KERNEL(width)                                                                              \
+OWN_QPLC_INLINE(__m256i, own_l9_scan_##width##u_kernel, (__m256i srcmm,                                       \
+                                                         __m256i low_mm,                                      \
+                                                         __m256i high_mm,                                     \
+                                                         own_l9_scan_flavor_t flavor)) {                      \
+    const __m256i ones = _mm256_set1_epi32(-1);                                                                \
+    switch (flavor) {                                                                                          \
+        case own_l9_scan_eq:                                                                                   \
+            return _mm256_cmpeq_epi##width(srcmm, low_mm);                                                     \
+        case own_l9_scan_ne:                                                                                   \
+            return _mm256_xor_si256(_mm256_cmpeq_epi##width(srcmm, low_mm), ones);                             \
+        case own_l9_scan_lt:                                                                                   \
+            return _mm256_xor_si256(_mm256_cmpeq_epi##width(_mm256_max_epu##width(srcmm, low_mm), srcmm), ones); \
+        case own_l9_scan_le:                                                                                   \
+            return _mm256_cmpeq_epi##width(_mm256_min_epu##width(srcmm, low_mm), srcmm);                       \
+        case own_l9_scan_gt:                                                                                   \
+            return _mm256_xor_si256(_mm256_cmpeq_epi##width(_mm256_min_epu##width(srcmm, low_mm), srcmm), ones); \
+        case own_l9_scan_ge:                                                                                   \
+            return _mm256_cmpeq_epi##width(_mm256_max_epu##width(srcmm, low_mm), srcmm);                       \
+        case own_l9_scan_range:                                                                                \
+            return _mm256_and_si256(_mm256_cmpeq_epi##width(_mm256_max_epu##width(srcmm, low_mm), srcmm),     \
+                                    _mm256_cmpeq_epi##width(_mm256_min_epu##width(srcmm, high_mm), srcmm));    \
+        default:                                                                                               \
+            return _mm256_xor_si256(_mm256_and_si256(                                                          \
+                                    _mm256_cmpeq_epi##width(_mm256_max_epu##width(srcmm, low_mm), srcmm),     \
+                                    _mm256_cmpeq_epi##width(_mm256_min_epu##width(srcmm, high_mm), srcmm)),   \
+                                    ones);                                                                     \
+    }                                                                                                          \
+}
+
+OWN_L9_SCAN_KERNEL(8)
+OWN_L9_SCAN_KERNEL(16)
+OWN_L9_SCAN_KERNEL(32)
+
+#undef OWN_L9_SCAN_KERNEL
+
+// ------ Loops over 32 elements per iteration, all-ones lanes are narrowed to 0/1 bytes ------
+
+OWN_QPLC_INLINE(void, own_l9_scan_8u, (const uint8_t *src_ptr,
+                                       uint8_t *dst_ptr,
+                                       uint32_t length,
+                                       uint32_t low_value,
+                                       uint32_t high_value,
+                                       own_l9_scan_flavor_t flavor)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  low_mm   = _mm256_set1_epi8((char) low_value);
+    const __m256i  high_mm  = _mm256_set1_epi8((char) high_value);
+    const __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0u; i < length32; i += 32u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + i));
+        __m256i dstmm = own_l9_scan_8u_kernel(srcmm, low_mm, high_mm, flavor);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + i), _mm256_and_si256(dstmm, one_mm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_ptr[idx], low_value, high_value, flavor);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_16u8u, (const uint8_t *src_ptr,
+                                          uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_flavor_t flavor)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const uint32_t length32     = length & (-32);
+    const __m256i  low_mm       = _mm256_set1_epi16((short) low_value);
+    const __m256i  high_mm      = _mm256_set1_epi16((short) high_value);
+    const __m256i  one_mm       = _mm256_set1_epi8(1);
+
+    // Source buffer may be the destination one (in-place scan), so both loads happen before the store
+    for (uint32_t i = 0u; i < length32; i += 32u) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + i));
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + i + 16u));
+        __m256i mask0  = own_l9_scan_16u_kernel(srcmm0, low_mm, high_mm, flavor);
+        __m256i mask1  = own_l9_scan_16u_kernel(srcmm1, low_mm, high_mm, flavor);
+        __m256i dstmm  = _mm256_permute4x64_epi64(_mm256_packs_epi16(mask0, mask1), 0xD8);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + i), _mm256_and_si256(dstmm, one_mm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_16u_ptr[idx], low_value, high_value, flavor);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_32u8u, (const uint8_t *src_ptr,
+                                          uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_flavor_t flavor)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const uint32_t length32     = length & (-32);
+    const __m256i  low_mm       = _mm256_set1_epi32((int) low_value);
+    const __m256i  high_mm      = _mm256_set1_epi32((int) high_value);
+    const __m256i  one_mm       = _mm256_set1_epi8(1);
+    const __m256i  permute_idx  = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (uint32_t i = 0u; i < length32; i += 32u) {
+        __m256i mask0 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + i)),
+                                               low_mm, high_mm, flavor);
+        __m256i mask1 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + i + 8u)),
+                                               low_mm, high_mm, flavor);
+        __m256i mask2 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + i + 16u)),
+                                               low_mm, high_mm, flavor);
+        __m256i mask3 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + i + 24u)),
+                                               low_mm, high_mm, flavor);
+
+        __m256i dstmm = _mm256_packs_epi16(_mm256_packs_epi32(mask0, mask1), _mm256_packs_epi32(mask2, mask3));
+        dstmm = _mm256_permutevar8x32_epi32(dstmm, permute_idx);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + i), _mm256_and_si256(dstmm, one_mm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_32u_ptr[idx], low_value, high_value, flavor);
+    }
+}
+
+// ------ EQ ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq);
+}
+
+// ------ NE ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ne);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ne);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ne);
+}
+
+// ------ LT ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_lt);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_lt);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_lt);
+}
+
+// ------ LE ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le);
+}
+
+// ------ GT ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_gt);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_gt);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_gt);
+}
+
+// ------ GE ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge);
+}
+
+// ------ RANGE ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range);
+}
+
+// ------ NOT RANGE ------
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_not_range);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_not_range);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_not_range);
+}
+
+#endif // SCAN_L9_OPT_H
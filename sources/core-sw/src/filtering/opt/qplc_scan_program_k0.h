@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of functions for scan program analytics operation
+ * @date 10/17/2026
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_scan_program_8u
+ *          - @ref k0_qplc_scan_program_16u8u
+ *          - @ref k0_qplc_scan_program_32u8u
+ *
+ * Elements are processed by 64, every comparison of the program produces a 64-bit mask that is pushed
+ * onto the stack of masks, and/or/not are performed on the masks. Only the final mask is expanded to bytes.
+ * Functions return the number of processed elements, the rest is left to the scalar implementation.
+ * Programs with unknown opcodes are not processed at all.
+ */
+
+#ifndef OWN_SCAN_PROGRAM_K0_H
+#define OWN_SCAN_PROGRAM_K0_H
+
+#include "own_qplc_defs.h"
+#include "own_scan_intrin.h"
+
+OWN_QPLC_INLINE(__mmask64, own_k0_scan_compare_8u, (__m512i srcmm,
+        uint32_t opcode,
+        __m512i low_value,
+        __m512i high_value)) {
+    switch (opcode) {
+        case qplc_scan_program_eq: return own_scan_EQ_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_ne: return own_scan_NE_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_lt: return own_scan_LT_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_le: return own_scan_LE_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_gt: return own_scan_GT_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_ge: return own_scan_GE_8u_kernel(srcmm, low_value);
+        case qplc_scan_program_range: return own_scan_REQ_8u_kernel(srcmm, low_value, high_value);
+        case qplc_scan_program_not_range: return own_scan_RNE_8u_kernel(srcmm, low_value, high_value);
+        default: return 0u; // Unreachable, the program is checked with own_k0_scan_program_is_supported
+    }
+}
+
+OWN_QPLC_INLINE(__mmask32, own_k0_scan_compare_16u, (__m512i srcmm,
+        uint32_t opcode,
+        __m512i low_value,
+        __m512i high_value)) {
+    switch (opcode) {
+        case qplc_scan_program_eq: return own_scan_EQ_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_ne: return own_scan_NE_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_lt: return own_scan_LT_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_le: return own_scan_LE_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_gt: return own_scan_GT_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_ge: return own_scan_GE_16u_kernel(srcmm, low_value);
+        case qplc_scan_program_range: return own_scan_REQ_16u_kernel(srcmm, low_value, high_value);
+        case qplc_scan_program_not_range: return own_scan_RNE_16u_kernel(srcmm, low_value, high_value);
+        default: return 0u; // Unreachable, the program is checked with own_k0_scan_program_is_supported
+    }
+}
+
+OWN_QPLC_INLINE(__mmask16, own_k0_scan_compare_32u, (__m512i srcmm,
+        uint32_t opcode,
+        __m512i low_value,
+        __m512i high_value)) {
+    switch (opcode) {
+        case qplc_scan_program_eq: return own_scan_EQ_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_ne: return own_scan_NE_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_lt: return own_scan_LT_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_le: return own_scan_LE_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_gt: return own_scan_GT_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_ge: return own_scan_GE_32u_kernel(srcmm, low_value);
+        case qplc_scan_program_range: return own_scan_REQ_32u_kernel(srcmm, low_value, high_value);
+        case qplc_scan_program_not_range: return own_scan_RNE_32u_kernel(srcmm, low_value, high_value);
+        default: return 0u; // Unreachable, the program is checked with own_k0_scan_program_is_supported
+    }
+}
+
+/**
+ * @brief Performs and/or/not on the topmost masks of the stack, returns the new stack depth
+ */
+OWN_QPLC_INLINE(uint32_t, own_k0_scan_combine, (__mmask64 *stack_ptr, uint32_t depth, uint32_t opcode)) {
+    switch (opcode) {
+        case qplc_scan_program_and: {
+            stack_ptr[depth - 2u] &= stack_ptr[depth - 1u];
+            return depth - 1u;
+        }
+        case qplc_scan_program_or: {
+            stack_ptr[depth - 2u] |= stack_ptr[depth - 1u];
+            return depth - 1u;
+        }
+        case qplc_scan_program_not: {
+            stack_ptr[depth - 1u] = ~stack_ptr[depth - 1u];
+            return depth;
+        }
+        default: {
+            return depth;
+        }
+    }
+}
+
+/**
+ * @brief Checks that every opcode of the program is known, otherwise the program is left to the scalar
+ *        implementation that reports the error
+ */
+OWN_QPLC_INLINE(uint32_t, own_k0_scan_program_is_supported, (const qplc_scan_program_t *program_ptr)) {
+    for (uint32_t i = 0u; i < program_ptr->size; i++) {
+        if (program_ptr->instructions[i].opcode > qplc_scan_program_not) {
+            return 0u;
+        }
+    }
+
+    return 1u;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_program_8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    const uint32_t length64 = length & (-64);
+    __m512i        low_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __m512i        high_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __mmask64      stack[QPLC_SCAN_PROGRAM_MAX_DEPTH];
+
+    if (!own_k0_scan_program_is_supported(program_ptr)) {
+        return 0u;
+    }
+
+    for (uint32_t i = 0u; i < program_ptr->size; i++) {
+        low_values[i]  = _mm512_set1_epi8((char) program_ptr->instructions[i].low_value);
+        high_values[i] = _mm512_set1_epi8((char) program_ptr->instructions[i].high_value);
+    }
+
+    for (uint32_t idx = 0u; idx < length64; idx += 64u) {
+        const __m512i srcmm = _mm512_loadu_si512(src_ptr + idx);
+        uint32_t      depth = 0u;
+
+        for (uint32_t i = 0u; i < program_ptr->size; i++) {
+            const uint32_t opcode = program_ptr->instructions[i].opcode;
+
+            if (opcode > qplc_scan_program_not_range) {
+                depth = own_k0_scan_combine(stack, depth, opcode);
+            } else {
+                stack[depth++] = own_k0_scan_compare_8u(srcmm, opcode, low_values[i], high_values[i]);
+            }
+        }
+
+        _mm512_storeu_si512(dst_ptr + idx, _mm512_maskz_set1_epi8(stack[0], 1));
+    }
+
+    return length64;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_program_16u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    const uint32_t length64 = length & (-64);
+    __m512i        low_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __m512i        high_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __mmask64      stack[QPLC_SCAN_PROGRAM_MAX_DEPTH];
+
+    if (!own_k0_scan_program_is_supported(program_ptr)) {
+        return 0u;
+    }
+
+    for (uint32_t i = 0u; i < program_ptr->size; i++) {
+        low_values[i]  = _mm512_set1_epi16((short) program_ptr->instructions[i].low_value);
+        high_values[i] = _mm512_set1_epi16((short) program_ptr->instructions[i].high_value);
+    }
+
+    for (uint32_t idx = 0u; idx < length64; idx += 64u) {
+        // Both vectors are loaded before the store, so the kernel can be performed in-place
+        const __m512i srcmm0 = _mm512_loadu_si512(src_ptr + idx * sizeof(uint16_t));
+        const __m512i srcmm1 = _mm512_loadu_si512(src_ptr + idx * sizeof(uint16_t) + 64u);
+        uint32_t      depth  = 0u;
+
+        for (uint32_t i = 0u; i < program_ptr->size; i++) {
+            const uint32_t opcode = program_ptr->instructions[i].opcode;
+
+            if (opcode > qplc_scan_program_not_range) {
+                depth = own_k0_scan_combine(stack, depth, opcode);
+            } else {
+                __mmask32 mask0 = own_k0_scan_compare_16u(srcmm0, opcode, low_values[i], high_values[i]);
+                __mmask32 mask1 = own_k0_scan_compare_16u(srcmm1, opcode, low_values[i], high_values[i]);
+
+                stack[depth++] = _mm512_kunpackd((__mmask64) mask1, (__mmask64) mask0);
+            }
+        }
+
+        _mm512_storeu_si512(dst_ptr + idx, _mm512_maskz_set1_epi8(stack[0], 1));
+    }
+
+    return length64;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_program_32u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    const uint32_t length64 = length & (-64);
+    __m512i        low_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __m512i        high_values[QPLC_SCAN_PROGRAM_MAX_SIZE];
+    __mmask64      stack[QPLC_SCAN_PROGRAM_MAX_DEPTH];
+
+    if (!own_k0_scan_program_is_supported(program_ptr)) {
+        return 0u;
+    }
+
+    for (uint32_t i = 0u; i < program_ptr->size; i++) {
+        low_values[i]  = _mm512_set1_epi32((int) program_ptr->instructions[i].low_value);
+        high_values[i] = _mm512_set1_epi32((int) program_ptr->instructions[i].high_value);
+    }
+
+    for (uint32_t idx = 0u; idx < length64; idx += 64u) {
+        // All vectors are loaded before the store, so the kernel can be performed in-place
+        const uint8_t *block_ptr = src_ptr + idx * sizeof(uint32_t);
+        const __m512i srcmm0     = _mm512_loadu_si512(block_ptr);
+        const __m512i srcmm1     = _mm512_loadu_si512(block_ptr + 64u);
+        const __m512i srcmm2     = _mm512_loadu_si512(block_ptr + 128u);
+        const __m512i srcmm3     = _mm512_loadu_si512(block_ptr + 192u);
+        uint32_t      depth      = 0u;
+
+        for (uint32_t i = 0u; i < program_ptr->size; i++) {
+            const uint32_t opcode = program_ptr->instructions[i].opcode;
+
+            if (opcode > qplc_scan_program_not_range) {
+                depth = own_k0_scan_combine(stack, depth, opcode);
+            } else {
+                __mmask16 mask0 = own_k0_scan_compare_32u(srcmm0, opcode, low_values[i], high_values[i]);
+                __mmask16 mask1 = own_k0_scan_compare_32u(srcmm1, opcode, low_values[i], high_values[i]);
+                __mmask16 mask2 = own_k0_scan_compare_32u(srcmm2, opcode, low_values[i], high_values[i]);
+                __mmask16 mask3 = own_k0_scan_compare_32u(srcmm3, opcode, low_values[i], high_values[i]);
+
+                __mmask32 mask01 = _mm512_kunpackw((__mmask32) mask1, (__mmask32) mask0);
+                __mmask32 mask23 = _mm512_kunpackw((__mmask32) mask3, (__mmask32) mask2);
+
+                stack[depth++] = _mm512_kunpackd((__mmask64) mask23, (__mmask64) mask01);
+            }
+        }
+
+        _mm512_storeu_si512(dst_ptr + idx, _mm512_maskz_set1_epi8(stack[0], 1));
+    }
+
+    return length64;
+}
+
+#endif // OWN_SCAN_PROGRAM_K0_H
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for unpacking 1..8-bit data to bytes
+ * @date 10/16/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_unpack_1u8u
+ *
+ */
+
+#ifndef OWN_UNPACK_8U_L9_H
+#define OWN_UNPACK_8U_L9_H
+
+#include "own_qplc_defs.h"
+
+// ********************** 1u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_unpack_1u8u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+    // Align to byte boundary
+    if (0u < start_bit) {
+        uint8_t mask = OWN_1_BIT_MASK << start_bit;
+        while (0u < mask) {
+            *dst_ptr = (0u < (*src_ptr & mask)) ? 1u : 0u;
+            dst_ptr++;
+            mask = mask << 1u;
+            num_elements--;
+            if (0u == num_elements) {
+                return;
+            }
+        }
+        src_ptr++;
+    }
+
+    // Every 128-bit lane holds the whole 32-bit source word, the shuffle spreads
+    // byte 0..1 over the low lane and byte 2..3 over the high lane
+    const __m256i shuffle_idx = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                                 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bit_mask    = _mm256_set1_epi64x((int64_t) 0x8040201008040201LLU);
+    const __m256i one_mm      = _mm256_set1_epi8(1);
+
+    while (num_elements >= 32u) {
+        __m256i srcmm = _mm256_set1_epi32(*(const int32_t *) src_ptr);
+        srcmm = _mm256_shuffle_epi8(srcmm, shuffle_idx);
+        srcmm = _mm256_cmpeq_epi8(_mm256_and_si256(srcmm, bit_mask), bit_mask);
+        _mm256_storeu_si256((__m256i *) dst_ptr, _mm256_and_si256(srcmm, one_mm));
+
+        src_ptr += sizeof(uint32_t);
+        dst_ptr += 32u;
+        num_elements -= 32u;
+    }
+
+    for (uint32_t i = 0u; i < num_elements; i++) {
+        dst_ptr[i] = (src_ptr[i >> 3u] >> (i & OWN_BYTE_BIT_MASK)) & OWN_1_BIT_MASK;
+    }
+}
+
+#endif // OWN_UNPACK_8U_L9_H
@@ -21,6 +21,10 @@
 
 #include "opt/qplc_aggregates_k0.h"
 
+#elif PLATFORM >= L9
+
+#include "opt/qplc_aggregates_l9.h"
+
 #endif
 
 
@@ -28,10 +32,12 @@ OWN_QPLC_FUN(void, qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *index_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_bit_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_bit_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
 #else
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -48,10 +54,12 @@ OWN_QPLC_FUN(void, qplc_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -65,10 +73,12 @@ OWN_QPLC_FUN(void, qplc_aggregates_16u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_16u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_16u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     const uint16_t *src_16u_ptr = (uint16_t *) src_ptr;
 
@@ -84,10 +94,12 @@ OWN_QPLC_FUN(void, qplc_aggregates_32u, (const uint8_t *src_ptr,
         uint32_t length,
         uint32_t *min_value_ptr,
         uint32_t *max_value_ptr,
-        uint32_t *sum_ptr,
+        uint64_t *sum_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_32u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_32u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     const uint32_t *src_32u_ptr = (uint32_t *) src_ptr;
 
@@ -25,6 +25,8 @@
 
 #if PLATFORM >= K0
 #include "opt/qplc_pack_8u_k0.h"
+#elif PLATFORM >= L9
+#include "opt/qplc_pack_8u_l9.h"
 #endif
 
 // ********************** 1u ****************************** //
@@ -36,6 +38,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u1u, (const uint8_t *src_ptr,
 
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u1u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_pack_8u1u)(src_ptr, num_elements, dst_ptr, start_bit);
 #else
     uint32_t i;
 
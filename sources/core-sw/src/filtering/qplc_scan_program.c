@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for scan program analytics operation
+ * @date 10/17/2026
+ *
+ * @details Function list:
+ *          - @ref qplc_scan_program_8u
+ *          - @ref qplc_scan_program_16u8u
+ *          - @ref qplc_scan_program_32u8u
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_scan.h"
+
+#define OWN_SCAN_PROGRAM_BLOCK_SIZE 64u /**< Number of elements each instruction is applied to at once */
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_scan_program_k0.h"
+
+#endif
+
+/**
+ * @brief Evaluates the program for a block of widened elements, each instruction is applied to the whole block
+ */
+OWN_QPLC_INLINE(qplc_status_t, own_scan_program_block, (const uint32_t *values_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    uint8_t  stack[QPLC_SCAN_PROGRAM_MAX_DEPTH][OWN_SCAN_PROGRAM_BLOCK_SIZE];
+    uint32_t depth = 0u;
+
+    for (uint32_t i = 0u; i < program_ptr->size; i++) {
+        const qplc_scan_instruction_t *instruction_ptr = &program_ptr->instructions[i];
+        const uint32_t                low_value        = instruction_ptr->low_value;
+        const uint32_t                high_value       = instruction_ptr->high_value;
+
+        uint8_t *top_ptr = stack[depth];
+
+        switch (instruction_ptr->opcode) {
+            case qplc_scan_program_eq: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] == low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_ne: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] != low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_lt: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] < low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_le: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] <= low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_gt: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] > low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_ge: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = (values_ptr[idx] >= low_value) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_range: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = ((values_ptr[idx] >= low_value) && (values_ptr[idx] <= high_value)) ? 1u : 0u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_not_range: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    top_ptr[idx] = ((values_ptr[idx] >= low_value) && (values_ptr[idx] <= high_value)) ? 0u : 1u;
+                }
+                depth++;
+                break;
+            }
+            case qplc_scan_program_and: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    stack[depth - 2u][idx] &= stack[depth - 1u][idx];
+                }
+                depth--;
+                break;
+            }
+            case qplc_scan_program_or: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    stack[depth - 2u][idx] |= stack[depth - 1u][idx];
+                }
+                depth--;
+                break;
+            }
+            case qplc_scan_program_not: {
+                for (uint32_t idx = 0u; idx < length; idx++) {
+                    stack[depth - 1u][idx] ^= 1u;
+                }
+                break;
+            }
+            default: {
+                return QPLC_STS_INVALID_PARAM_ERR;
+            }
+        }
+    }
+
+    for (uint32_t idx = 0u; idx < length; idx++) {
+        dst_ptr[idx] = stack[0][idx];
+    }
+
+    return QPLC_STS_OK;
+}
+
+/**
+ * @brief Evaluates the program for the elements that are left after the optimized implementation
+ *
+ * @note Each block is loaded before its results are stored, so the function can be performed in-place
+ */
+OWN_QPLC_INLINE(qplc_status_t, own_scan_program, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        uint32_t element_size,
+        const qplc_scan_program_t *program_ptr)) {
+    uint32_t values[OWN_SCAN_PROGRAM_BLOCK_SIZE];
+
+    for (uint32_t block_start = 0u; block_start < length; block_start += OWN_SCAN_PROGRAM_BLOCK_SIZE) {
+        const uint32_t block_length = OWN_MIN(OWN_SCAN_PROGRAM_BLOCK_SIZE, length - block_start);
+        const uint8_t  *block_ptr   = src_ptr + block_start * element_size;
+
+        if (sizeof(uint8_t) == element_size) {
+            for (uint32_t idx = 0u; idx < block_length; idx++) {
+                values[idx] = block_ptr[idx];
+            }
+        } else if (sizeof(uint16_t) == element_size) {
+            for (uint32_t idx = 0u; idx < block_length; idx++) {
+                values[idx] = ((const uint16_t *) block_ptr)[idx];
+            }
+        } else {
+            for (uint32_t idx = 0u; idx < block_length; idx++) {
+                values[idx] = ((const uint32_t *) block_ptr)[idx];
+            }
+        }
+
+        const qplc_status_t status = own_scan_program_block(values,
+                                                            dst_ptr + block_start,
+                                                            block_length,
+                                                            program_ptr);
+
+        if (QPLC_STS_OK != status) {
+            return status;
+        }
+    }
+
+    return QPLC_STS_OK;
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_scan_program_8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    uint32_t processed = 0u;
+
+#if PLATFORM >= K0
+    processed = CALL_OPT_FUNCTION(k0_qplc_scan_program_8u)(src_ptr, dst_ptr, length, program_ptr);
+#endif
+
+    return own_scan_program(src_ptr + processed,
+                            dst_ptr + processed,
+                            length - processed,
+                            sizeof(uint8_t),
+                            program_ptr);
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_scan_program_16u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    uint32_t processed = 0u;
+
+#if PLATFORM >= K0
+    processed = CALL_OPT_FUNCTION(k0_qplc_scan_program_16u8u)(src_ptr, dst_ptr, length, program_ptr);
+#endif
+
+    return own_scan_program(src_ptr + processed * sizeof(uint16_t),
+                            dst_ptr + processed,
+                            length - processed,
+                            sizeof(uint16_t),
+                            program_ptr);
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_scan_program_32u8u, (const uint8_t *src_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length,
+        const qplc_scan_program_t *program_ptr)) {
+    uint32_t processed = 0u;
+
+#if PLATFORM >= K0
+    processed = CALL_OPT_FUNCTION(k0_qplc_scan_program_32u8u)(src_ptr, dst_ptr, length, program_ptr);
+#endif
+
+    return own_scan_program(src_ptr + processed * sizeof(uint32_t),
+                            dst_ptr + processed,
+                            length - processed,
+                            sizeof(uint32_t),
+                            program_ptr);
+}
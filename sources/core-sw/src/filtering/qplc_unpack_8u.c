@@ -28,6 +28,10 @@
 
 #include "opt/qplc_unpack_8u_k0.h"
 
+#elif PLATFORM >= L9
+
+#include "opt/qplc_unpack_8u_l9.h"
+
 #endif
 
 // ********************** 1u ****************************** //
@@ -38,6 +42,8 @@ OWN_QPLC_FUN(void, qplc_unpack_1u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_1u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_1u8u)(src_ptr, num_elements, start_bit, dst_ptr);
 #else
     uint64_t bit_mask = 0x0101010101010101LLU;
     uint32_t i;
@@ -61,6 +61,16 @@ extern "C" {
 
 #define OWN_ALIGNED_64_ARRAY(array_declaration) OWN_ALIGNED_ARRAY(array_declaration, 64u)
 
+/**
+ * @brief Enables VPCLMULQDQ instructions for a function of the avx512 build,
+ *        the caller is responsible for checking the CPU support
+ */
+#if defined(__GNUC__)
+#define OWN_VPCLMULQDQ_TARGET __attribute__((target("vpclmulqdq")))
+#else
+#define OWN_VPCLMULQDQ_TARGET
+#endif
+
 #define QPL_MAX(a, b) (((a) > (b)) ? (a) : (b))    /**< Simple minimal value idiom */
 #define QPL_MIN(a, b) (((a) < (b)) ? (a) : (b))    /**< Simple maximal value idiom */
 
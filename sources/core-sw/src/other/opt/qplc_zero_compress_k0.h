@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX512 implementation of functions for zero compress and zero decompress operations
+  * @date 10/17/2026
+  *
+  * @details Function list:
+  *          - @ref k0_qplc_zero_compress_16u
+  *          - @ref k0_qplc_zero_compress_32u
+  *          - @ref k0_qplc_zero_decompress_16u
+  *          - @ref k0_qplc_zero_decompress_32u
+  *
+  * Only whole blocks that fit into the destination are processed, the rest is left to the scalar implementation.
+  * Compress and expand are done in registers followed by a full vector store, because the memory forms
+  * of vpcompress/vpexpand are microcoded on some CPUs.
+  */
+#ifndef OWN_ZERO_COMPRESS_K0_H
+#define OWN_ZERO_COMPRESS_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+// ********************** 16u ****************************** //
+
+// Compresses 16 words widened to 32 bits, stores 32 bytes and returns the number of bytes stored
+OWN_QPLC_INLINE(uint32_t, own_k0_compress_store_16u, (uint8_t *dst_ptr, __m256i words, __mmask16 mask)) {
+    __m512i compressed = _mm512_maskz_compress_epi32(mask, _mm512_cvtepu16_epi32(words));
+
+    _mm256_storeu_si256((__m256i *) dst_ptr, _mm512_cvtepi32_epi16(compressed));
+
+    return (uint32_t) _mm_popcnt_u32(mask) * sizeof(uint16_t);
+}
+
+OWN_QPLC_INLINE(__m256i, own_k0_expand_load_16u, (const uint8_t *src_ptr, __mmask16 mask)) {
+    const uint32_t length = (uint32_t) _mm_popcnt_u32(mask);
+    __m256i        words  = _mm256_maskz_loadu_epi16((__mmask16) ((1u << length) - 1u), src_ptr);
+
+    return _mm512_cvtepi32_epi16(_mm512_maskz_expand_epi32(mask, _mm512_cvtepu16_epi32(words)));
+}
+
+OWN_OPT_FUN(void, k0_qplc_zero_compress_16u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint16_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= block_size &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= OWN_ZERO_TAG_SIZE + block_size) {
+        __m512i   words = _mm512_loadu_si512((const void *) src_ptr);
+        __mmask32 tag   = _mm512_test_epi16_mask(words, words);
+
+        *(uint32_t *) dst_ptr = (uint32_t) tag;
+        dst_ptr += OWN_ZERO_TAG_SIZE;
+
+        dst_ptr += own_k0_compress_store_16u(dst_ptr, _mm512_castsi512_si256(words), (__mmask16) tag);
+        dst_ptr += own_k0_compress_store_16u(dst_ptr, _mm512_extracti64x4_epi64(words, 1), (__mmask16) (tag >> 16u));
+
+        src_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+OWN_OPT_FUN(void, k0_qplc_zero_decompress_16u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint16_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= OWN_ZERO_TAG_SIZE &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= block_size) {
+        const uint32_t  tag      = *(const uint32_t *) src_ptr;
+        const __mmask16 low_mask = (__mmask16) tag;
+        const uint32_t  low_size = (uint32_t) _mm_popcnt_u32(low_mask) * sizeof(uint16_t);
+
+        if ((uint32_t) (src_end_ptr - src_ptr) < OWN_ZERO_TAG_SIZE + (uint32_t) _mm_popcnt_u32(tag) * sizeof(uint16_t)) {
+            break;
+        }
+
+        src_ptr += OWN_ZERO_TAG_SIZE;
+        _mm256_storeu_si256((__m256i *) dst_ptr, own_k0_expand_load_16u(src_ptr, low_mask));
+        src_ptr += low_size;
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 32u), own_k0_expand_load_16u(src_ptr, (__mmask16) (tag >> 16u)));
+        src_ptr += (uint32_t) _mm_popcnt_u32(tag >> 16u) * sizeof(uint16_t);
+
+        dst_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+// ********************** 32u ****************************** //
+
+OWN_OPT_FUN(void, k0_qplc_zero_compress_32u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint32_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= block_size &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= OWN_ZERO_TAG_SIZE + block_size) {
+        __m512i   low_words  = _mm512_loadu_si512((const void *) src_ptr);
+        __m512i   high_words = _mm512_loadu_si512((const void *) (src_ptr + 64u));
+        __mmask16 low_mask   = _mm512_test_epi32_mask(low_words, low_words);
+        __mmask16 high_mask  = _mm512_test_epi32_mask(high_words, high_words);
+
+        *(uint32_t *) dst_ptr = (uint32_t) low_mask | ((uint32_t) high_mask << 16u);
+        dst_ptr += OWN_ZERO_TAG_SIZE;
+
+        _mm512_storeu_si512((void *) dst_ptr, _mm512_maskz_compress_epi32(low_mask, low_words));
+        dst_ptr += (uint32_t) _mm_popcnt_u32(low_mask) * sizeof(uint32_t);
+        _mm512_storeu_si512((void *) dst_ptr, _mm512_maskz_compress_epi32(high_mask, high_words));
+        dst_ptr += (uint32_t) _mm_popcnt_u32(high_mask) * sizeof(uint32_t);
+
+        src_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+OWN_QPLC_INLINE(__m512i, own_k0_expand_load_32u, (const uint8_t *src_ptr, __mmask16 mask)) {
+    const uint32_t length = (uint32_t) _mm_popcnt_u32(mask);
+    __m512i        words  = _mm512_maskz_loadu_epi32((__mmask16) ((1u << length) - 1u), src_ptr);
+
+    return _mm512_maskz_expand_epi32(mask, words);
+}
+
+OWN_OPT_FUN(void, k0_qplc_zero_decompress_32u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint32_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= OWN_ZERO_TAG_SIZE &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= block_size) {
+        const uint32_t  tag      = *(const uint32_t *) src_ptr;
+        const __mmask16 low_mask = (__mmask16) tag;
+
+        if ((uint32_t) (src_end_ptr - src_ptr) < OWN_ZERO_TAG_SIZE + (uint32_t) _mm_popcnt_u32(tag) * sizeof(uint32_t)) {
+            break;
+        }
+
+        src_ptr += OWN_ZERO_TAG_SIZE;
+        _mm512_storeu_si512((void *) dst_ptr, own_k0_expand_load_32u(src_ptr, low_mask));
+        src_ptr += (uint32_t) _mm_popcnt_u32(low_mask) * sizeof(uint32_t);
+        _mm512_storeu_si512((void *) (dst_ptr + 64u), own_k0_expand_load_32u(src_ptr, (__mmask16) (tag >> 16u)));
+        src_ptr += (uint32_t) _mm_popcnt_u32(tag >> 16u) * sizeof(uint32_t);
+
+        dst_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+#endif // OWN_ZERO_COMPRESS_K0_H
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for zero compress and zero decompress operations
+  * @date 10/17/2026
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_zero_compress_16u
+  *          - @ref l9_qplc_zero_compress_32u
+  *          - @ref l9_qplc_zero_decompress_16u
+  *          - @ref l9_qplc_zero_decompress_32u
+  *
+  * Words are processed by groups of 8, the permutation for a group is built from its bitmap with BMI2.
+  * Only whole blocks are processed and the loads and stores are full vectors, so some slack is required
+  * in the source and the destination, the rest is left to the scalar implementation.
+  */
+#ifndef OWN_ZERO_COMPRESS_L9_H
+#define OWN_ZERO_COMPRESS_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_L9_GROUP_WORDS 8u /**< Number of words processed by one permutation */
+
+// Byte mask with 0xFF for every set bit of the group bitmap
+OWN_QPLC_INLINE(uint64_t, own_l9_expand_bitmap, (uint32_t bitmap)) {
+    return _pdep_u64(bitmap, 0x0101010101010101ULL) * 0xFFu;
+}
+
+// Permutation that moves the selected lanes to the beginning of the vector
+OWN_QPLC_INLINE(__m256i, own_l9_compress_permutation, (uint32_t bitmap)) {
+    const uint64_t indices = _pext_u64(0x0706050403020100ULL, own_l9_expand_bitmap(bitmap));
+
+    return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) indices));
+}
+
+// Moves the leading lanes to the selected lanes, the other lanes are zeroed
+OWN_QPLC_INLINE(__m256i, own_l9_expand_epi32, (__m256i words, uint32_t bitmap)) {
+    const uint64_t byte_mask = own_l9_expand_bitmap(bitmap);
+    const uint64_t indices   = _pdep_u64(0x0706050403020100ULL, byte_mask);
+
+    __m256i permuted = _mm256_permutevar8x32_epi32(words, _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) indices)));
+
+    return _mm256_and_si256(permuted, _mm256_cvtepi8_epi32(_mm_cvtsi64_si128((long long) byte_mask)));
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_nonzero_bitmap_epi32, (__m256i words)) {
+    __m256i is_zero = _mm256_cmpeq_epi32(words, _mm256_setzero_si256());
+
+    return ~(uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(is_zero)) & 0xFFu;
+}
+
+OWN_QPLC_INLINE(__m128i, own_l9_narrow_epi32, (__m256i words)) {
+    return _mm_packus_epi32(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+}
+
+// ********************** 16u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_zero_compress_16u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint16_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= block_size &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= OWN_ZERO_TAG_SIZE + block_size) {
+        uint8_t  *tag_ptr = dst_ptr;
+        uint32_t  tag     = 0u;
+
+        dst_ptr += OWN_ZERO_TAG_SIZE;
+
+        for (uint32_t group = 0u; group < QPLC_ZERO_COMPRESS_BLOCK_WORDS; group += OWN_L9_GROUP_WORDS) {
+            __m256i  words  = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) (src_ptr + group * sizeof(uint16_t))));
+            uint32_t bitmap = own_l9_nonzero_bitmap_epi32(words);
+
+            words = _mm256_permutevar8x32_epi32(words, own_l9_compress_permutation(bitmap));
+            _mm_storeu_si128((__m128i *) dst_ptr, own_l9_narrow_epi32(words));
+
+            dst_ptr += (uint32_t) _mm_popcnt_u32(bitmap) * sizeof(uint16_t);
+            tag     |= bitmap << group;
+        }
+
+        *(uint32_t *) tag_ptr = tag;
+        src_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+OWN_OPT_FUN(void, l9_qplc_zero_decompress_16u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint16_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= OWN_ZERO_TAG_SIZE &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= block_size) {
+        const uint32_t tag = *(const uint32_t *) src_ptr;
+
+        // The last group is loaded as a whole vector
+        if ((uint32_t) (src_end_ptr - src_ptr) < OWN_ZERO_TAG_SIZE + (uint32_t) _mm_popcnt_u32(tag) * sizeof(uint16_t)
+                                                 + sizeof(__m128i)) {
+            break;
+        }
+
+        src_ptr += OWN_ZERO_TAG_SIZE;
+
+        for (uint32_t group = 0u; group < QPLC_ZERO_COMPRESS_BLOCK_WORDS; group += OWN_L9_GROUP_WORDS) {
+            const uint32_t bitmap = (tag >> group) & 0xFFu;
+            __m256i        words  = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) src_ptr));
+
+            _mm_storeu_si128((__m128i *) (dst_ptr + group * sizeof(uint16_t)),
+                             own_l9_narrow_epi32(own_l9_expand_epi32(words, bitmap)));
+            src_ptr += (uint32_t) _mm_popcnt_u32(bitmap) * sizeof(uint16_t);
+        }
+
+        dst_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+// ********************** 32u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_zero_compress_32u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint32_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= block_size &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= OWN_ZERO_TAG_SIZE + block_size) {
+        uint8_t  *tag_ptr = dst_ptr;
+        uint32_t  tag     = 0u;
+
+        dst_ptr += OWN_ZERO_TAG_SIZE;
+
+        for (uint32_t group = 0u; group < QPLC_ZERO_COMPRESS_BLOCK_WORDS; group += OWN_L9_GROUP_WORDS) {
+            __m256i  words  = _mm256_loadu_si256((const __m256i *) (src_ptr + group * sizeof(uint32_t)));
+            uint32_t bitmap = own_l9_nonzero_bitmap_epi32(words);
+
+            _mm256_storeu_si256((__m256i *) dst_ptr,
+                                _mm256_permutevar8x32_epi32(words, own_l9_compress_permutation(bitmap)));
+
+            dst_ptr += (uint32_t) _mm_popcnt_u32(bitmap) * sizeof(uint32_t);
+            tag     |= bitmap << group;
+        }
+
+        *(uint32_t *) tag_ptr = tag;
+        src_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+OWN_OPT_FUN(void, l9_qplc_zero_decompress_32u, (const uint8_t **src_ptr_ptr,
+    const uint8_t *src_end_ptr,
+    uint8_t **dst_ptr_ptr,
+    const uint8_t *dst_end_ptr)) {
+    const uint32_t block_size = QPLC_ZERO_COMPRESS_BLOCK_WORDS * sizeof(uint32_t);
+    const uint8_t *src_ptr    = *src_ptr_ptr;
+    uint8_t       *dst_ptr    = *dst_ptr_ptr;
+
+    while ((uint32_t) (src_end_ptr - src_ptr) >= OWN_ZERO_TAG_SIZE &&
+           (uint32_t) (dst_end_ptr - dst_ptr) >= block_size) {
+        const uint32_t tag = *(const uint32_t *) src_ptr;
+
+        // The last group is loaded as a whole vector
+        if ((uint32_t) (src_end_ptr - src_ptr) < OWN_ZERO_TAG_SIZE + (uint32_t) _mm_popcnt_u32(tag) * sizeof(uint32_t)
+                                                 + sizeof(__m256i)) {
+            break;
+        }
+
+        src_ptr += OWN_ZERO_TAG_SIZE;
+
+        for (uint32_t group = 0u; group < QPLC_ZERO_COMPRESS_BLOCK_WORDS; group += OWN_L9_GROUP_WORDS) {
+            const uint32_t bitmap = (tag >> group) & 0xFFu;
+            __m256i        words  = _mm256_loadu_si256((const __m256i *) src_ptr);
+
+            _mm256_storeu_si256((__m256i *) (dst_ptr + group * sizeof(uint32_t)), own_l9_expand_epi32(words, bitmap));
+            src_ptr += (uint32_t) _mm_popcnt_u32(bitmap) * sizeof(uint32_t);
+        }
+
+        dst_ptr += block_size;
+    }
+
+    *src_ptr_ptr = src_ptr;
+    *dst_ptr_ptr = dst_ptr;
+}
+
+#endif // OWN_ZERO_COMPRESS_L9_H
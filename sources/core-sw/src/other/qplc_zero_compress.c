@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for zero compress and zero decompress operations
+ * @date 10/17/2026
+ *
+ * @details Function list:
+ *          - @ref qplc_zero_compress_16u
+ *          - @ref qplc_zero_compress_32u
+ *          - @ref qplc_zero_decompress_16u
+ *          - @ref qplc_zero_decompress_32u
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_zero_compress.h"
+
+#define OWN_ZERO_TAG_SIZE sizeof(uint32_t) /**< Size of the tag that precedes non-zero words of a block */
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_zero_compress_k0.h"
+
+#elif PLATFORM >= L9
+
+#include "opt/qplc_zero_compress_l9.h"
+
+#endif
+
+OWN_QPLC_INLINE(uint32_t, own_load_word, (const uint8_t *src_ptr, uint32_t word_size)) {
+    return (sizeof(uint16_t) == word_size) ? *(const uint16_t *) src_ptr : *(const uint32_t *) src_ptr;
+}
+
+OWN_QPLC_INLINE(void, own_store_word, (uint8_t *dst_ptr, uint32_t word, uint32_t word_size)) {
+    if (sizeof(uint16_t) == word_size) {
+        *(uint16_t *) dst_ptr = (uint16_t) word;
+    } else {
+        *(uint32_t *) dst_ptr = word;
+    }
+}
+
+/**
+ * @brief Compresses the blocks that are left after the optimized implementation
+ */
+OWN_QPLC_INLINE(qplc_status_t, own_zero_compress, (const uint8_t *src_ptr,
+        const uint8_t *src_end_ptr,
+        uint8_t *dst_ptr,
+        const uint8_t *dst_end_ptr,
+        uint32_t word_size,
+        uint8_t **dst_ptr_ptr)) {
+    while (src_ptr < src_end_ptr) {
+        const uint32_t block_words = OWN_MIN(QPLC_ZERO_COMPRESS_BLOCK_WORDS,
+                                             (uint32_t) (src_end_ptr - src_ptr) / word_size);
+        uint32_t       tag         = 0u;
+
+        if ((uint32_t) (dst_end_ptr - dst_ptr) < OWN_ZERO_TAG_SIZE) {
+            return QPLC_STS_DST_IS_SHORT_ERR;
+        }
+
+        uint8_t *tag_ptr = dst_ptr;
+        dst_ptr += OWN_ZERO_TAG_SIZE;
+
+        for (uint32_t idx = 0u; idx < block_words; idx++) {
+            const uint32_t word = own_load_word(src_ptr + idx * word_size, word_size);
+
+            if (0u != word) {
+                if ((uint32_t) (dst_end_ptr - dst_ptr) < word_size) {
+                    return QPLC_STS_DST_IS_SHORT_ERR;
+                }
+
+                own_store_word(dst_ptr, word, word_size);
+                dst_ptr += word_size;
+                tag |= 1u << idx;
+            }
+        }
+
+        *(uint32_t *) tag_ptr = tag;
+        src_ptr += block_words * word_size;
+    }
+
+    *dst_ptr_ptr = dst_ptr;
+
+    return QPLC_STS_OK;
+}
+
+/**
+ * @brief Decompresses the blocks that are left after the optimized implementation
+ */
+OWN_QPLC_INLINE(qplc_status_t, own_zero_decompress, (const uint8_t *src_ptr,
+        const uint8_t *src_end_ptr,
+        uint8_t *dst_ptr,
+        const uint8_t *dst_end_ptr,
+        uint32_t word_size,
+        uint8_t **dst_ptr_ptr)) {
+    while (src_ptr < src_end_ptr) {
+        if ((uint32_t) (src_end_ptr - src_ptr) < OWN_ZERO_TAG_SIZE) {
+            return QPLC_STS_SRC_IS_SHORT_ERR;
+        }
+
+        const uint32_t tag = *(const uint32_t *) src_ptr;
+        src_ptr += OWN_ZERO_TAG_SIZE;
+
+        // Trailing zero words of the stream may be dropped if they don't fit, non-zero words may not
+        const uint32_t block_words = OWN_MIN(QPLC_ZERO_COMPRESS_BLOCK_WORDS,
+                                             (uint32_t) (dst_end_ptr - dst_ptr) / word_size);
+
+        if (block_words < QPLC_ZERO_COMPRESS_BLOCK_WORDS && 0u != (tag >> block_words)) {
+            return QPLC_STS_DST_IS_SHORT_ERR;
+        }
+
+        for (uint32_t idx = 0u; idx < block_words; idx++) {
+            uint32_t word = 0u;
+
+            if (tag & (1u << idx)) {
+                if ((uint32_t) (src_end_ptr - src_ptr) < word_size) {
+                    return QPLC_STS_SRC_IS_SHORT_ERR;
+                }
+
+                word = own_load_word(src_ptr, word_size);
+                src_ptr += word_size;
+            }
+
+            own_store_word(dst_ptr + idx * word_size, word, word_size);
+        }
+
+        dst_ptr += block_words * word_size;
+    }
+
+    *dst_ptr_ptr = dst_ptr;
+
+    return QPLC_STS_OK;
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_zero_compress_16u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr)) {
+    const uint8_t *src_end_ptr = src_ptr + (src_length & ~(uint32_t) (sizeof(uint16_t) - 1u));
+    const uint8_t *dst_end_ptr = dst_ptr + dst_length;
+    uint8_t       *current_ptr = dst_ptr;
+
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_zero_compress_16u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_zero_compress_16u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#endif
+
+    qplc_status_t status = own_zero_compress(src_ptr, src_end_ptr, current_ptr, dst_end_ptr,
+                                             sizeof(uint16_t), &current_ptr);
+    *output_size_ptr = (uint32_t) (current_ptr - dst_ptr);
+
+    return status;
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_zero_compress_32u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr)) {
+    const uint8_t *src_end_ptr = src_ptr + (src_length & ~(uint32_t) (sizeof(uint32_t) - 1u));
+    const uint8_t *dst_end_ptr = dst_ptr + dst_length;
+    uint8_t       *current_ptr = dst_ptr;
+
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_zero_compress_32u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_zero_compress_32u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#endif
+
+    qplc_status_t status = own_zero_compress(src_ptr, src_end_ptr, current_ptr, dst_end_ptr,
+                                             sizeof(uint32_t), &current_ptr);
+    *output_size_ptr = (uint32_t) (current_ptr - dst_ptr);
+
+    return status;
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_zero_decompress_16u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr)) {
+    const uint8_t *src_end_ptr = src_ptr + src_length;
+    const uint8_t *dst_end_ptr = dst_ptr + dst_length;
+    uint8_t       *current_ptr = dst_ptr;
+
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_zero_decompress_16u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_zero_decompress_16u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#endif
+
+    qplc_status_t status = own_zero_decompress(src_ptr, src_end_ptr, current_ptr, dst_end_ptr,
+                                               sizeof(uint16_t), &current_ptr);
+    *output_size_ptr = (uint32_t) (current_ptr - dst_ptr);
+
+    return status;
+}
+
+OWN_QPLC_FUN(qplc_status_t, qplc_zero_decompress_32u, (const uint8_t *src_ptr,
+        uint32_t src_length,
+        uint8_t *dst_ptr,
+        uint32_t dst_length,
+        uint32_t *output_size_ptr)) {
+    const uint8_t *src_end_ptr = src_ptr + src_length;
+    const uint8_t *dst_end_ptr = dst_ptr + dst_length;
+    uint8_t       *current_ptr = dst_ptr;
+
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_zero_decompress_32u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_zero_decompress_32u)(&src_ptr, src_end_ptr, &current_ptr, dst_end_ptr);
+#endif
+
+    qplc_status_t status = own_zero_decompress(src_ptr, src_end_ptr, current_ptr, dst_end_ptr,
+                                               sizeof(uint32_t), &current_ptr);
+    *output_size_ptr = (uint32_t) (current_ptr - dst_ptr);
+
+    return status;
+}
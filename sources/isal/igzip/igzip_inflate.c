@@ -1544,6 +1544,14 @@ static inline int setup_dynamic_header(struct inflate_state *state)
         return ISAL_INVALID_BLOCK;
 #endif
 
+#if defined(QPL_LIB)
+    /* Save code lengths before the lit/len table is expanded with the extra bits */
+    if (state->code_lengths_ptr) {
+        for (i = 0; i < LIT_LEN + DIST_LEN; i++)
+            state->code_lengths_ptr[i] = lit_and_dist_huff[i].length;
+    }
+#endif
+
 	if (state->hist_bits && state->hist_bits < 15)
 		max_dist = 2 * state->hist_bits;
 
@@ -1995,6 +2003,7 @@ void isal_inflate_init(struct inflate_state *state)
 	state->tmp_out_valid = 0;
 #if defined(QPL_LIB)
     state->decomp_end_proc = DECOMP_STOP_AND_CHECK_FOR_BFINAL_EOB;
+    state->code_lengths_ptr = NULL;
 #endif
 }
 
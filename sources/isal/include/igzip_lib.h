@@ -588,6 +588,12 @@ struct inflate_state {
     * TODO: Delete this flag once indexing is moved to compression stage.
     */
     uint8_t  disable_multisymbol_lookup_table;
+
+    /**
+    * Optional buffer of LIT_LEN + DIST_LEN elements the code lengths of the dynamic header are saved to.
+    * It is used to restore compression Huffman tables from the deflate header.
+    */
+    uint8_t  *code_lengths_ptr;
 #endif
 };
 
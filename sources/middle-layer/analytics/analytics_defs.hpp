@@ -46,7 +46,7 @@ void inline aggregates_empty_callback(const uint8_t *UNREFERENCED_PARAMETER(src_
                                       uint32_t UNREFERENCED_PARAMETER(length),
                                       uint32_t *UNREFERENCED_PARAMETER(min_value_ptr),
                                       uint32_t *UNREFERENCED_PARAMETER(max_value_ptr),
-                                      uint32_t *UNREFERENCED_PARAMETER(sum_ptr),
+                                      uint64_t *UNREFERENCED_PARAMETER(sum_ptr),
                                       uint32_t *UNREFERENCED_PARAMETER(index_ptr)) {
     // Don't do anything, this is just a stub
 }
@@ -61,12 +61,17 @@ static inline auto expand(input_stream_t &input_stream,
                 return status_list::source_2_is_short_error;
             }
 
-            auto unpack_result = mask_stream.unpack<analytic_pipeline::simple>(unpack_mask_buffer);
+            // Mask may be compressed or PRLE-encoded, it's unpacked in lock-step with the source
+            auto unpack_result = mask_stream.unpack_any(unpack_mask_buffer);
 
             if (status_list::ok != unpack_result.status) {
                 return unpack_result.status;
             }
 
+            if (0u == unpack_result.unpacked_elements) {
+                return status_list::source_2_is_short_error;
+            }
+
             mask_elements = unpack_result.unpacked_elements;
             mask_ptr      = unpack_mask_buffer.data();
         }
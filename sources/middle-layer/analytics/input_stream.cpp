@@ -88,9 +88,7 @@ auto input_stream_t::unpack<analytic_pipeline::prle>(limited_buffer_t &output_bu
     return input_stream_t::unpack<analytic_pipeline::prle>(output_buffer, output_buffer.max_elements_count());
 }
 
-template <>
-auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output_buffer,
-                                                        size_t required_elements) noexcept -> unpack_result_t {
+auto input_stream_t::decompress(size_t required_elements) noexcept -> unpack_result_t {
     auto elements_to_decompress = (required_elements >> 3u) << 3u;
     auto bytes_to_decompress    = (elements_to_decompress * bit_width_) / byte_bits_size;
 
@@ -107,8 +105,6 @@ auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output
     auto elements_to_unpack    = std::min(decompressed_elements, current_number_of_elements_);
     auto unpacked_bytes        = util::bit_to_byte(elements_to_unpack * bit_width_);
 
-    unpack_kernel_(decompress_begin_, elements_to_unpack, 0, output_buffer.data());
-
     input_stream_t::add_elements_processed(elements_to_unpack);
 
     if (result.status_code_ == status_list::more_output_needed) {
@@ -118,6 +114,16 @@ auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output
     return unpack_result_t(result.status_code_, elements_to_unpack, unpacked_bytes);
 }
 
+template <>
+auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output_buffer,
+                                                        size_t required_elements) noexcept -> unpack_result_t {
+    auto result = input_stream_t::decompress(required_elements);
+
+    unpack_kernel_(decompress_begin_, result.unpacked_elements, 0, output_buffer.data());
+
+    return result;
+}
+
 template <>
 auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output_buffer) noexcept
 -> unpack_result_t {
@@ -188,6 +194,18 @@ auto input_stream_t::unpack<analytic_pipeline::inflate_prle>(limited_buffer_t &o
     return input_stream_t::unpack<analytic_pipeline::inflate_prle>(output_buffer, output_buffer.max_elements_count());
 }
 
+auto input_stream_t::unpack_any(limited_buffer_t &output_buffer) noexcept -> unpack_result_t {
+    if (stream_format_ == stream_format_t::prle_format) {
+        return is_compressed_
+               ? input_stream_t::unpack<analytic_pipeline::inflate_prle>(output_buffer)
+               : input_stream_t::unpack<analytic_pipeline::prle>(output_buffer);
+    }
+
+    return is_compressed_
+           ? input_stream_t::unpack<analytic_pipeline::inflate>(output_buffer)
+           : input_stream_t::unpack<analytic_pipeline::simple>(output_buffer);
+}
+
 auto input_stream_t::initialize_sw_kernels() noexcept -> void {
     auto unpack_table      = core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
     auto unpack_prle_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_prle_table();
@@ -72,6 +72,22 @@ public:
     template <analytic_pipeline pipeline>
     auto unpack(limited_buffer_t &output_buffer, size_t required_elements) noexcept -> unpack_result_t;
 
+    /**
+     * @brief Unpacks the next elements with the pipeline chosen by the stream format and compression at runtime,
+     *        for streams that are consumed along with a main stream of another pipeline (e.g. masks)
+     */
+    auto unpack_any(limited_buffer_t &output_buffer) noexcept -> unpack_result_t;
+
+    /**
+     * @brief Inflates the next elements into the decompress buffer and leaves them packed there,
+     *        so that kernels consuming byte-aligned elements can read them in place
+     */
+    auto decompress(size_t required_elements) noexcept -> unpack_result_t;
+
+    [[nodiscard]] inline auto decompressed_data() const noexcept -> uint8_t * {
+        return decompress_begin_;
+    }
+
     [[nodiscard]] inline auto bit_width() const noexcept -> uint32_t {
         return bit_width_;
     }
@@ -85,7 +85,13 @@ static inline auto scan(input_stream_t &input_stream,
     return status_list::ok;
 }
 
-template <analytic_pipeline = analytic_pipeline::simple>
+/**
+ * Size of decoded data scanned at once by the fused decompress-scan pipeline, chosen so that the tile
+ * and its scan output stay resident in the L1 data cache between inflate and scan
+ */
+constexpr uint32_t fused_scan_tile_size = 16u * 1024u;
+
+template <analytic_pipeline pipeline_t = analytic_pipeline::simple>
 static inline auto scan(input_stream_t &input_stream,
                         limited_buffer_t &buffer,
                         output_stream_t<bit_stream> &output_stream,
@@ -94,14 +100,40 @@ static inline auto scan(input_stream_t &input_stream,
                         aggregates_t &aggregates,
                         uint32_t param_low,
                         uint32_t param_high) noexcept -> uint32_t {
+    static_assert(pipeline_t == analytic_pipeline::simple || pipeline_t == analytic_pipeline::inflate,
+                  "Scan kernels can consume only byte-aligned little-endian elements");
+
     auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
     if (QPL_STS_OK != drop_initial_bytes_status) {
         return drop_initial_bytes_status;
     }
 
+    const uint32_t tile_elements = std::min(buffer.max_elements_count(),
+                                            fused_scan_tile_size * byte_bits_size / input_stream.bit_width());
+
     while (!input_stream.is_processed()) {
-        auto elements_to_process = std::min(buffer.max_elements_count(), input_stream.elements_left());
-        scan_kernel(input_stream.current_ptr(), buffer.data(), elements_to_process, param_low, param_high);
+        uint8_t  *source_ptr         = input_stream.current_ptr();
+        uint32_t elements_to_process = 0u;
+
+        if constexpr (pipeline_t == analytic_pipeline::inflate) {
+            // Decoded tile is scanned right in the decompress buffer, no unpack pass is required
+            auto decompress_result = input_stream.decompress(tile_elements);
+
+            if (status_list::ok != decompress_result.status) {
+                return decompress_result.status;
+            }
+
+            if (0u == decompress_result.unpacked_elements) {
+                return status_list::source_is_short_error;
+            }
+
+            source_ptr          = input_stream.decompressed_data();
+            elements_to_process = decompress_result.unpacked_elements;
+        } else {
+            elements_to_process = std::min(buffer.max_elements_count(), input_stream.elements_left());
+        }
+
+        scan_kernel(source_ptr, buffer.data(), elements_to_process, param_low, param_high);
 
         aggregates_callback(buffer.data(),
                             elements_to_process,
@@ -117,11 +149,12 @@ static inline auto scan(input_stream_t &input_stream,
             return status;
         }
 
-        uint32_t length_in_bytes = util::bit_to_byte(elements_to_process * input_stream.bit_width());
-
-        input_stream.shift_current_ptr(length_in_bytes);
-        input_stream.add_elements_processed(elements_to_process);
+        if constexpr (pipeline_t == analytic_pipeline::simple) {
+            uint32_t length_in_bytes = util::bit_to_byte(elements_to_process * input_stream.bit_width());
 
+            input_stream.shift_current_ptr(length_in_bytes);
+            input_stream.add_elements_processed(elements_to_process);
+        }
     }
 
     return status_list::ok;
@@ -152,21 +185,31 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
                                 aggregates_table[aggregates_index];
 
     if ((input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) &&
-        input_stream.stream_format() == stream_format_t::le_format &&
-        !input_stream.is_compressed()) {
+        input_stream.stream_format() == stream_format_t::le_format) {
 
         auto scan_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_table();
         auto scan_index  = core_sw::dispatcher::get_scan_index(input_bit_width, (uint32_t) comparator);
         auto scan_kernel = scan_table[scan_index];
 
-        status_code = scan<analytic_pipeline::simple>(input_stream,
-                                                      temporary_buffer,
-                                                      output_stream,
-                                                      scan_kernel,
-                                                      aggregates_callback,
-                                                      aggregates,
-                                                      corrected_param_low,
-                                                      corrected_param_high);
+        if (input_stream.is_compressed()) {
+            status_code = scan<analytic_pipeline::inflate>(input_stream,
+                                                           temporary_buffer,
+                                                           output_stream,
+                                                           scan_kernel,
+                                                           aggregates_callback,
+                                                           aggregates,
+                                                           corrected_param_low,
+                                                           corrected_param_high);
+        } else {
+            status_code = scan<analytic_pipeline::simple>(input_stream,
+                                                          temporary_buffer,
+                                                          output_stream,
+                                                          scan_kernel,
+                                                          aggregates_callback,
+                                                          aggregates,
+                                                          corrected_param_low,
+                                                          corrected_param_high);
+        }
     } else {
         if (input_stream.stream_format() == stream_format_t::prle_format) {
             if (input_stream.is_compressed()) {
@@ -219,6 +262,182 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
     return operation_result;
 }
 
+/**
+ * Evaluates the scan program in one pass over the elements. Byte-aligned little-endian elements of the simple
+ * and inflate pipelines are consumed right from the source or the decompress buffer, other elements are
+ * unpacked into the buffer first and the program is evaluated there in-place
+ */
+template <analytic_pipeline pipeline_t>
+static inline auto scan_program(input_stream_t &input_stream,
+                                limited_buffer_t &buffer,
+                                output_stream_t<bit_stream> &output_stream,
+                                const qplc_scan_program_t &program,
+                                core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                aggregates_t &aggregates) noexcept -> uint32_t {
+    constexpr bool is_prle_pipeline = (pipeline_t == analytic_pipeline::prle ||
+                                       pipeline_t == analytic_pipeline::inflate_prle);
+
+    const uint32_t input_bit_width = input_stream.bit_width();
+    const bool     is_unpack_required = is_prle_pipeline ||
+                                        !(input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) ||
+                                        input_stream.stream_format() != stream_format_t::le_format;
+
+    auto table               = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_program_table();
+    auto index               = core_sw::dispatcher::get_scan_program_index(input_bit_width);
+    auto scan_program_kernel = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    const uint32_t tile_elements = std::min(buffer.max_elements_count(),
+                                            fused_scan_tile_size * byte_bits_size / input_bit_width);
+
+    while (!input_stream.is_processed()) {
+        const uint8_t *source_ptr          = buffer.data();
+        uint32_t      elements_to_process = 0u;
+
+        if (is_unpack_required) {
+            auto unpack_result = input_stream.unpack<pipeline_t>(buffer);
+
+            if (status_list::ok != unpack_result.status) {
+                return unpack_result.status;
+            }
+
+            elements_to_process = unpack_result.unpacked_elements;
+        } else if constexpr (pipeline_t == analytic_pipeline::inflate) {
+            auto decompress_result = input_stream.decompress(tile_elements);
+
+            if (status_list::ok != decompress_result.status) {
+                return decompress_result.status;
+            }
+
+            if (0u == decompress_result.unpacked_elements) {
+                return status_list::source_is_short_error;
+            }
+
+            source_ptr          = input_stream.decompressed_data();
+            elements_to_process = decompress_result.unpacked_elements;
+        } else {
+            source_ptr          = input_stream.current_ptr();
+            elements_to_process = std::min(buffer.max_elements_count(), input_stream.elements_left());
+        }
+
+        const qpl_ml_status scan_status = scan_program_kernel(source_ptr,
+                                                              buffer.data(),
+                                                              elements_to_process,
+                                                              &program);
+
+        if (status_list::ok != scan_status) {
+            return scan_status;
+        }
+
+        aggregates_callback(buffer.data(),
+                            elements_to_process,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(),
+                                                 elements_to_process);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+
+        if constexpr (pipeline_t == analytic_pipeline::simple) {
+            if (!is_unpack_required) {
+                uint32_t length_in_bytes = util::bit_to_byte(elements_to_process * input_bit_width);
+
+                input_stream.shift_current_ptr(length_in_bytes);
+                input_stream.add_elements_processed(elements_to_process);
+            }
+        }
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Software path of the scan program operation, the program is expected to be validated by the caller
+ */
+static inline auto call_scan_program_sw(input_stream_t &input_stream,
+                                        output_stream_t<bit_stream> &output_stream,
+                                        const qplc_scan_program_t &program,
+                                        limited_buffer_t &temporary_buffer) noexcept -> analytic_operation_result_t {
+    auto input_bit_width    = input_stream.bit_width();
+    auto output_bit_width   = output_stream.bit_width();
+    auto number_of_elements = input_stream.elements_left();
+
+    analytic_operation_result_t operation_result{};
+    aggregates_t                aggregates{};
+
+    uint32_t status_code = status_list::ok;
+
+    // Parameters are corrected the same way as for a single scan
+    qplc_scan_program_t corrected_program = program;
+
+    for (uint32_t i = 0u; i < corrected_program.size; i++) {
+        auto &instruction = corrected_program.instructions[i];
+
+        instruction.low_value  = correct_input_param(input_bit_width, instruction.low_value);
+        instruction.high_value = correct_input_param(input_bit_width, instruction.high_value);
+    }
+
+    auto aggregates_table    = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_index    = core_sw::dispatcher::get_aggregates_index(1u);
+    auto aggregates_callback = (input_stream.are_aggregates_disabled()) ?
+                                &aggregates_empty_callback :
+                                aggregates_table[aggregates_index];
+
+    if (input_stream.stream_format() == stream_format_t::prle_format) {
+        if (input_stream.is_compressed()) {
+            status_code = scan_program<analytic_pipeline::inflate_prle>(input_stream,
+                                                                        temporary_buffer,
+                                                                        output_stream,
+                                                                        corrected_program,
+                                                                        aggregates_callback,
+                                                                        aggregates);
+        } else {
+            status_code = scan_program<analytic_pipeline::prle>(input_stream,
+                                                                temporary_buffer,
+                                                                output_stream,
+                                                                corrected_program,
+                                                                aggregates_callback,
+                                                                aggregates);
+        }
+    } else {
+        if (input_stream.is_compressed()) {
+            status_code = scan_program<analytic_pipeline::inflate>(input_stream,
+                                                                   temporary_buffer,
+                                                                   output_stream,
+                                                                   corrected_program,
+                                                                   aggregates_callback,
+                                                                   aggregates);
+        } else {
+            status_code = scan_program<analytic_pipeline::simple>(input_stream,
+                                                                  temporary_buffer,
+                                                                  output_stream,
+                                                                  corrected_program,
+                                                                  aggregates_callback,
+                                                                  aggregates);
+        }
+    }
+
+    input_stream.calculate_checksums();
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.last_bit_offset_  = (1u == output_bit_width) ? number_of_elements & max_bit_index : 0u;
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    return operation_result;
+}
+
 template <comparator_t comparator>
 constexpr static inline auto own_get_scan_range(const uint32_t low_limit,
                                                 const uint32_t high_limit,
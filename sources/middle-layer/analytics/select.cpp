@@ -39,12 +39,17 @@ static inline auto select(input_stream_t &input_stream,
     // Main action
     while (!input_stream.is_processed()) {
         if (mask_elements == 0) {
-            auto unpack_result = mask_stream.unpack<analytic_pipeline::simple>(set_buffer);
+            // Mask may be compressed or PRLE-encoded, it's unpacked in lock-step with the source
+            auto unpack_result = mask_stream.unpack_any(set_buffer);
 
             if (status_list::ok != unpack_result.status) {
                 return unpack_result.status;
             }
 
+            if (0u == unpack_result.unpacked_elements) {
+                return status_list::source_2_is_short_error;
+            }
+
             mask_elements = unpack_result.unpacked_elements;
             mask_ptr      = set_buffer.data();
         }
@@ -48,6 +48,8 @@ constexpr qpl_ml_status size_error                         = QPL_STS_SIZE_ERR;
 constexpr qpl_ml_status output_overflow_error              = QPL_STS_OUTPUT_OVERFLOW_ERR;
 constexpr qpl_ml_status buffers_overlap                    = QPL_STS_BUFFER_OVERLAP_ERR;
 constexpr qpl_ml_status compression_reference_before_start = QPL_STS_REF_BEFORE_START_ERR;
+constexpr qpl_ml_status bad_literal_code_error             = QPL_STS_BAD_LL_CODE_ERR;
+constexpr qpl_ml_status serialization_corrupted_dump       = QPL_STS_SERIALIZATION_CORRUPTED_DUMP;
 
 }
 
@@ -60,7 +62,7 @@ struct checksums_t {
 struct aggregates_t {
     uint32_t min_value_ = std::numeric_limits<uint32_t>::max();
     uint32_t max_value_ = 0;
-    uint32_t sum_       = 0;
+    uint64_t sum_       = 0;
     uint32_t index_     = 0;
 };
 
@@ -78,6 +80,7 @@ constexpr uint32_t bit_len_to_byte_shift_offset = 3;
 constexpr uint32_t max_bit_index                = 7;
 constexpr uint32_t qpl_1k                       = 1024;
 constexpr uint32_t max_history_size             = 4 * qpl_1k;
+constexpr uint32_t max_dictionary_size          = 32 * qpl_1k;
 
 namespace limits {
 constexpr uint32_t max_bit_width    = int_bits_size;
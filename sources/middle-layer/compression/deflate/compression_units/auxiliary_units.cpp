@@ -20,6 +20,7 @@
 
 #include "compression/huffman_only/huffman_only_compression_state.hpp"
 #include "compression/deflate/implementations/deflate_implementation.hpp"
+#include "compression/dictionary/dictionary_utils.hpp"
 
 extern "C" {
 extern void isal_deflate_hash(struct isal_zstream *stream, uint8_t *dict, uint32_t dict_len);
@@ -71,14 +72,20 @@ auto init_compression(stream_t &stream, compression_state_t &state) noexcept ->
     stream.isal_stream_ptr_->level = stream.compression_mode_ == dynamic_mode ? 3 : 0;
     isal_state->hash_mask          = stream.compression_mode_ == dynamic_mode ? LVL3_HASH_MASK : LVL0_HASH_MASK;
 
+    // Matches can refer to the dictionary, so the hash table isn't shrunk for small inputs
+    bool is_hash_mask_fixed = false;
+
     if constexpr (std::is_same_v<stream_t, deflate_state<execution_path_t::software>>) {
         if (stream.mini_blocks_support() == mini_blocks_support_t::enabled) {
             isal_state->hash_mask          = LVL0_HASH_MASK;
             stream.isal_stream_ptr_->level = 0;
         }
+
+        is_hash_mask_fixed = stream.dictionary_support() == dictionary_support_t::enabled;
     }
 
-    if (isal_state->hash_mask > 2 * stream.isal_stream_ptr_->avail_in && stream.isal_stream_ptr_->end_of_stream) {
+    if (!is_hash_mask_fixed &&
+        isal_state->hash_mask > 2 * stream.isal_stream_ptr_->avail_in && stream.isal_stream_ptr_->end_of_stream) {
         isal_state->hash_mask = (1 << bsr(stream.isal_stream_ptr_->avail_in)) - 1;
     }
 
@@ -301,10 +308,41 @@ auto finish_compression_process(deflate_state<execution_path_t::software> &strea
 }
 
 void update_hash(deflate_state<execution_path_t::software> &stream, uint8_t *dictionary_ptr, uint32_t dictionary_size) noexcept {
-    if (stream.compression_level() == high_level) {
+    if (stream.compression_level() != default_level) {
+        // Matches of the lazy matcher levels don't exceed 4k, so older history isn't hashed
+        if (dictionary_size > max_history_size) {
+            dictionary_ptr += dictionary_size - max_history_size;
+            dictionary_size = max_history_size;
+        }
+
         qplc_setup_dictionary()(dictionary_ptr, dictionary_size, stream.hash_table());
+        return;
+    }
+
+    isal_zstream    *isal_stream_ptr    = stream.isal_stream_ptr_;
+    const uint16_t  *prebuilt_table_ptr = nullptr;
+
+    // Hash table of the dictionary is built for the first job only, as indices are relative to the source beginning
+    if (stream.dictionary_ptr_ != nullptr &&
+        isal_stream_ptr->total_in == 0u &&
+        stream.dictionary_ptr_->raw_dictionary_size == dictionary_size) {
+        prebuilt_table_ptr = get_dictionary_hash_table(*stream.dictionary_ptr_,
+                                                       isal_stream_ptr->level,
+                                                       isal_stream_ptr->internal_state.hash_mask);
+    }
+
+    if (prebuilt_table_ptr != nullptr) {
+        auto *level_buffer_ptr = reinterpret_cast<level_buf *>(isal_stream_ptr->level_buf);
+        auto *hash_table_ptr   = (isal_stream_ptr->level == 3u) ? level_buffer_ptr->lvl3.hash_table
+                                                                : isal_stream_ptr->internal_state.head;
+
+        core_sw::util::copy(prebuilt_table_ptr,
+                            prebuilt_table_ptr + isal_stream_ptr->internal_state.hash_mask + 1u,
+                            hash_table_ptr);
+
+        isal_stream_ptr->internal_state.has_hist = IGZIP_HIST;
     } else {
-        isal_deflate_hash(stream.isal_stream_ptr_, dictionary_ptr, dictionary_size);
+        isal_deflate_hash(isal_stream_ptr, dictionary_ptr, dictionary_size);
     }
 }
 
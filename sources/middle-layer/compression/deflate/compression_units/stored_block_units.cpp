@@ -5,6 +5,11 @@
  ******************************************************************************/
 
 #include "stored_block_units.hpp"
+#include "icf_units.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #include "util/util.hpp"
 #include "simple_memory_ops.hpp"
@@ -229,6 +234,103 @@ auto write_stored_block_header(deflate_state<execution_path_t::software> &stream
     return status_list::ok;
 }
 
+auto is_incompressible(const uint8_t *begin, uint32_t size, uint32_t threshold) noexcept -> bool {
+    constexpr uint32_t hash_bits         = 9u;
+    constexpr uint32_t min_match_length  = 4u;
+    constexpr uint32_t matched_byte_bits = 2u;
+
+    uint32_t histogram[256u]            = {};
+    uint32_t positions[1u << hash_bits] = {};    // Position + 1 of the last sequence with the hash, 0 if none
+
+    uint32_t segments_count = incompressible_probe_segments;
+    uint32_t segment_size   = incompressible_probe_segment_size;
+
+    if (size <= segments_count * segment_size) {
+        segments_count = 1u;
+        segment_size   = size;
+    }
+
+    const uint32_t segments_stride = size / segments_count;
+
+    uint32_t literals_count = 0u;
+    uint32_t matched_count  = 0u;
+
+    for (uint32_t segment = 0u; segment < segments_count; segment++) {
+        const uint32_t segment_begin = segment * segments_stride;
+        const uint32_t segment_end   = segment_begin + segment_size;
+
+        uint32_t position = segment_begin;
+
+        while (position + min_match_length <= segment_end) {
+            uint32_t sequence = 0u;
+            std::memcpy(&sequence, begin + position, sizeof(sequence));
+
+            const uint32_t hash      = (sequence * 0x9E3779B1u) >> (32u - hash_bits);
+            const uint32_t candidate = positions[hash];
+
+            positions[hash] = position + 1u;
+
+            if (candidate != 0u && std::memcmp(begin + candidate - 1u, begin + position, min_match_length) == 0) {
+                matched_count += min_match_length;
+                position      += min_match_length;
+            } else {
+                histogram[begin[position]]++;
+                literals_count++;
+                position++;
+            }
+        }
+
+        for (; position < segment_end; position++) {
+            histogram[begin[position]]++;
+            literals_count++;
+        }
+    }
+
+    double bits = static_cast<double>(matched_count) * matched_byte_bits;
+
+    for (uint32_t count : histogram) {
+        if (count != 0u) {
+            bits += static_cast<double>(count) *
+                    std::log2(static_cast<double>(literals_count) / static_cast<double>(count));
+        }
+    }
+
+    const auto sampled_bits = static_cast<double>(literals_count + matched_count) * byte_bit_size;
+
+    return bits * 100.0 >= sampled_bits * threshold;
+}
+
+auto probe_incompressible_block(deflate_state<execution_path_t::software> &stream,
+                                compression_state_t &state) noexcept -> qpl_ml_status {
+    auto status = init_new_icf_block(stream, state);
+
+    if (status != status_list::ok || stream.incompressible_threshold_ > 100u) {
+        return status;
+    }
+
+    auto isal_stream_ptr = stream.isal_stream_ptr_;
+    auto isal_state      = &isal_stream_ptr->internal_state;
+
+    const uint32_t block_size = std::min(isal_stream_ptr->avail_in, incompressible_probe_block_size);
+
+    // Data that doesn't fit as stored blocks is left for the regular pipeline, it may still fit compressed
+    if (block_size < incompressible_probe_min_size ||
+        get_stored_blocks_size(block_size) + bit_buffer_slope_bytes > isal_stream_ptr->avail_out ||
+        !is_incompressible(isal_stream_ptr->next_in, block_size, stream.incompressible_threshold_)) {
+        return status_list::ok;
+    }
+
+    // The block is consumed the same way the ICF body does, so the stored block units copy it from the source
+    isal_stream_ptr->next_in  += block_size;
+    isal_stream_ptr->avail_in -= block_size;
+    isal_stream_ptr->total_in += block_size;
+    isal_state->block_end     += block_size;
+
+    state = compression_state_t::write_stored_block;
+
+    return status_list::ok;
+}
+
 auto calculate_size_needed(uint32_t input_data_size, uint32_t bit_size) noexcept -> uint32_t {
     uint32_t size = util::bit_to_byte(bit_size);
 
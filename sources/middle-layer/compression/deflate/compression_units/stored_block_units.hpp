@@ -32,6 +32,21 @@ auto write_stored_block(deflate_state<execution_path_t::hardware> &state) noexce
 auto recover_and_write_stored_blocks(deflate_state<execution_path_t::software> &stream,
                                      compression_state_t &state) noexcept -> qpl_ml_status;
 
+/**
+ * @brief Estimates the compressed size of the data from its sample: entropy of the literal bytes
+ * plus a small cost of the bytes covered by repeated 4-byte sequences
+ *
+ * @return true if the estimate is at least `threshold` percent of the data size
+ */
+auto is_incompressible(const uint8_t *begin, uint32_t size, uint32_t threshold) noexcept -> bool;
+
+/**
+ * @brief Starts a new ICF block, the next part of the source is written as stored blocks
+ * without match searching if its sample looks incompressible
+ */
+auto probe_incompressible_block(deflate_state<execution_path_t::software> &stream,
+                                compression_state_t &state) noexcept -> qpl_ml_status;
+
 auto calculate_size_needed(uint32_t input_data_size, uint32_t bit_size) noexcept -> uint32_t;
 
 static inline auto get_stored_blocks_size(uint32_t source_size) noexcept {
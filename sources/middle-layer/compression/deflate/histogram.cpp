@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+
 #include "compression/deflate/histogram.hpp"
 #include "util/descriptor_processing.hpp"
 #include "simple_memory_ops.hpp"
@@ -55,6 +58,79 @@ static inline void isal_histogram_get_statistics(const isal_histogram *isal_hist
     }
 }
 
+/**
+ * Size of the source windows histogram is gathered from in the sampled mode,
+ * each window is parsed without the history of the previous ones
+ */
+constexpr uint32_t sample_window_size = 16u * 1024u;
+
+/**
+ * Index of the first match length symbol in the literals/lengths histogram
+ */
+constexpr uint32_t first_length_symbol = 257u;
+
+static inline auto get_length_extra_bits(uint32_t symbol) noexcept -> uint32_t {
+    const uint32_t code = symbol - first_length_symbol;
+
+    return (code < 8u || code == 28u) ? 0u : (code - 4u) / 4u;
+}
+
+static inline auto get_distance_extra_bits(uint32_t symbol) noexcept -> uint32_t {
+    return (symbol < 4u) ? 0u : symbol / 2u - 1u;
+}
+
+/**
+ * @brief Number of bits needed to encode the symbols with the optimal prefix code, computed as entropy
+ */
+static inline auto get_encoded_bits(const uint32_t *counts_ptr, uint32_t size) noexcept -> double {
+    uint64_t total = 0u;
+
+    for (uint32_t i = 0u; i < size; i++) {
+        total += counts_ptr[i];
+    }
+
+    double bits = 0.0;
+
+    for (uint32_t i = 0u; i < size; i++) {
+        if (counts_ptr[i] != 0u) {
+            bits += static_cast<double>(counts_ptr[i]) *
+                    std::log2(static_cast<double>(total) / static_cast<double>(counts_ptr[i]));
+        }
+    }
+
+    return bits;
+}
+
+static inline auto estimate_deflate_size(const qpl_histogram &histogram) noexcept -> uint32_t {
+    double bits = get_encoded_bits(histogram.literal_lengths, QPL_LITERALS_MATCHES_TABLE_SIZE) +
+                  get_encoded_bits(histogram.distances, QPL_DEFAULT_OFFSETS_NUMBER);
+
+    for (uint32_t i = first_length_symbol; i < QPL_LITERALS_MATCHES_TABLE_SIZE; i++) {
+        bits += static_cast<double>(histogram.literal_lengths[i]) * get_length_extra_bits(i);
+    }
+
+    for (uint32_t i = 0u; i < QPL_DEFAULT_OFFSETS_NUMBER; i++) {
+        bits += static_cast<double>(histogram.distances[i]) * get_distance_extra_bits(i);
+    }
+
+    return static_cast<uint32_t>(std::ceil(bits / byte_bits_size));
+}
+
+/**
+ * @brief Scales the counts gathered from the sampled part of the source to the whole source
+ */
+static inline void scale_histogram(qpl_histogram &histogram, uint32_t sampled_size, uint32_t source_size) noexcept {
+    auto *counts_ptr = reinterpret_cast<uint32_t *>(&histogram);
+
+    for (uint32_t i = 0u; i < sizeof(qpl_histogram) / sizeof(uint32_t); i++) {
+        if (counts_ptr[i] != 0u) {
+            const uint64_t count = static_cast<uint64_t>(counts_ptr[i]) * source_size / sampled_size;
+
+            counts_ptr[i] = (count != 0u) ? static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX)) : 1u;
+        }
+    }
+}
+
 static inline void remove_empty_places_in_histogram(qpl_histogram &histogram) {
     for (unsigned int &literal_length: histogram.literal_lengths) {
         if (literal_length == 0) {
@@ -69,10 +145,15 @@ static inline void remove_empty_places_in_histogram(qpl_histogram &histogram) {
     }
 }
 
-}
+
+template <execution_path_t path>
+auto gather_histogram(const uint8_t *begin,
+                      const uint8_t *end,
+                      deflate_histogram &histogram,
+                      deflate_level level) noexcept -> qpl_ml_status;
 
 template <>
-auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
+auto gather_histogram<execution_path_t::hardware>(const uint8_t *begin,
                                                   const uint8_t *end,
                                                   deflate_histogram &histogram,
                                                   deflate_level UNREFERENCED_PARAMETER(level)) noexcept -> qpl_ml_status {
@@ -95,11 +176,9 @@ auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
                                            util::execution_mode_t::sync>(&descriptor, &completion_record);
 
     if (status_list::ok == status) {
-        details::histogram_join_another(histogram, hw_histogram);
+        histogram_join_another(histogram, hw_histogram);
     }
 
-    details::remove_empty_places_in_histogram(histogram);
-
     return status;
 }
 
@@ -109,18 +188,17 @@ auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
 #endif
 
 template <>
-auto update_histogram<execution_path_t::software>(const uint8_t *begin,
+auto gather_histogram<execution_path_t::software>(const uint8_t *begin,
                                                   const uint8_t *end,
                                                   deflate_histogram &histogram,
                                                   deflate_level level) noexcept -> qpl_ml_status {
-    using namespace qpl::ml;
 
     static const auto &histogram_reset = ((qplc_deflate_histogram_reset_ptr)
             (core_sw::dispatcher::kernels_dispatcher::get_instance().get_deflate_table()[1]));
 
     if (qpl_default_level == level) {
         isal_histogram isal_histogram_v = {{0u}, {0u}, {0u}};
-        details::isal_histogram_set_statistics(&isal_histogram_v,
+        isal_histogram_set_statistics(&isal_histogram_v,
                                                histogram.literal_lengths,
                                                histogram.distances);
 
@@ -130,7 +208,7 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
                               &isal_histogram_v);
 
         // Store result
-        details::isal_histogram_get_statistics(&isal_histogram_v,
+        isal_histogram_get_statistics(&isal_histogram_v,
                                                histogram.literal_lengths,
                                                histogram.distances);
     } else {
@@ -168,8 +246,6 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
                                          histogram.distances);
     }
 
-    details::remove_empty_places_in_histogram(histogram);
-
     return QPL_STS_OK;
 }
 
@@ -178,3 +254,87 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
 #endif
 
 }
+
+template <>
+auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
+                                                  const uint8_t *end,
+                                                  deflate_histogram &histogram,
+                                                  deflate_level level) noexcept -> qpl_ml_status {
+    auto status = details::gather_histogram<execution_path_t::hardware>(begin, end, histogram, level);
+
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status;
+}
+
+template <>
+auto update_histogram<execution_path_t::software>(const uint8_t *begin,
+                                                  const uint8_t *end,
+                                                  deflate_histogram &histogram,
+                                                  deflate_level level) noexcept -> qpl_ml_status {
+    auto status = details::gather_histogram<execution_path_t::software>(begin, end, histogram, level);
+
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status;
+}
+
+template <execution_path_t path>
+auto update_histogram_sampled(const uint8_t *begin,
+                              const uint8_t *end,
+                              deflate_histogram &histogram,
+                              uint32_t sampling_interval,
+                              uint32_t &estimated_size,
+                              deflate_level level) noexcept -> qpl_ml_status {
+    const auto source_size = static_cast<uint32_t>(std::distance(begin, end));
+    const auto step        = static_cast<uint64_t>(details::sample_window_size) * std::max(sampling_interval, 1u);
+
+    qpl_histogram sampled_histogram{};
+    uint32_t      sampled_size = 0u;
+
+    for (uint64_t offset = 0u; offset < source_size; offset += step) {
+        const auto window_size = std::min(details::sample_window_size, source_size - static_cast<uint32_t>(offset));
+
+        auto status = details::gather_histogram<path>(begin + offset,
+                                                      begin + offset + window_size,
+                                                      sampled_histogram,
+                                                      level);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+
+        sampled_size += window_size;
+    }
+
+    estimated_size = 0u;
+
+    if (sampled_size != 0u) {
+        details::scale_histogram(sampled_histogram, sampled_size, source_size);
+
+        estimated_size = details::estimate_deflate_size(sampled_histogram);
+    }
+
+    details::histogram_join_another(histogram, sampled_histogram);
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status_list::ok;
+}
+
+template
+auto update_histogram_sampled<execution_path_t::hardware>(const uint8_t *begin,
+                                                          const uint8_t *end,
+                                                          deflate_histogram &histogram,
+                                                          uint32_t sampling_interval,
+                                                          uint32_t &estimated_size,
+                                                          deflate_level level) noexcept -> qpl_ml_status;
+
+template
+auto update_histogram_sampled<execution_path_t::software>(const uint8_t *begin,
+                                                          const uint8_t *end,
+                                                          deflate_histogram &histogram,
+                                                          uint32_t sampling_interval,
+                                                          uint32_t &estimated_size,
+                                                          deflate_level level) noexcept -> qpl_ml_status;
+
+}
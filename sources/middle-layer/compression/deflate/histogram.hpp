@@ -24,6 +24,20 @@ auto update_histogram(iterator_t begin,
                       iterator_t end,
                       deflate_histogram &histogram,
                       deflate_level level = qpl_default_level) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Gathers the histogram from one of every `sampling_interval` windows of the source only,
+ * the counts are scaled to the whole source before they are added to the histogram
+ *
+ * @param[out] estimated_size  Size of the deflate blocks estimated from the scaled counts, headers excluded
+ */
+template <execution_path_t path>
+auto update_histogram_sampled(const uint8_t *begin,
+                              const uint8_t *end,
+                              deflate_histogram &histogram,
+                              uint32_t sampling_interval,
+                              uint32_t &estimated_size,
+                              deflate_level level = qpl_default_level) noexcept -> qpl_ml_status;
 }
 
 #endif //QPL_HISTOGRAM_HPP_
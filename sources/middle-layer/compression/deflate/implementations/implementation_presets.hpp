@@ -36,7 +36,7 @@ struct deflate_implementation<default_level, dynamic_mode, block_type_t::deflate
     static constexpr auto instance = implementation<deflate_state<execution_path_t::software>>(
         {
                 {compression_state_t::init_compression,          &init_compression},
-                {compression_state_t::start_new_block,           &init_new_icf_block},
+                {compression_state_t::start_new_block,           &probe_incompressible_block},
                 {compression_state_t::compression_body,          &deflate_icf_body},
                 {compression_state_t::compress_rest_data,        &deflate_icf_finish},
                 {compression_state_t::create_icf_header,         &create_icf_block_header},
@@ -54,7 +54,7 @@ struct deflate_implementation<high_level, dynamic_mode, block_type_t::deflate_bl
     static constexpr auto instance = implementation<deflate_state<execution_path_t::software>>(
         {
                 {compression_state_t::init_compression,          &init_compression},
-                {compression_state_t::start_new_block,           &init_new_icf_block},
+                {compression_state_t::start_new_block,           &probe_incompressible_block},
                 {compression_state_t::compression_body,          &slow_deflate_icf_body},
                 {compression_state_t::create_icf_header,         &create_icf_block_header},
                 {compression_state_t::write_buffered_icf_header, &write_buffered_icf_header},
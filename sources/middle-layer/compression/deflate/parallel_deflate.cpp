@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "parallel_deflate.hpp"
+
+#include "common/allocation_buffer_t.hpp"
+#include "common/bit_reverse.hpp"
+
+#include "compression/deflate/deflate.hpp"
+#include "compression/deflate/streams/deflate_state_builder.hpp"
+#include "compression/deflate/compression_units/compression_units.hpp"
+#include "compression/stream_decorators/gzip_decorator.hpp"
+#include "compression/stream_decorators/zlib_decorator.hpp"
+#include "compression/verification/verification_state_builder.hpp"
+#include "compression/verification/verify.hpp"
+
+#include "util/checksum.hpp"
+#include "util/thread_pool.hpp"
+
+#include "simple_memory_ops.hpp"
+#include "bitbuf2.h"
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+namespace qpl::ml::compression {
+
+namespace {
+
+struct segment_t {
+    uint8_t  *output_ptr     = nullptr;
+    uint32_t output_capacity = 0u;
+    uint32_t output_size     = 0u;
+    uint32_t crc32           = 0u;
+    uint32_t adler32         = 0u;
+    uint32_t status_code     = status_list::ok;
+};
+
+/**
+ * @brief Returns the worst-case size of a compressed segment
+ *
+ * Fixed Huffman codes take at most 9 bits per byte and dynamic blocks fall back to stored blocks,
+ * user-defined tables can use codes up to 15 bits long.
+ */
+inline auto get_segment_output_bound(uint32_t size, compression_mode_t mode) noexcept -> uint32_t {
+    const uint32_t expansion = (mode == static_mode) ? size : size / 8u;
+
+    return size + expansion + 1_kb;
+}
+
+} // namespace
+
+/**
+ * @brief Compresses a segment as a separate chunk and, if it is not the final one, closes the current block
+ *        and pads the output to a byte boundary with an empty non-final stored block
+ */
+auto compress_segment(deflate_state<execution_path_t::software> &stream,
+                      uint8_t *begin,
+                      uint32_t size) noexcept -> compression_operation_result_t {
+    auto result = deflate<execution_path_t::software, deflate_mode_t::deflate_default>(stream, begin, size);
+
+    if (result.status_code_ || stream.is_last_chunk()) {
+        return result;
+    }
+
+    // Dynamic blocks are always completed with End Of Block, fixed and static ones are left open
+    if (stream.compression_mode() != dynamic_mode) {
+        compression_state_t state = compression_state_t::flush_bit_buffer;
+
+        result.status_code_ = write_end_of_block(stream, state);
+
+        if (result.status_code_) {
+            return result;
+        }
+    }
+
+    if (stream.avail_out() < bit_buffer_slope_bytes) {
+        result.status_code_ = status_list::more_output_needed;
+
+        return result;
+    }
+
+    auto bit_buffer = &stream.isal_stream_ptr_->internal_state.bitbuf;
+
+    stream.reset_bit_buffer();
+
+    const uint32_t flush_size = static_cast<uint32_t>(-static_cast<int32_t>(bit_buffer->m_bit_count + 3u)) % byte_bit_size;
+
+    write_bits(bit_buffer, static_cast<uint64_t>(0xFFFF0000u) << (flush_size + 3u), uint32_bit_size + flush_size + 3u);
+
+    stream.dump_bit_buffer();
+
+    result.output_bytes_ = stream.isal_stream_ptr_->total_out;
+
+    return result;
+}
+
+auto deflate_parallel(uint8_t *begin,
+                      uint32_t size,
+                      uint8_t *output_begin,
+                      uint32_t output_size,
+                      const parallel_deflate_settings_t &settings,
+                      const util::linear_allocator &allocator) noexcept -> compression_operation_result_t {
+    compression_operation_result_t result{};
+
+    const uint32_t segments_count = (size + parallel_deflate_segment_size - 1u) / parallel_deflate_segment_size;
+
+    std::unique_ptr<segment_t[]> segments(new (std::nothrow) segment_t[segments_count]);
+
+    uint64_t segments_output_size = 0u;
+
+    for (uint32_t i = 0u; i < segments_count; i++) {
+        const uint32_t segment_size = std::min(parallel_deflate_segment_size, size - i * parallel_deflate_segment_size);
+
+        segments_output_size += get_segment_output_bound(segment_size, settings.mode);
+    }
+
+    std::unique_ptr<uint8_t[]> segments_output(new (std::nothrow) uint8_t[segments_output_size]);
+
+    if (!segments || !segments_output) {
+        result.status_code_ = status_list::internal_error;
+
+        return result;
+    }
+
+    uint8_t *segment_output_ptr = segments_output.get();
+
+    for (uint32_t i = 0u; i < segments_count; i++) {
+        const uint32_t segment_size = std::min(parallel_deflate_segment_size, size - i * parallel_deflate_segment_size);
+
+        segments[i].output_ptr      = segment_output_ptr;
+        segments[i].output_capacity = get_segment_output_bound(segment_size, settings.mode);
+
+        segment_output_ptr += segments[i].output_capacity;
+    }
+
+    std::atomic<uint32_t> next_segment{0u};
+
+    // Every thread owns a single deflate state and compresses segments until none left
+    util::thread_pool::get_instance().parallel_for(settings.threads_count, settings.threads_count, [&](uint32_t) {
+        const uint32_t state_buffer_size = deflate_state<execution_path_t::software>::get_buffer_size() + 64u;
+
+        std::unique_ptr<uint8_t[]> state_buffer(new (std::nothrow) uint8_t[state_buffer_size]);
+
+        for (uint32_t i = next_segment++; i < segments_count; i = next_segment++) {
+            auto &segment = segments[i];
+
+            if (!state_buffer) {
+                segment.status_code = status_list::internal_error;
+                continue;
+            }
+
+            uint8_t        *segment_begin = begin + i * parallel_deflate_segment_size;
+            const uint32_t segment_size   = std::min(parallel_deflate_segment_size, size - i * parallel_deflate_segment_size);
+            const bool     is_last        = (i + 1u == segments_count);
+
+            allocation_buffer_t segment_buffer(state_buffer.get(), state_buffer.get() + state_buffer_size);
+
+            const util::linear_allocator segment_allocator(segment_buffer);
+
+            auto builder = deflate_state_builder<execution_path_t::software>::create(segment_allocator);
+
+            builder.output(segment.output_ptr, segment.output_capacity)
+                   .compression_level(settings.level)
+                   .crc_seed({0u, 1u})
+                   .terminate(is_last)
+                   .incompressible_threshold(settings.incompressible_threshold)
+                   .verify(false);
+
+            if (settings.mode == dynamic_mode) {
+                builder.collect_statistics_step(true);
+            } else if (settings.mode == static_mode) {
+                builder.compression_table(settings.huffman_table);
+            }
+
+            if (0u != i) {
+                builder.history(segment_begin - parallel_deflate_history_size, parallel_deflate_history_size);
+            }
+
+            auto state = builder.build();
+
+            auto segment_result = compress_segment(state, segment_begin, segment_size);
+
+            segment.status_code = segment_result.status_code_;
+            segment.output_size = segment_result.output_bytes_;
+            segment.crc32       = segment_result.checksums_.crc32_;
+
+            if (settings.header == zlib_header_t) {
+                segment.adler32 = util::adler32(segment_begin, segment_size, 0u);
+            }
+        }
+    });
+
+    // Stitch segments into the destination
+    uint32_t header_size  = 0u;
+    uint32_t trailer_size = 0u;
+
+    if (settings.header == gzip_header_t) {
+        header_size  = OWN_GZIP_HEADER_LENGTH;
+        trailer_size = sizeof(gzip_decorator::gzip_trailer);
+    } else if (settings.header == zlib_header_t) {
+        header_size  = zlib_sizes::zlib_header_size;
+        trailer_size = zlib_sizes::zlib_trailer_size;
+    }
+
+    uint64_t stream_size = header_size + trailer_size;
+
+    for (uint32_t i = 0u; i < segments_count; i++) {
+        if (segments[i].status_code) {
+            result.status_code_ = segments[i].status_code;
+
+            return result;
+        }
+
+        stream_size += segments[i].output_size;
+    }
+
+    if (stream_size > output_size) {
+        result.status_code_ = status_list::more_output_needed;
+
+        return result;
+    }
+
+    if (settings.header == gzip_header_t) {
+        gzip_decorator::write_header_unsafe(output_begin, output_size);
+    } else if (settings.header == zlib_header_t) {
+        zlib_decorator::write_header_unsafe(output_begin);
+    }
+
+    uint8_t  *deflate_begin = output_begin + header_size;
+    uint8_t  *current_ptr   = deflate_begin;
+    uint32_t crc32          = segments[0].crc32;
+    uint32_t adler32        = segments[0].adler32;
+
+    for (uint32_t i = 0u; i < segments_count; i++) {
+        core_sw::util::copy(segments[i].output_ptr, segments[i].output_ptr + segments[i].output_size, current_ptr);
+        current_ptr += segments[i].output_size;
+
+        if (0u != i) {
+            const uint32_t segment_size = std::min(parallel_deflate_segment_size, size - i * parallel_deflate_segment_size);
+
+            crc32   = util::crc32_gzip_combine(crc32, segments[i].crc32, segment_size);
+            adler32 = util::adler32_combine(adler32, segments[i].adler32, segment_size);
+        }
+    }
+
+    if (settings.is_verification_enabled) {
+        auto verify_state = verification_state_builder<execution_path_t::software>::create(allocator).build();
+
+        verify_state.input(deflate_begin, current_ptr)
+                    .required_crc(crc32);
+
+        auto verification_result = perform_verification<execution_path_t::software,
+                                                        verification_mode_t::verify_deflate_default>(verify_state);
+
+        if (verification_result.status == parser_status_t::error) {
+            result.status_code_ = status_list::verify_error;
+
+            return result;
+        }
+    }
+
+    if (settings.header == gzip_header_t) {
+        gzip_decorator::gzip_trailer trailer{crc32, size};
+
+        gzip_decorator::write_trailer_unsafe(current_ptr, trailer_size, trailer);
+    } else if (settings.header == zlib_header_t) {
+        const uint32_t zlib_trailer = swap_bytes((adler32 & util::most_significant_16_bits) |
+                                                 ((adler32 & util::least_significant_16_bits) + 1u) %
+                                                 util::adler32_mod);
+
+        zlib_decorator::write_trailer_unsafe(current_ptr, zlib_trailer);
+    }
+
+    result.status_code_        = status_list::ok;
+    result.completed_bytes_    = size;
+    result.output_bytes_       = static_cast<uint32_t>(stream_size);
+    result.checksums_.crc32_   = crc32;
+    result.checksums_.adler32_ = adler32;
+
+    return result;
+}
+
+} // namespace qpl::ml::compression
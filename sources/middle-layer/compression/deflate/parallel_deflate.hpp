@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Multi-threaded software deflate of a single stream
+ */
+
+#ifndef QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
+#define QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
+
+#include "common/defs.hpp"
+#include "common/linear_allocator.hpp"
+#include "compression/compression_defs.hpp"
+#include "compression/deflate/utils/compression_defs.hpp"
+
+#include "util/util.hpp"
+
+struct qpl_compression_huffman_table;
+
+namespace qpl::ml::compression {
+
+/**
+ * Size of the source piece compressed by one thread
+ */
+constexpr uint32_t parallel_deflate_segment_size = 256_kb;
+
+/**
+ * Size of the source data preceding a segment that is used to prime its match history
+ */
+constexpr uint32_t parallel_deflate_history_size = 32_kb;
+
+struct parallel_deflate_settings_t {
+    compression_level_t           level            = default_level;
+    compression_mode_t            mode             = fixed_mode;
+    header_t                      header           = no_header_t;
+    qpl_compression_huffman_table *huffman_table   = nullptr;
+    uint32_t                      threads_count    = 1u;
+    bool                          is_verification_enabled = true;
+    uint32_t                      incompressible_threshold = 0u;
+};
+
+/**
+ * @brief Compresses the source into a single deflate stream using several threads
+ *
+ * The source is split into segments of @ref parallel_deflate_segment_size bytes. Every segment is compressed
+ * independently with its match history primed by the preceding @ref parallel_deflate_history_size bytes and
+ * terminated at a byte boundary with an empty stored block, so compressed segments can be concatenated
+ * into a valid stream. Checksums of the segments are combined into the checksums of the whole source.
+ *
+ * @param begin          source to compress
+ * @param size           source size
+ * @param output_begin   destination for the stream (including gzip/zlib wrapper if requested)
+ * @param output_size    destination size
+ * @param settings       compression parameters
+ * @param allocator      allocator used for the verification state
+ */
+auto deflate_parallel(uint8_t *begin,
+                      uint32_t size,
+                      uint8_t *output_begin,
+                      uint32_t output_size,
+                      const parallel_deflate_settings_t &settings,
+                      const util::linear_allocator &allocator) noexcept -> compression_operation_result_t;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
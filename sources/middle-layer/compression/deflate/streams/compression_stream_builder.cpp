@@ -82,6 +82,14 @@ void deflate_state_builder<execution_path_t::software>::init() noexcept {
     stream_.isal_stream_ptr_->end_of_stream = stream_.is_last_chunk();
 
     stream_.isal_stream_ptr_->hist_bits = isal_history_size_boundary;
+
+    // Matches can refer to any byte of the dictionary larger than 4k, so the whole deflate window is used
+    if (stream_.dictionary_ptr_ != nullptr &&
+        stream_.dictionary_ptr_->raw_dictionary_size > max_history_size &&
+        stream_.compression_level() == default_level) {
+        stream_.isal_stream_ptr_->hist_bits = isal_history_size_max;
+    }
+
     isal_state->mb_mask                 = (1u << (qpl_mblk_size_32k + 8u)) - 1;
 
     isal_state->dist_mask = util::build_mask<uint32_t>(stream_.isal_stream_ptr_->hist_bits);
@@ -101,8 +109,19 @@ auto deflate_state_builder<execution_path_t::software>::dictionary(qpl_dictionar
                           static_cast<uint32_t>(dictionary.raw_dictionary_size));
     stream_.isal_stream_ptr_->internal_state.max_dist = static_cast<uint32_t>(dictionary.raw_dictionary_size);
     stream_.dictionary_support_ = dictionary_support_t::enabled;
+    stream_.dictionary_ptr_     = &dictionary;
 
     return *reinterpret_cast<common_type *>(this);
 };
 
+auto deflate_state_builder<execution_path_t::software>::history(uint8_t *history_ptr,
+                                                                uint32_t history_size) noexcept -> common_type & {
+    // Raw history is loaded the same way as a dictionary, so matches can refer to the data preceding the source
+    isal_deflate_set_dict(stream_.isal_stream_ptr_, history_ptr, history_size);
+    stream_.isal_stream_ptr_->internal_state.max_dist = history_size;
+    stream_.dictionary_support_ = dictionary_support_t::enabled;
+
+    return *reinterpret_cast<common_type *>(this);
+}
+
 } // namespace qpl::ml::compression
@@ -108,12 +108,20 @@ public:
 
     auto dictionary(qpl_dictionary &dictionary) noexcept -> common_type &;
 
+    auto history(uint8_t *history_ptr, uint32_t history_size) noexcept -> common_type &;
+
     auto verify(bool value) noexcept -> common_type & {
         stream_.is_verification_enabled_ = value;
 
         return *reinterpret_cast<common_type *>(this);
     }
 
+    auto incompressible_threshold(uint32_t value) noexcept -> common_type & {
+        stream_.incompressible_threshold_ = (value != 0u) ? value : incompressible_default_threshold;
+
+        return *reinterpret_cast<common_type *>(this);
+    }
+
 protected:
     auto set_isal_internal_buffers(uint8_t *const level_buffer_ptr,
                                    const uint32_t level_buffer_size,
@@ -11,6 +11,28 @@
 #include "deflate_hash_table.h"
 
 namespace qpl::ml::compression {
+
+namespace {
+/**
+ * Match search depth of the levels compressed by the lazy matcher, the same parameters as zlib uses:
+ * number of hash chain attempts, and match lengths to shorten the search, to stop it, and to skip lazy evaluation
+ */
+struct match_search_parameters_t {
+    uint32_t attempts;
+    uint32_t good_match;
+    uint32_t nice_match;
+    uint32_t lazy_match;
+};
+
+constexpr auto get_match_search_parameters(compression_level_t level) noexcept -> match_search_parameters_t {
+    if (level == level_2) {
+        return {32u, 8u, 32u, 16u};
+    }
+
+    return {4096u, 32u, 258u, 258u};
+}
+}
+
 void deflate_state<execution_path_t::software>::set_source(uint8_t *begin, uint32_t size) noexcept {
     isal_stream_ptr_->next_in  = begin;
     isal_stream_ptr_->avail_in = size;
@@ -44,18 +66,20 @@ void deflate_state<execution_path_t::software>::reset_match_history() noexcept {
 
     auto level_buffer = reinterpret_cast<level_buf *>(isal_stream_ptr_->level_buf);
 
-    if (compression_level() == high_level) {
+    if (compression_level() != default_level) {
         hash_table_.hash_table_ptr = reinterpret_cast<uint32_t *>(level_buffer->hash_map.hash_table);
         hash_table_.hash_story_ptr = hash_table_.hash_table_ptr + high_hash_table_size;
 
         if (isal_stream_ptr_->total_in == 0) {
             deflate_hash_table_reset(&hash_table_);
 
+            const auto parameters = get_match_search_parameters(compression_level());
+
             hash_table_.hash_mask  = util::build_mask<uint32_t, 12u>();
-            hash_table_.attempts   = 4096u;
-            hash_table_.good_match = 32u;
-            hash_table_.nice_match = 258u;
-            hash_table_.lazy_match = 258u;
+            hash_table_.attempts   = parameters.attempts;
+            hash_table_.good_match = parameters.good_match;
+            hash_table_.nice_match = parameters.nice_match;
+            hash_table_.lazy_match = parameters.lazy_match;
         }
     } else {
         auto isal_state   = &isal_stream_ptr_->internal_state;
@@ -14,6 +14,7 @@
 #include "compression/deflate/containers/index_table.hpp"
 #include "compression/compression_defs.hpp"
 #include "compression/deflate/utils/compression_defs.hpp"
+#include "compression/dictionary/dictionary_defs.hpp"
 
 #include "util/util.hpp"
 
@@ -118,12 +119,14 @@ protected:
     index_table_t        index_table_       = {};
     compression_level_t    level_                   = default_level;
     dictionary_support_t   dictionary_support_      = dictionary_support_t::disabled;
+    qpl_dictionary         *dictionary_ptr_         = nullptr;
     BitBuf2                *bit_buffer_ptr          = nullptr;
     bool                   start_new_block_         = false;
     uint8_t                *source_begin_ptr_       = nullptr;
     uint32_t               source_size_             = 0;
     uint32_t               ignore_start_bits_       = 0;
     uint32_t               total_bytes_written_     = 0;
+    uint32_t               incompressible_threshold_ = incompressible_default_threshold;
 
     // Verification
     bool                   is_verification_enabled_   = false;
@@ -224,8 +227,15 @@ private:
                             uint8_t *dictionary_ptr,
                             uint32_t dictionary_size) noexcept;
 
+    friend auto probe_incompressible_block(deflate_state<execution_path_t::software> &stream,
+                                           compression_state_t &state) noexcept -> qpl_ml_status;
+
     friend auto recover_and_write_stored_blocks(deflate_state<execution_path_t::software> &stream,
                                                 compression_state_t &state) noexcept -> qpl_ml_status;
+
+    friend auto compress_segment(deflate_state<execution_path_t::software> &stream,
+                                 uint8_t *begin,
+                                 uint32_t size) noexcept -> compression_operation_result_t;
 };
 
 } // namespace qpl::ml::compression
@@ -99,6 +99,11 @@ struct chunk_type {
  */
 constexpr uint32_t isal_history_size_boundary = 12u;
 
+/**
+ * Number of bits of the full deflate window, used when the loaded dictionary is larger than 4k
+ */
+constexpr uint32_t isal_history_size_max = 15u;
+
 /**
  * Size of hash table that is used during match searching
  */
@@ -119,6 +124,27 @@ constexpr uint32_t bit_buffer_slope_bits         = bit_buffer_slope_bytes * byte
 constexpr uint32_t end_of_block_code_index       = 256;
 constexpr uint32_t minimal_mini_block_size_power = 8;
 
+/**
+ * Largest part of the source that is stored at once if its sample looks incompressible, fits a single stored block
+ */
+constexpr uint32_t incompressible_probe_block_size = stored_block_max_length;
+
+/**
+ * Parts of the source smaller than this are always compressed, a stored block doesn't save time for them
+ */
+constexpr uint32_t incompressible_probe_min_size = 1024u;
+
+/**
+ * The sample consists of several segments spread over the probed part of the source
+ */
+constexpr uint32_t incompressible_probe_segments     = 8u;
+constexpr uint32_t incompressible_probe_segment_size = 512u;
+
+/**
+ * Estimated compressed size, in percent of the probed size, starting from which the data is stored
+ */
+constexpr uint32_t incompressible_default_threshold = 97u;
+
 constexpr std::array<uint8_t, 19> code_length_code_order = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5,
                                                             11, 4, 12, 3, 13, 2, 14, 1, 15};
 
@@ -9,9 +9,20 @@
  *  Middle Layer API (private C++ API)
  */
 
+#include <algorithm>
+
 #include "dictionary_utils.hpp"
 #include "simple_memory_ops.hpp"
 
+#include "igzip_lib.h"
+
+extern "C" {
+extern void isal_deflate_hash_lvl0(uint16_t *hash_table, uint32_t hash_mask, uint32_t current_index,
+                                   uint8_t *dict, uint32_t dict_len);
+extern void isal_deflate_hash_lvl3(uint16_t *hash_table, uint32_t hash_mask, uint32_t current_index,
+                                   uint8_t *dict, uint32_t dict_len);
+}
+
 namespace qpl::ml::compression {
 
 constexpr uint32_t software_hash_table_size[] = {
@@ -40,10 +51,61 @@ constexpr uint32_t hardware_hash_table_size[] = {
         0
 };
 
+/**
+ * Level of ISA-L compression which hash table is prebuilt for the given software level,
+ * the table of level 0 is used by fixed and static compression, the table of level 3 is used by dynamic one.
+ * Other levels keep the table reserved, and the dictionary is hashed by each compression job
+ */
+static inline auto get_hash_table_isal_level(software_compression_level sw_level) noexcept -> int32_t {
+    switch (sw_level) {
+        case software_compression_level::LEVEL_0:
+        case software_compression_level::LEVEL_1:
+            return 0;
+        case software_compression_level::LEVEL_2:
+        case software_compression_level::LEVEL_3:
+            return 3;
+        default:
+            return dict_none;
+    }
+}
+
+static inline auto get_hash_table_size(int32_t isal_level) noexcept -> uint32_t {
+    return (isal_level == 3) ? IGZIP_LVL3_HASH_SIZE : IGZIP_LVL0_HASH_SIZE;
+}
+
+static void build_software_hash_table(qpl_dictionary &dictionary) noexcept {
+    const auto isal_level = get_hash_table_isal_level(dictionary.sw_level);
+
+    if (dict_none == isal_level) {
+        return;
+    }
+
+    auto *hash_table_ptr = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(&dictionary) +
+                                                        dictionary.sw_hash_table_offset);
+    const uint32_t hash_table_size = get_hash_table_size(isal_level);
+
+    // Same state as isal_deflate_hash() creates for the first job, so indices are relative to the source beginning
+    std::fill(hash_table_ptr, hash_table_ptr + hash_table_size, UINT16_MAX);
+
+    if (isal_level == 3) {
+        isal_deflate_hash_lvl3(hash_table_ptr,
+                               hash_table_size - 1u,
+                               0u,
+                               get_dictionary_data(dictionary),
+                               static_cast<uint32_t>(dictionary.raw_dictionary_size));
+    } else {
+        isal_deflate_hash_lvl0(hash_table_ptr,
+                               hash_table_size - 1u,
+                               0u,
+                               get_dictionary_data(dictionary),
+                               static_cast<uint32_t>(dictionary.raw_dictionary_size));
+    }
+}
+
 auto get_dictionary_size(software_compression_level sw_level,
                          hardware_compression_level hw_level,
                          size_t raw_dictionary_size) noexcept -> size_t {
-    raw_dictionary_size = std::min(raw_dictionary_size, static_cast<size_t>(max_history_size));
+    raw_dictionary_size = std::min(raw_dictionary_size, static_cast<size_t>(max_dictionary_size));
     size_t result_size = raw_dictionary_size + sizeof(qpl_dictionary);
 
     if (software_compression_level::SW_NONE != sw_level) {
@@ -82,11 +144,11 @@ auto build_dictionary(qpl_dictionary &dictionary,
 
     dictionary.raw_dictionary_offset = current_offset;
 
-    if (raw_dict_size > max_history_size) {
-        // In case when passed dictionary is larger than 4k
-        // Build dictionary from last 4k bytes
-        raw_dict_ptr += (raw_dict_size - max_history_size);
-        raw_dict_size = max_history_size;
+    if (raw_dict_size > max_dictionary_size) {
+        // In case when passed dictionary is larger than the deflate window (32k)
+        // Build dictionary from last 32k bytes
+        raw_dict_ptr += (raw_dict_size - max_dictionary_size);
+        raw_dict_size = max_dictionary_size;
     }
 
     dictionary.raw_dictionary_size = raw_dict_size;
@@ -95,10 +157,29 @@ auto build_dictionary(qpl_dictionary &dictionary,
                         raw_dict_ptr + raw_dict_size,
                         reinterpret_cast<uint8_t *>(&dictionary) + current_offset);
 
+    if (software_compression_level::SW_NONE != sw_level) {
+        build_software_hash_table(dictionary);
+    }
+
     return status_list::ok;
 }
 
 auto get_dictionary_data(qpl_dictionary &dictionary) noexcept -> uint8_t * {
     return (reinterpret_cast<uint8_t *>(&dictionary) + dictionary.raw_dictionary_offset);
 }
+
+auto get_dictionary_hash_table(qpl_dictionary &dictionary,
+                               uint32_t isal_level,
+                               uint32_t hash_mask) noexcept -> const uint16_t * {
+    const auto table_level = get_hash_table_isal_level(dictionary.sw_level);
+
+    if (dict_none == table_level ||
+        static_cast<uint32_t>(table_level) != isal_level ||
+        get_hash_table_size(table_level) - 1u != hash_mask) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const uint16_t *>(reinterpret_cast<uint8_t *>(&dictionary) +
+                                              dictionary.sw_hash_table_offset);
+}
 }
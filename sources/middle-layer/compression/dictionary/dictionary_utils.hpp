@@ -27,6 +27,14 @@ auto build_dictionary(qpl_dictionary &dictionary,
                       size_t raw_dict_size) noexcept -> qpl_ml_status;
 
 auto get_dictionary_data(qpl_dictionary &dictionary) noexcept -> uint8_t *;
+
+/**
+ * @brief Returns the software hash table prebuilt for the dictionary,
+ *        or nullptr if the table doesn't match ISA-L level and hash mask of the compression
+ */
+auto get_dictionary_hash_table(qpl_dictionary &dictionary,
+                               uint32_t isal_level,
+                               uint32_t hash_mask) noexcept -> const uint16_t *;
 }
 
 #endif // QPL_COMPRESSION_DICTIONARY_DICTIONARY_UTILS_HPP_
@@ -32,6 +32,12 @@ auto compress_huffman_only(uint8_t *begin,
                            const uint32_t size,
                            stream_t &stream) noexcept -> compression_operation_result_t;
 
+/**
+ * @brief Builds the multi-symbol lookup table used by the software Huffman only decompression
+ */
+void build_huffman_only_decode_table(const qplc_huffman_table_flat_format &huffman_table,
+                                     huffman_only_decode_table &decode_table) noexcept;
+
 template <execution_path_t path>
 auto decompress_huffman_only(huffman_only_decompression_state<path> &decompression_state,
                              decompression_huffman_table &decompression_table) noexcept -> decompression_operation_result_t;
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <cstring>
+
 #include "huffman_only.hpp"
 #include "common/bit_reverse.hpp"
 #include "util/util.hpp"
@@ -43,37 +45,105 @@ static void restore_huffman_table(
     }
 }
 
-static void build_lookup_table(
-        const std::array<huffman_code, huffman_only_number_of_literals> &huffman_table,
-        uint8_t *lookup_table_ptr) noexcept {
-    // Main cycle
-    for (uint16_t symbol = 0u; symbol < huffman_table.size(); symbol++) {
-        const uint8_t  code_length             = huffman_table[symbol].length;
-        const uint8_t  offset                  = 16u - code_length;
-        const uint16_t code                    = reverse_bits(huffman_table[symbol].code, code_length);
-        const uint16_t low_lookup_table_index  = 0u;
-        const uint16_t high_lookup_table_index = util::build_mask<uint16_t>(offset);
-
-        if (0u == code_length) {
+static inline auto decode_long_code(const huffman_only_decode_table &decode_table,
+                                    uint16_t next_bits,
+                                    uint8_t &symbol) noexcept -> uint8_t {
+    // Codes are stored starting from the most significant bit
+    const uint16_t reversed_bits = reverse_bits(next_bits, huffman_code_bit_length);
+
+    for (uint32_t code_length = huffman_only_decode_bits + 1u; code_length <= huffman_code_bit_length; code_length++) {
+        const uint32_t code       = reversed_bits >> (huffman_code_bit_length - code_length);
+        const uint32_t code_index = code - decode_table.first_codes[code_length - 1u];
+
+        if (code_index < decode_table.number_of_codes[code_length - 1u]) {
+            symbol = decode_table.index_to_char[decode_table.first_table_indexes[code_length - 1u] + code_index];
+
+            return static_cast<uint8_t>(code_length);
+        }
+    }
+
+    return 0u;
+}
+
+void build_huffman_only_decode_table(const qplc_huffman_table_flat_format &huffman_table,
+                                     huffman_only_decode_table &decode_table) noexcept {
+    constexpr uint32_t decode_table_size = 1u << huffman_only_decode_bits;
+
+    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table{};
+
+    restore_huffman_table(huffman_table, restored_huffman_table);
+
+    core_sw::util::set_zeros(decode_table.entries, decode_table_size);
+
+    // Filling the entries with the first literal
+    for (uint32_t symbol = 0u; symbol < huffman_only_number_of_literals; symbol++) {
+        const uint8_t code_length = restored_huffman_table[symbol].length;
+
+        decode_table.code_lengths[symbol] = code_length;
+
+        if (0u == code_length || code_length > huffman_only_decode_bits) {
             continue;
         }
 
-        // Filling lookup table
-        for (uint32_t i = low_lookup_table_index; i < high_lookup_table_index + 1u; i++) {
-            const uint16_t symbol_position = (i << code_length) | code;
+        const uint16_t code = reverse_bits(restored_huffman_table[symbol].code, code_length);
 
-            lookup_table_ptr[symbol_position] = (uint8_t) symbol;
+        for (uint32_t index = code; index < decode_table_size; index += (1u << code_length)) {
+            decode_table.symbols[index] = symbol;
+            decode_table.entries[index] = static_cast<uint8_t>((1u << 4u) | code_length);
         }
     }
+
+    // Appending the literals which codes fit into the rest of the index. Entries are processed from the end,
+    // so the entries for the rest of the index (which is always lower) still contain a single literal
+    for (uint32_t index = decode_table_size; index-- > 0u;) {
+        uint32_t symbols      = 0u;
+        uint32_t symbol_count = 0u;
+        uint32_t total_length = 0u;
+
+        while (symbol_count < huffman_only_max_symbols_per_lookup) {
+            const uint32_t rest_index  = index >> total_length;
+            const uint32_t code_length = decode_table.entries[rest_index] & 0x0Fu;
+
+            if (0u == code_length || total_length + code_length > huffman_only_decode_bits) {
+                break;
+            }
+
+            symbols      |= (decode_table.symbols[rest_index] & 0xFFu) << (symbol_count * byte_bits_size);
+            total_length += code_length;
+            symbol_count++;
+        }
+
+        if (symbol_count > 1u) {
+            decode_table.symbols[index] = symbols;
+            decode_table.entries[index] = static_cast<uint8_t>((symbol_count << 4u) | total_length);
+        }
+    }
+
+    // Long codes are decoded using canonical representation
+    core_sw::util::copy(huffman_table.first_codes,
+                        huffman_table.first_codes + QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE,
+                        decode_table.first_codes);
+    core_sw::util::copy(huffman_table.number_of_codes,
+                        huffman_table.number_of_codes + QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE,
+                        decode_table.number_of_codes);
+    core_sw::util::copy(huffman_table.first_table_indexes,
+                        huffman_table.first_table_indexes + QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE,
+                        decode_table.first_table_indexes);
+    core_sw::util::copy(huffman_table.index_to_char,
+                        huffman_table.index_to_char + QPLC_INDEX_TO_CHAR_TABLE_SIZE,
+                        decode_table.index_to_char);
+
+    decode_table.is_built = true;
 }
 
 static auto perform_huffman_only_decompression(
         bit_reader &reader,
         uint8_t *destination_ptr,
         uint32_t destination_length,
-        const uint8_t *lookup_table_ptr,
-        const std::array<huffman_code, huffman_only_number_of_literals> &huffman_table,
+        const huffman_only_decode_table &decode_table,
         bool forse_flush_last_bits) noexcept -> decompression_operation_result_t {
+    constexpr uint16_t decode_mask = (1u << huffman_only_decode_bits) - 1u;
+
     // Main cycle
     uint32_t current_symbol_index = 0u;
 
@@ -90,18 +160,42 @@ static auto perform_huffman_only_decompression(
             break;
         }
 
-        // Decoding next symbol
+        // Decoding next symbols
         const uint16_t next_bits = reader.peak_bits(huffman_code_bit_length);
 
         if (forse_flush_last_bits || !reader.is_overflowed()) {
-            const uint8_t  symbol                     = lookup_table_ptr[next_bits];
-            const uint8_t  current_symbol_code_length = huffman_table[symbol].length;
+            const uint32_t index        = next_bits & decode_mask;
+            const uint32_t entry        = decode_table.entries[index];
+            const uint32_t symbol_count = entry >> 4u;
+            const uint32_t total_length = entry & 0x0Fu;
+
+            if (symbol_count > 1u &&
+                reader.get_buffer_bit_count() >= total_length &&
+                destination_length - current_symbol_index >= huffman_only_max_symbols_per_lookup) {
+                // Several literals at once, only symbol_count of the written bytes are valid
+                std::memcpy(destination_ptr + current_symbol_index, &decode_table.symbols[index], sizeof(uint32_t));
+
+                reader.shift_bits(static_cast<uint8_t>(total_length));
+                current_symbol_index += symbol_count;
+            } else {
+                uint8_t symbol                     = static_cast<uint8_t>(decode_table.symbols[index]);
+                uint8_t current_symbol_code_length = decode_table.code_lengths[symbol];
+
+                if (0u == symbol_count) {
+                    current_symbol_code_length = decode_long_code(decode_table, next_bits, symbol);
 
-            // Shifting bit buffer by code length
-            reader.shift_bits(current_symbol_code_length);
+                    if (0u == current_symbol_code_length) {
+                        result.status_code_ = status_list::bad_literal_code_error;
+                        break;
+                    }
+                }
 
-            // Writing symbol to output
-            destination_ptr[current_symbol_index++] = symbol;
+                // Shifting bit buffer by code length
+                reader.shift_bits(current_symbol_code_length);
+
+                // Writing symbol to output
+                destination_ptr[current_symbol_index++] = symbol;
+            }
 
             if (forse_flush_last_bits) {
                 decode_next_symbol = !reader.is_overflowed() || 
@@ -123,8 +217,6 @@ template <>
 auto decompress_huffman_only<execution_path_t::software>(
         huffman_only_decompression_state<execution_path_t::software> &decompression_state,
         decompression_huffman_table &decompression_table) noexcept -> decompression_operation_result_t {
-    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table;
-
     const auto *source_ptr = decompression_state.get_fields().current_source_ptr;
     const auto *source_end_ptr = source_ptr + decompression_state.get_fields().source_available;
 
@@ -136,10 +228,16 @@ auto decompress_huffman_only<execution_path_t::software>(
 
     bit_reader reader(source_ptr, source_end_ptr);
 
-    // Restore huffman table and build the lookup table
-    restore_huffman_table(*decompression_table.get_sw_decompression_table(), restored_huffman_table);
+    // The lookup table is built along with the Huffman table, otherwise it is built in the state buffer
+    const huffman_only_decode_table *decode_table_ptr = decompression_table.get_huffman_only_decode_table();
 
-    build_lookup_table(restored_huffman_table, decompression_state.get_lookup_table());
+    if (nullptr == decode_table_ptr || !decode_table_ptr->is_built) {
+        auto *state_decode_table_ptr = reinterpret_cast<huffman_only_decode_table *>(decompression_state.get_lookup_table());
+
+        build_huffman_only_decode_table(*decompression_table.get_sw_decompression_table(), *state_decode_table_ptr);
+
+        decode_table_ptr = state_decode_table_ptr;
+    }
 
     decompression_operation_result_t result{};
 
@@ -148,8 +246,7 @@ auto decompress_huffman_only<execution_path_t::software>(
         result = perform_huffman_only_decompression(reader,
                                                     destination_ptr,
                                                     available_out,
-                                                    decompression_state.get_lookup_table(),
-                                                    restored_huffman_table,
+                                                    *decode_table_ptr,
                                                     true);
 
         result.completed_bytes_ = reader.get_total_bytes_read();
@@ -201,19 +298,18 @@ auto decompress_huffman_only<execution_path_t::software>(
             auto iteration_result = perform_huffman_only_decompression(reader,
                                                                        destination_ptr,
                                                                        available_out,
-                                                                       decompression_state.get_lookup_table(),
-                                                                       restored_huffman_table,
+                                                                       *decode_table_ptr,
                                                                        is_last_chunk);
 
             destination_ptr += iteration_result.output_bytes_;
             available_out   -= iteration_result.output_bytes_;
             result.output_bytes_    += iteration_result.output_bytes_;
+            total_bytes_read        += reader.get_total_bytes_read();
 
-            if (result.status_code_ != status_list::ok) {
+            if (iteration_result.status_code_ != status_list::ok) {
+                result.status_code_ = iteration_result.status_code_;
                 break;
             }
-
-            total_bytes_read += reader.get_total_bytes_read();
         }
 
         result.completed_bytes_ = total_bytes_read;
@@ -11,6 +11,7 @@
 #include "common/defs.hpp"
 #include "common/linear_allocator.hpp"
 #include "compression/deflate/utils/compression_defs.hpp"
+#include "compression/huffman_table/inflate_huffman_table.hpp"
 #include "hw_aecs_api.h"
 #include "hw_descriptors_api.h"
 
@@ -20,7 +21,8 @@ template <execution_path_t path>
 class huffman_only_decompression_state;
 
 constexpr uint32_t huffman_only_be_buffer_size    = 4096;
-constexpr uint32_t huffman_only_lookup_table_size = 0xFFFF;
+// Used when the decompression table doesn't hold a prebuilt lookup table (e.g. on verification)
+constexpr uint32_t huffman_only_lookup_table_size = sizeof(huffman_only_decode_table);
 
 template <>
 class huffman_only_decompression_state<execution_path_t::software> {
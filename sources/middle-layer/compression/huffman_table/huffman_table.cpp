@@ -18,6 +18,7 @@
 #include "compression/huffman_table/inflate_huffman_table.hpp"
 #include "util/util.hpp"
 #include "compression/huffman_table/huffman_table_utils.hpp" // qpl::ml::compression qpl_triplet
+#include "compression/huffman_table/serialization_utils.hpp"
 
 namespace qpl::ml::compression {
 
@@ -135,6 +136,48 @@ qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::create(huf
     return status_list::ok;
 }
 
+// function to create table object on top of the tables stored in the stream serialized for in-place usage,
+// the memory of tables is neither copied nor owned by the object
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::create_in_place(huffman_table_type_e type,
+                                                          execution_path_t path,
+                                                          allocator_t allocator,
+                                                          uint8_t *const tables_buffer) noexcept {
+    constexpr uint32_t algorithm_flag = (algorithm == compression_algorithm_e::deflate)
+                                        ? QPL_DEFLATE_REPRESENTATION
+                                        : QPL_HUFFMAN_ONLY_REPRESENTATION;
+
+    m_meta.algorithm = algorithm;
+    m_meta.type      = type;
+    m_meta.path      = path;
+    m_meta.flags     = details::get_path_flags(path) | algorithm_flag;
+    m_meta.version   = LAST_VERSION;
+
+    m_allocator.allocator   = allocator.allocator;
+    m_allocator.deallocator = allocator.deallocator;
+
+    m_c_huffman_table = (type != huffman_table_type_e::decompression) ? tables_buffer : nullptr;
+    m_d_huffman_table = (type != huffman_table_type_e::compression)
+                        ? tables_buffer + serialization::get_in_place_decompression_table_offset(type)
+                        : nullptr;
+
+    m_is_initialized = true;
+
+    return status_list::ok;
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::create_in_place(huffman_table_type_e type,
+                                                                                 execution_path_t path,
+                                                                                 allocator_t allocator,
+                                                                                 uint8_t *const tables_buffer) noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::create_in_place(huffman_table_type_e type,
+                                                                                      execution_path_t path,
+                                                                                      allocator_t allocator,
+                                                                                      uint8_t *const tables_buffer) noexcept;
+
 template <compression_algorithm_e algorithm>
 qpl_ml_status huffman_table_t<algorithm>::init(const qpl_histogram &histogram_ptr) noexcept {
     if (m_c_huffman_table) {
@@ -352,6 +395,187 @@ qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::write_to_stream
 template
 qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::write_to_stream(uint8_t *buffer) const noexcept;
 
+// function to initialize compression and decompression tables from the code lengths
+// stored in compact format, all representations are rebuilt here
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::init_with_compact_stream(const uint8_t *const buffer,
+                                                                   const size_t buffer_size) noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        auto status = compression::huffman_table_init_with_compact_stream(*c_table, buffer, buffer_size, m_meta.flags);
+        if (status) {
+            return status;
+        }
+    }
+
+    if (m_d_huffman_table) {
+        auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+        if (m_c_huffman_table) {
+            auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+            auto status = compression::huffman_table_convert(*c_table, *d_table, m_meta.flags);
+            if (status) {
+                return status;
+            }
+        } else {
+            // decompression table is built from the temporary compression one
+            allocator_t table_allocator = details::get_allocator(m_allocator);
+
+            auto temporary_buffer = table_allocator.allocator(sizeof(qpl_compression_huffman_table));
+            if (!temporary_buffer) {
+                return status_list::nullptr_error;
+            }
+
+            memset(temporary_buffer, 0u, sizeof(qpl_compression_huffman_table));
+
+            auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(temporary_buffer);
+
+            auto status = compression::huffman_table_init_with_compact_stream(*c_table, buffer, buffer_size, m_meta.flags);
+            if (!status) {
+                status = compression::huffman_table_convert(*c_table, *d_table, m_meta.flags);
+            }
+
+            table_allocator.deallocator(temporary_buffer);
+
+            if (status) {
+                return status;
+            }
+        }
+    }
+
+    m_is_initialized = true;
+
+    return status_list::ok;
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::init_with_compact_stream(const uint8_t *const buffer,
+                                                                                          const size_t buffer_size) noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::init_with_compact_stream(const uint8_t *const buffer,
+                                                                                               const size_t buffer_size) noexcept;
+
+// function to write code lengths of the table in compact format,
+// deflate header is the same in compression and decompression tables
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::write_to_compact_stream(uint8_t *const buffer) const noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        return compression::huffman_table_write_to_compact_stream(*c_table, buffer);
+    }
+
+    auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+    return compression::huffman_table_write_to_compact_stream(*d_table, buffer);
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::write_to_compact_stream(uint8_t *const buffer) const noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::write_to_compact_stream(uint8_t *const buffer) const noexcept;
+
+template <compression_algorithm_e algorithm>
+size_t huffman_table_t<algorithm>::get_compact_stream_size() const noexcept {
+    auto deflate_header_buffer_ptr = (m_c_huffman_table)
+                                     ? &reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table)->deflate_header_buffer
+                                     : &reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table)->deflate_header_buffer;
+
+    return serialization::compact_table_size(*reinterpret_cast<const deflate_header *>(deflate_header_buffer_ptr));
+}
+
+template
+size_t huffman_table_t<compression_algorithm_e::deflate>::get_compact_stream_size() const noexcept;
+
+template
+size_t huffman_table_t<compression_algorithm_e::huffman_only>::get_compact_stream_size() const noexcept;
+
+// function to copy aligned images of compression and decompression tables
+// from the stream serialized for in-place usage
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::init_with_in_place_stream(const uint8_t *const buffer) noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        auto status = compression::huffman_table_init_with_in_place_stream(*c_table, buffer);
+        if (status) {
+            return status;
+        }
+    }
+
+    if (m_d_huffman_table) {
+        auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+        auto status = compression::huffman_table_init_with_in_place_stream(*d_table,
+                                                                           buffer + serialization::get_in_place_decompression_table_offset(m_meta.type));
+        if (status) {
+            return status;
+        }
+    }
+
+    m_is_initialized = true;
+
+    return status_list::ok;
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::init_with_in_place_stream(const uint8_t *const buffer) noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::init_with_in_place_stream(const uint8_t *const buffer) noexcept;
+
+// function to write aligned images of compression and decompression tables,
+// so that they could be used directly from the memory of the stream
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::write_to_in_place_stream(uint8_t *const buffer) const noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        auto status = compression::huffman_table_write_to_in_place_stream(*c_table, buffer);
+        if (status) {
+            return status;
+        }
+    }
+
+    if (m_d_huffman_table) {
+        auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+        auto status = compression::huffman_table_write_to_in_place_stream(*d_table,
+                                                                          buffer + serialization::get_in_place_decompression_table_offset(m_meta.type));
+        if (status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::write_to_in_place_stream(uint8_t *const buffer) const noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::write_to_in_place_stream(uint8_t *const buffer) const noexcept;
+
 template<> template<>
 uint8_t *huffman_table_t<compression_algorithm_e::deflate>::compression_huffman_table<execution_path_t::software>() const noexcept {
     return m_c_huffman_table;
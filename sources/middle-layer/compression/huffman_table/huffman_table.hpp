@@ -63,6 +63,11 @@ public:
 
     [[nodiscard]] qpl_ml_status create(huffman_table_type_e type, execution_path_t path, allocator_t allocator);
 
+    [[nodiscard]] qpl_ml_status create_in_place(huffman_table_type_e type,
+                                                execution_path_t path,
+                                                allocator_t allocator,
+                                                uint8_t *const tables_buffer) noexcept;
+
     [[nodiscard]] qpl_ml_status init(const qpl_histogram &histogram_ptr) noexcept;
     [[nodiscard]] qpl_ml_status init(const qpl_triplet *triplet_ptr, const size_t count) noexcept;
     [[nodiscard]] qpl_ml_status init(const huffman_table_t<algorithm> &other) noexcept;
@@ -70,6 +75,13 @@ public:
     [[nodiscard]] qpl_ml_status init_with_stream(const uint8_t *const buffer) noexcept;
     [[nodiscard]] qpl_ml_status write_to_stream(uint8_t *const buffer) const noexcept;
 
+    [[nodiscard]] qpl_ml_status init_with_compact_stream(const uint8_t *const buffer, const size_t buffer_size) noexcept;
+    [[nodiscard]] qpl_ml_status write_to_compact_stream(uint8_t *const buffer) const noexcept;
+    [[nodiscard]] size_t get_compact_stream_size() const noexcept;
+
+    [[nodiscard]] qpl_ml_status init_with_in_place_stream(const uint8_t *const buffer) noexcept;
+    [[nodiscard]] qpl_ml_status write_to_in_place_stream(uint8_t *const buffer) const noexcept;
+
     [[nodiscard]] bool is_equal(const huffman_table_t<algorithm> &other) const noexcept;
 
     [[nodiscard]] bool is_initialized() const noexcept;
@@ -18,6 +18,7 @@
 #include "compression/huffman_table/inflate_huffman_table.hpp"
 #include "compression/huffman_table/huffman_table_utils.hpp"
 #include "compression/huffman_table/serialization_utils.hpp"
+#include "compression/huffman_only/huffman_only.hpp"
 #include "compression/inflate/inflate.hpp"
 #include "compression/inflate/inflate_state.hpp"
 #include "util/descriptor_processing.hpp"
@@ -418,7 +419,7 @@ static inline void convert_software_tables(qplc_huffman_table_default_format *co
 static inline void isal_compression_table_to_qpl(const isal_hufftables *isal_table_ptr,
                                                  qplc_huffman_table_default_format *qpl_table_ptr) noexcept {
     // Variables
-    const auto isal_match_lengths_mask = util::build_mask<uint16_t, 15u>();
+    const auto isal_match_lengths_mask = util::build_mask<uint16_t, QPLC_CODE_LENGTH_BIT_LENGTH>();
 
     // Convert literals codes
     for (uint32_t i = 0; i < QPLC_DEFLATE_LITERALS_COUNT; i++) {
@@ -456,6 +457,62 @@ static inline void isal_compression_table_to_qpl(const isal_hufftables *isal_tab
     }
 }
 
+static inline void create_canonical_codes(const uint8_t *const code_lengths_ptr,
+                                          const uint32_t codes_count,
+                                          uint32_t *const table_ptr) noexcept {
+    constexpr uint32_t max_code_length = 15u;
+
+    uint32_t code_lengths_histogram[max_code_length + 1u] = {0u};
+    uint32_t next_code[max_code_length + 1u]              = {0u};
+
+    for (uint32_t i = 0u; i < codes_count; i++) {
+        code_lengths_histogram[code_lengths_ptr[i]]++;
+    }
+
+    // Canonical codes assignment in accordance with rfc 1951, 3.2.2
+    code_lengths_histogram[0] = 0u;
+    uint32_t code = 0u;
+
+    for (uint32_t length = 1u; length <= max_code_length; length++) {
+        code = (code + code_lengths_histogram[length - 1u]) << 1u;
+        next_code[length] = code;
+    }
+
+    for (uint32_t i = 0u; i < codes_count; i++) {
+        const uint32_t length = code_lengths_ptr[i];
+
+        table_ptr[i] = (0u == length) ? 0u : (next_code[length]++ | (length << QPLC_HUFFMAN_CODE_BIT_LENGTH));
+    }
+}
+
+static inline auto deflate_header_to_sw_compression_table(deflate_header &header,
+                                                          qplc_huffman_table_default_format *qpl_table_ptr) noexcept -> qpl_ml_status {
+    constexpr uint32_t eob_symbol = 256u;
+
+    // Literals/lengths and distances code lengths are saved by ISA-L as a single sequence
+    uint8_t code_lengths[ISAL_DEF_LIT_LEN_SYMBOLS + ISAL_DEF_DIST_SYMBOLS] = {0u};
+
+    isal_inflate_state temporary_state = {nullptr, 0u, 0u, nullptr, 0u, 0u, 0, {{0u}, {0u}},
+                                          {{0u}, {0u}}, (isal_block_state) 0, 0u, 0u, 0u, 0u, 0u,
+                                          0u, 0, 0, 0, 0, 0u, 0, 0, 0, 0, {0u}, {0u}, 0u, 0u, 0u, nullptr};
+
+    temporary_state.code_lengths_ptr = code_lengths;
+
+    auto status = initialize_inflate_state_from_deflate_header(header.data, header.header_bit_size, &temporary_state);
+
+    // Code lengths are provided for the dynamic block only, which always contains end of block code
+    if (status_list::ok != status || 0u == code_lengths[eob_symbol]) {
+        return status_list::serialization_corrupted_dump;
+    }
+
+    qpl::core_sw::util::set_zeros(reinterpret_cast<uint8_t *>(qpl_table_ptr), sizeof(qplc_huffman_table_default_format));
+
+    create_canonical_codes(code_lengths, QPLC_DEFLATE_LL_TABLE_SIZE, qpl_table_ptr->literals_matches);
+    create_canonical_codes(code_lengths + ISAL_DEF_LIT_LEN_SYMBOLS, QPLC_DEFLATE_D_TABLE_SIZE, qpl_table_ptr->offsets);
+
+    return status_list::ok;
+}
+
 static inline auto build_compression_table(const uint32_t *literals_lengths_histogram_ptr,
                                            const uint32_t *distances_histogram_ptr,
                                            compression_huffman_table &compression_table) noexcept -> qpl_ml_status {
@@ -538,7 +595,7 @@ static inline auto comp_to_decompression_table(const compression_huffman_table &
 
         isal_inflate_state temporary_state = {nullptr, 0u, 0u, nullptr, 0u, 0u, 0, {{0u}, {0u}},
                                               {{0u}, {0u}}, (isal_block_state) 0, 0u, 0u, 0u, 0u, 0u,
-                                              0u, 0, 0, 0, 0, 0u, 0, 0, 0, 0, {0u}, {0u}, 0u, 0u, 0u};
+                                              0u, 0, 0, 0, 0, 0u, 0, 0, 0, 0, {0u}, {0u}, 0u, 0u, 0u, nullptr};
 
         // Parse deflate header and load it into the temporary state
         auto status =
@@ -606,6 +663,26 @@ static inline auto comp_to_decompression_table(const compression_huffman_table &
     return status_list::ok;
 }
 
+/**
+ * @brief Builds the lookup table of software Huffman only decompression once per table instead of on every job
+ */
+static inline void init_huffman_only_decode_table(decompression_huffman_table &decompression_table,
+                                                  const uint32_t representation_flags) noexcept {
+    auto *decode_table_ptr        = decompression_table.get_huffman_only_decode_table();
+    auto *decompression_table_ptr = decompression_table.get_sw_decompression_table();
+
+    if (!decode_table_ptr || !(representation_flags & QPL_HUFFMAN_ONLY_REPRESENTATION)) {
+        return;
+    }
+
+    decode_table_ptr->is_built = false;
+
+    if (decompression_table.is_sw_decompression_table_used() &&
+        decompression_table_ptr->format_stored == ht_with_mapping_table) {
+        build_huffman_only_decode_table(*decompression_table_ptr, *decode_table_ptr);
+    }
+}
+
 static inline auto init_compression_table_with_stream(const uint8_t *const buffer,
                                                       compression_huffman_table compression_table) noexcept -> qpl_ml_status {
     using namespace qpl::ml::serialization;
@@ -813,6 +890,8 @@ auto huffman_table_init(decompression_huffman_table &table,
                                                     decompression_table_ptr);
     }
 
+    details::init_huffman_only_decode_table(table, representation_flags);
+
     return status_list::ok;
 }
 
@@ -1022,7 +1101,100 @@ auto huffman_table_init_with_stream(qpl_decompression_huffman_table &table,
         table.representation_mask |= QPL_HW_REPRESENTATION;
     }
 
-    return details::init_decompression_table_with_stream(buffer, decompression_table);
+    auto status = details::init_decompression_table_with_stream(buffer, decompression_table);
+
+    if (status_list::ok != status) {
+        return status;
+    }
+
+    // The stream keeps the canned lookup table only, so the Huffman only one is rebuilt from the deserialized table
+    details::init_huffman_only_decode_table(decompression_table, representation_flags);
+
+    return status_list::ok;
+}
+
+// --- Initialization from the memory stream in compact format (code lengths only) --- //
+
+template <>
+auto huffman_table_init_with_compact_stream(qpl_compression_huffman_table &table,
+                                            const uint8_t *const buffer,
+                                            const std::size_t buffer_size,
+                                            const uint32_t representation_flags) noexcept -> qpl_ml_status {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    // Code lengths are stored in the form of deflate header, so only deflate tables are supported
+    if (!(representation_flags & QPL_DEFLATE_REPRESENTATION) ||
+        (representation_flags & QPL_HUFFMAN_ONLY_REPRESENTATION)) {
+        return status_list::not_supported_err;
+    }
+
+    auto deflate_header_ptr = reinterpret_cast<deflate_header *>(&table.deflate_header_buffer);
+    auto sw_table_ptr       = reinterpret_cast<qplc_huffman_table_default_format *>(&table.sw_compression_table_data);
+    auto isal_table_ptr     = reinterpret_cast<isal_hufftables *>(&table.isal_compression_table_data);
+
+    if (!serialization::deserialize_compact_table(buffer, buffer_size, *deflate_header_ptr)) {
+        return status_list::serialization_corrupted_dump;
+    }
+
+    table.representation_mask |= QPL_DEFLATE_REPRESENTATION;
+
+    if (representation_flags & QPL_SW_REPRESENTATION) {
+        table.representation_mask |= QPL_SW_REPRESENTATION;
+    }
+
+    if (representation_flags & QPL_HW_REPRESENTATION) {
+        table.representation_mask |= QPL_HW_REPRESENTATION;
+    }
+
+    // Software table is required for every path (hardware table format is equal to the software one),
+    // ISA-L table is built from it and the deflate header
+    auto status = details::deflate_header_to_sw_compression_table(*deflate_header_ptr, sw_table_ptr);
+    if (status) {
+        return status;
+    }
+
+    details::qpl_huffman_table_to_isal(&table, isal_table_ptr, little_endian);
+
+    return status_list::ok;
+}
+
+// --- Initialization from the memory stream serialized for in-place usage --- //
+
+template <>
+auto huffman_table_init_with_in_place_stream(qpl_compression_huffman_table &table,
+                                             const uint8_t *const buffer) noexcept -> qpl_ml_status {
+    core_sw::util::copy(buffer,
+                        buffer + sizeof(qpl_compression_huffman_table),
+                        reinterpret_cast<uint8_t *>(&table));
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_init_with_in_place_stream(qpl_decompression_huffman_table &table,
+                                             const uint8_t *const buffer) noexcept -> qpl_ml_status {
+    auto image_ptr = reinterpret_cast<const qpl_decompression_huffman_table *>(buffer);
+
+    // Image is stored at the aligned offset, so AECS is placed at the very beginning of hw_decompression_state there
+    // and could be at the different position in the table that is being initialized
+    auto image_aecs_ptr = reinterpret_cast<const uint8_t *>(&image_ptr->hw_decompression_state);
+
+    decompression_huffman_table decompression_table(reinterpret_cast<uint8_t *>(&table.sw_flattened_table),
+                                                    reinterpret_cast<uint8_t *>(&table.hw_decompression_state),
+                                                    reinterpret_cast<uint8_t *>(&table.deflate_header_buffer),
+                                                    reinterpret_cast<uint8_t *>(&table.lookup_table_buffer));
+
+    table.sw_flattened_table    = image_ptr->sw_flattened_table;
+    table.deflate_header_buffer = image_ptr->deflate_header_buffer;
+    table.representation_mask   = image_ptr->representation_mask;
+    table.lookup_table_buffer   = image_ptr->lookup_table_buffer;
+
+    core_sw::util::copy(image_aecs_ptr,
+                        image_aecs_ptr + HW_AECS_FILTER_AND_DECOMPRESS,
+                        reinterpret_cast<uint8_t *>(decompression_table.get_hw_decompression_state()));
+
+    return status_list::ok;
 }
 
 // --- Convert functions group --- //
@@ -1205,6 +1377,61 @@ auto huffman_table_write_to_stream(const qpl_decompression_huffman_table &table,
 }
 
 
+template <>
+auto huffman_table_write_to_compact_stream(const qpl_compression_huffman_table &table,
+                                           uint8_t *const buffer) noexcept -> qpl_ml_status {
+    serialization::serialize_compact_table(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer), buffer);
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_write_to_compact_stream(const qpl_decompression_huffman_table &table,
+                                           uint8_t *const buffer) noexcept -> qpl_ml_status {
+    serialization::serialize_compact_table(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer), buffer);
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_write_to_in_place_stream(const qpl_compression_huffman_table &table,
+                                            uint8_t *const buffer) noexcept -> qpl_ml_status {
+    auto table_ptr = reinterpret_cast<const uint8_t *>(&table);
+
+    core_sw::util::copy(table_ptr, table_ptr + sizeof(qpl_compression_huffman_table), buffer);
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_write_to_in_place_stream(const qpl_decompression_huffman_table &table,
+                                            uint8_t *const buffer) noexcept -> qpl_ml_status {
+    auto casted_table = const_cast<qpl_decompression_huffman_table *>(&table);
+    auto image_ptr    = reinterpret_cast<qpl_decompression_huffman_table *>(buffer);
+
+    decompression_huffman_table decompression_table(reinterpret_cast<uint8_t *>(&casted_table->sw_flattened_table),
+                                                    reinterpret_cast<uint8_t *>(&casted_table->hw_decompression_state),
+                                                    reinterpret_cast<uint8_t *>(&casted_table->deflate_header_buffer),
+                                                    reinterpret_cast<uint8_t *>(&casted_table->lookup_table_buffer));
+
+    core_sw::util::set_zeros(buffer, sizeof(qpl_decompression_huffman_table));
+
+    image_ptr->sw_flattened_table    = table.sw_flattened_table;
+    image_ptr->deflate_header_buffer = table.deflate_header_buffer;
+    image_ptr->representation_mask   = table.representation_mask;
+    image_ptr->lookup_table_buffer   = table.lookup_table_buffer;
+
+    // Image is going to be used from the aligned memory, so AECS is moved to the beginning of hw_decompression_state,
+    // where the table built on top of the image would look for it
+    auto aecs_ptr = reinterpret_cast<const uint8_t *>(decompression_table.get_hw_decompression_state());
+
+    core_sw::util::copy(aecs_ptr,
+                        aecs_ptr + HW_AECS_FILTER_AND_DECOMPRESS,
+                        reinterpret_cast<uint8_t *>(&image_ptr->hw_decompression_state));
+
+    return status_list::ok;
+}
+
 // --- Functions to compare two (de)compression tables --- //
 
 template <>
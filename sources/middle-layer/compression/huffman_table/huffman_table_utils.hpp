@@ -12,6 +12,7 @@
 #ifndef QPL_MIDDLE_LAYER_COMPRESSION_CANNED_UTILS_HPP
 #define QPL_MIDDLE_LAYER_COMPRESSION_CANNED_UTILS_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 
@@ -120,9 +121,11 @@ struct qpl_decompression_huffman_table {
     uint32_t representation_mask;
 
     /**
-    * This field is used for canned mode only (software path). Contains lookup table for further decompression.
+    * This field is used for canned mode and Huffman only decompression (software path).
+    * Contains lookup table for further decompression.
     */
-    std::aligned_storage_t<sizeof(qpl::ml::compression::canned_table),
+    std::aligned_storage_t<std::max(sizeof(qpl::ml::compression::canned_table),
+                                    sizeof(qpl::ml::compression::huffman_only_decode_table)),
                            qpl::ml::util::default_alignment> lookup_table_buffer;
 };
 
@@ -173,6 +176,16 @@ auto huffman_table_init_with_stream(table_t &table,
                                     const uint8_t *const buffer,
                                     const uint32_t representation_flags) noexcept -> qpl_ml_status;
 
+template<class table_t>
+auto huffman_table_init_with_compact_stream(table_t &table,
+                                            const uint8_t *const buffer,
+                                            const std::size_t buffer_size,
+                                            const uint32_t representation_flags) noexcept -> qpl_ml_status;
+
+template<class table_t>
+auto huffman_table_init_with_in_place_stream(table_t &table,
+                                             const uint8_t *const buffer) noexcept -> qpl_ml_status;
+
 template<class first_table_t, class second_table_t>
 auto huffman_table_convert(const first_table_t &first_table,
                            second_table_t &second_table,
@@ -183,6 +196,14 @@ auto huffman_table_write_to_stream(const table_t &table,
                                    uint8_t *const buffer,
                                    const uint32_t representation_flags) noexcept -> qpl_ml_status;
 
+template<class table_t>
+auto huffman_table_write_to_compact_stream(const table_t &table,
+                                           uint8_t *const buffer) noexcept -> qpl_ml_status;
+
+template<class table_t>
+auto huffman_table_write_to_in_place_stream(const table_t &table,
+                                            uint8_t *const buffer) noexcept -> qpl_ml_status;
+
 template<class first_table_t, class second_table_t>
 bool is_equal(first_table_t &first_table, second_table_t &second_table) noexcept;
 
@@ -61,6 +61,10 @@ auto decompression_huffman_table::get_canned_table() noexcept -> canned_table *
     return canned_table_ptr_;
 }
 
+auto decompression_huffman_table::get_huffman_only_decode_table() noexcept -> huffman_only_decode_table * {
+    return reinterpret_cast<huffman_only_decode_table *>(canned_table_ptr_);
+}
+
 void decompression_huffman_table::set_deflate_header_bit_size(uint32_t value) noexcept {
     deflate_header_ptr_->header_bit_size = value;
 }
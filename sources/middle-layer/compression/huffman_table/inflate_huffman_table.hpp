@@ -43,6 +43,52 @@ struct canned_table {
     bool is_final_block;
 };
 
+/**
+ * Number of bits used to index @ref huffman_only_decode_table
+ */
+constexpr uint32_t huffman_only_decode_bits = 12u;
+
+/**
+ * Maximal number of literals emitted by a single lookup into @ref huffman_only_decode_table
+ */
+constexpr uint32_t huffman_only_max_symbols_per_lookup = 4u;
+
+/**
+ * @brief The following structure stores lookup table, which is used for Huffman only software decompression.
+ * It is built once per Huffman table and shares the storage of @ref canned_table, as the latter is used
+ * by deflate tables only
+ */
+struct huffman_only_decode_table {
+    /**
+     * Literals decoded from the next @ref huffman_only_decode_bits bits of the stream, the first one in the low byte
+     */
+    uint32_t symbols[1u << huffman_only_decode_bits];
+
+    /**
+     * Number of literals in the corresponding symbols entry (high nibble) and their total code length (low nibble),
+     * zero if the first code is longer than @ref huffman_only_decode_bits
+     */
+    uint8_t entries[1u << huffman_only_decode_bits];
+
+    /**
+     * Code length for every literal
+     */
+    uint8_t code_lengths[256];
+
+    /**
+     * Canonical representation of the codes, used for the codes longer than @ref huffman_only_decode_bits
+     */
+    uint16_t first_codes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint16_t number_of_codes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint16_t first_table_indexes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint8_t  index_to_char[QPLC_INDEX_TO_CHAR_TABLE_SIZE];
+
+    /**
+     * The following flag indicates if the table was built for the current Huffman table
+     */
+    bool is_built;
+};
+
 /**
  * @brief Structure that represents hardware decompression table
  * This is just a stab and is not used anywhere yet
@@ -64,6 +110,7 @@ public:
     auto get_deflate_header_data() noexcept -> uint8_t *;
     auto get_deflate_header_bit_size() noexcept -> uint32_t;
     auto get_canned_table() noexcept -> canned_table *;
+    auto get_huffman_only_decode_table() noexcept -> huffman_only_decode_table *;
 
     void set_deflate_header_bit_size(uint32_t value) noexcept;
 
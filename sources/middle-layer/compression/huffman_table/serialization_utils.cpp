@@ -319,4 +319,77 @@ void deserialize_table(const uint8_t * const buffer, canned_table &table) {
     read_impl(&src, &(table.eob_code_and_len));
     read_impl(&src, &(table.is_final_block));
 }
+
+/* Routines for the stream serialized for in-place usage
+*/
+
+static_assert(in_place_alignment % HW_PATH_STRUCTURES_REQUIRED_ALIGN == 0);
+
+void get_in_place_meta_size(const huffman_table_meta_t &meta, size_t *out_size) {
+    size_t meta_size = 0;
+    get_meta_size(meta, &meta_size);
+
+    *out_size = util::align_size(meta_size, in_place_alignment);
+}
+
+size_t get_in_place_tables_size(huffman_table_type_e type) {
+    const size_t compression_table_size   = util::align_size(sizeof(qpl_compression_huffman_table), in_place_alignment);
+    const size_t decompression_table_size = util::align_size(sizeof(qpl_decompression_huffman_table), in_place_alignment);
+
+    switch (type) {
+        case huffman_table_type_e::compression:
+            return compression_table_size;
+        case huffman_table_type_e::decompression:
+            return decompression_table_size;
+        default:
+            return compression_table_size + decompression_table_size;
+    }
+}
+
+size_t get_in_place_decompression_table_offset(huffman_table_type_e type) {
+    return (type == huffman_table_type_e::combined)
+           ? util::align_size(sizeof(qpl_compression_huffman_table), in_place_alignment)
+           : 0u;
+}
+
+/* Routines for compact format, deflate header is stored without trailing unused bytes
+*/
+
+size_t compact_table_size(const deflate_header &table) {
+    size_t table_size = 0;
+
+    table_size += sizeof(table.header_bit_size);
+    table_size += util::bit_to_byte(table.header_bit_size);
+
+    return table_size;
+}
+
+void serialize_compact_table(const deflate_header &table, uint8_t *buffer) {
+    uint8_t *dst = buffer; // adding an offset internally
+
+    write_impl(&dst, &(table.header_bit_size));
+    memcpy(dst, table.data, util::bit_to_byte(table.header_bit_size));
+}
+
+bool deserialize_compact_table(const uint8_t * const buffer, const size_t buffer_size, deflate_header &table) {
+    uint8_t *src = const_cast<uint8_t *>(buffer); // adding an offset internally
+
+    if (buffer_size < sizeof(table.header_bit_size)) {
+        return false;
+    }
+
+    read_impl(&src, &(table.header_bit_size));
+
+    const size_t header_byte_size = util::bit_to_byte(table.header_bit_size);
+
+    if (header_byte_size > sizeof(table.data) ||
+        header_byte_size > buffer_size - sizeof(table.header_bit_size)) {
+        return false;
+    }
+
+    memset(table.data, 0, sizeof(table.data));
+    memcpy(table.data, src, header_byte_size);
+
+    return true;
+}
 }
@@ -82,6 +82,34 @@ void deserialize_table(const uint8_t * const buffer, inflate_huff_code_large &ta
 void deserialize_table(const uint8_t * const buffer, inflate_huff_code_small &table);
 void deserialize_table(const uint8_t * const buffer, canned_table &table);
 
+// markers stored in the flags of serialized meta structure, they describe the layout of the stream
+// following the meta structure and are never set in the flags of the table itself
+
+constexpr uint32_t compact_stream_flag  = 0x100u; /**< stream stores only the deflate header, tables are rebuilt on load */
+constexpr uint32_t in_place_stream_flag = 0x200u; /**< stream stores aligned images of the tables that could be used directly */
+
+// layout of the stream serialized for in-place usage:
+// |meta structure|padding|compression table image|decompression table image|,
+// with every part starting at the offset aligned to in_place_alignment
+
+constexpr uint32_t in_place_alignment = util::default_alignment;
+
+void get_in_place_meta_size(const huffman_table_meta_t &meta, size_t *out_size);
+
+[[nodiscard]] size_t get_in_place_tables_size(huffman_table_type_e type);
+[[nodiscard]] size_t get_in_place_decompression_table_offset(huffman_table_type_e type);
+
+// (de)serialization-related functions for compact format, only the code lengths
+// (in the form of deflate header) are stored
+
+[[nodiscard]] size_t compact_table_size(const deflate_header &table);
+
+void serialize_compact_table(const deflate_header &table, uint8_t *buffer);
+
+[[nodiscard]] bool deserialize_compact_table(const uint8_t * const buffer,
+                                             const size_t buffer_size,
+                                             deflate_header &table);
+
 }
 
 #endif // QPL_SERIALIZATION_UTILS_HPP_
@@ -0,0 +1,525 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "parallel_inflate.hpp"
+
+#include "inflate.hpp"
+#include "inflate_state.hpp"
+
+#include "common/allocation_buffer_t.hpp"
+#include "common/linear_allocator.hpp"
+#include "compression/stream_decorators/default_decorator.hpp"
+#include "compression/stream_decorators/gzip_decorator.hpp"
+
+#include "util/checksum.hpp"
+#include "util/thread_pool.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+namespace qpl::ml::compression {
+
+namespace {
+
+constexpr uint32_t no_block_decoded = UINT32_MAX;
+
+/**
+ * @brief Describes the part of the stream between two indices in terms of @ref access_properties
+ */
+struct stream_part_t {
+    uint8_t           *begin;
+    uint8_t           *end;
+    access_properties properties;
+};
+
+inline auto get_stream_part(uint8_t *begin,
+                            const qpl_index &start,
+                            const qpl_index &finish,
+                            bool is_random) noexcept -> stream_part_t {
+    return {begin + start.bit_offset / byte_bits_size,
+            begin + (finish.bit_offset + max_bit_index) / byte_bits_size,
+            {is_random,
+             static_cast<uint8_t>(start.bit_offset & max_bit_index),
+             static_cast<uint8_t>(max_bit_index & (0u - finish.bit_offset))}};
+}
+
+/**
+ * @brief Reads the deflate block header and keeps the decoding tables in the state buffer for the mini-blocks
+ */
+auto decode_block_header(allocation_buffer_t state_buffer,
+                         const stream_part_t &header,
+                         uint8_t *output_begin,
+                         uint8_t *output_end) noexcept -> qpl_ml_status {
+    const util::linear_allocator allocator(state_buffer);
+
+    auto state = inflate_state<execution_path_t::software>::create<true>(allocator);
+
+    state.input(header.begin, header.end)
+         .output(output_begin, output_end)
+         .crc_seed(0u)
+         .input_access(header.properties);
+
+    return inflate<execution_path_t::software, inflate_mode_t::inflate_header>(state, stop_and_check_any_eob).status_code_;
+}
+
+/**
+ * @brief Decodes mini-block body with the tables left in the state buffer by @ref decode_block_header
+ */
+auto decode_mini_block(allocation_buffer_t state_buffer,
+                       const stream_part_t &mini_block,
+                       uint32_t crc_seed,
+                       uint8_t *output_begin,
+                       uint8_t *output_end) noexcept -> decompression_operation_result_t {
+    const util::linear_allocator allocator(state_buffer);
+
+    auto state = inflate_state<execution_path_t::software>::restore(allocator);
+
+    state.input(mini_block.begin, mini_block.end)
+         .output(output_begin, output_end)
+         .crc_seed(crc_seed)
+         .input_access(mini_block.properties);
+
+    return default_decorator::unwrap(inflate<execution_path_t::software, inflate_mode_t::inflate_body>,
+                                     state,
+                                     stop_and_check_any_eob);
+}
+
+/**
+ * @brief Member of a multi-member gzip stream and its place in the destination
+ */
+struct gzip_member_slot_t {
+    uint8_t                      *begin;
+    uint8_t                      *end;
+    uint32_t                     output_offset;
+    gzip_decorator::gzip_trailer trailer;
+};
+
+/**
+ * @brief Decompresses the deflate stream of a single gzip member up to the end of its final block
+ *
+ * @return `completed_bytes_` is the size of the deflate stream, `checksums_.crc32_` is the CRC of the output
+ */
+auto inflate_gzip_member(allocation_buffer_t state_buffer,
+                         uint8_t *begin,
+                         uint8_t *end,
+                         uint8_t *output_begin,
+                         uint8_t *output_end) noexcept -> decompression_operation_result_t {
+    const util::linear_allocator allocator(state_buffer);
+
+    auto state = inflate_state<execution_path_t::software>::create<true>(allocator);
+
+    state.input(begin, end)
+         .output(output_begin, output_end)
+         .crc_seed(0u)
+         .terminate();
+
+    auto result = inflate<execution_path_t::software, inflate_mode_t::inflate_default>(state,
+                                                                                      stop_and_check_for_bfinal_eob);
+
+    if (result.status_code_ == QPL_STS_INTL_OUTPUT_OVERFLOW) {
+        result.status_code_ = status_list::more_output_needed;
+    }
+
+    if (result.status_code_ != status_list::ok) {
+        return result;
+    }
+
+    const auto *isal_state_ptr = state.get_state();
+
+    if (ISAL_BLOCK_FINISH != isal_state_ptr->block_state) {
+        result.status_code_ = status_list::input_too_small;
+
+        return result;
+    }
+
+    // Bytes read ahead by the decoder belong to the trailer
+    result.completed_bytes_ -= static_cast<uint32_t>(isal_state_ptr->read_in_length) / byte_bits_size;
+    result.checksums_.crc32_ = util::crc32_gzip(output_begin, output_begin + result.output_bytes_, 0u);
+
+    return result;
+}
+
+/**
+ * @brief Walks the gzip members one by one, the end of every member is found by decompressing it
+ */
+auto inflate_gzip_members_serial(allocation_buffer_t state_buffer,
+                                 uint8_t *begin,
+                                 uint32_t size,
+                                 uint8_t *output_begin,
+                                 uint32_t output_size) noexcept -> decompression_operation_result_t {
+    constexpr uint32_t trailer_size = sizeof(gzip_decorator::gzip_trailer);
+
+    decompression_operation_result_t result{};
+
+    uint32_t input_offset  = 0u;
+    uint32_t output_offset = 0u;
+    uint32_t crc           = 0u;
+
+    while (input_offset < size) {
+        gzip_decorator::gzip_header header{};
+
+        if (size - input_offset < OWN_GZIP_HEADER_LENGTH + trailer_size) {
+            result.status_code_ = status_list::input_too_small;
+
+            return result;
+        }
+
+        auto status = gzip_decorator::read_header(begin + input_offset, size - input_offset, header);
+
+        if (status != status_list::ok) {
+            result.status_code_ = status;
+
+            return result;
+        }
+
+        if (size - input_offset < header.byte_size + trailer_size) {
+            result.status_code_ = status_list::input_too_small;
+
+            return result;
+        }
+
+        uint8_t *deflate_begin = begin + input_offset + header.byte_size;
+
+        auto member_result = inflate_gzip_member(state_buffer,
+                                                 deflate_begin,
+                                                 begin + size - trailer_size,
+                                                 output_begin + output_offset,
+                                                 output_begin + output_size);
+
+        if (member_result.status_code_ != status_list::ok) {
+            result.status_code_ = member_result.status_code_;
+
+            return result;
+        }
+
+        const auto *trailer_ptr = reinterpret_cast<const gzip_decorator::gzip_trailer *>(deflate_begin +
+                                                                                         member_result.completed_bytes_);
+
+        if (trailer_ptr->crc32 != member_result.checksums_.crc32_ ||
+            trailer_ptr->input_size != member_result.output_bytes_) {
+            result.status_code_ = status_list::verify_error;
+
+            return result;
+        }
+
+        crc            = util::crc32_gzip_combine(crc, member_result.checksums_.crc32_, member_result.output_bytes_);
+        input_offset  += header.byte_size + member_result.completed_bytes_ + trailer_size;
+        output_offset += member_result.output_bytes_;
+    }
+
+    result.completed_bytes_  = size;
+    result.output_bytes_     = output_offset;
+    result.checksums_.crc32_ = crc;
+
+    return result;
+}
+
+/**
+ * @brief Allocates the state and runs @ref inflate_gzip_members_serial, used once a guessed member boundary fails
+ */
+auto inflate_gzip_members_fallback(uint8_t *begin,
+                                   uint32_t size,
+                                   uint8_t *output_begin,
+                                   uint32_t output_size) noexcept -> decompression_operation_result_t {
+    const uint32_t state_buffer_size = inflate_state<execution_path_t::software>::get_buffer_size();
+
+    std::unique_ptr<uint8_t[]> state_buffer(new (std::nothrow) uint8_t[state_buffer_size]);
+
+    if (!state_buffer) {
+        decompression_operation_result_t result{};
+        result.status_code_ = status_list::internal_error;
+
+        return result;
+    }
+
+    const allocation_buffer_t state_allocation_buffer(state_buffer.get(), state_buffer.get() + state_buffer_size);
+
+    return inflate_gzip_members_serial(state_allocation_buffer, begin, size, output_begin, output_size);
+}
+
+} // namespace
+
+auto inflate_mini_blocks_parallel(uint8_t *begin,
+                                  uint32_t size,
+                                  uint8_t *output_begin,
+                                  uint32_t output_size,
+                                  const qpl_index_table &index_table,
+                                  uint32_t mini_block_size,
+                                  uint32_t threads_count) noexcept -> decompression_operation_result_t {
+    decompression_operation_result_t result{};
+
+    const uint32_t mini_block_count      = index_table.mini_block_count;
+    const uint32_t mini_blocks_per_block = index_table.mini_blocks_per_block;
+    const qpl_index *indices             = index_table.indices_ptr;
+
+    if (0u == mini_block_count) {
+        return result;
+    }
+
+    // Every mini-block except the last one is decompressed into a fixed place of the destination
+    const uint64_t last_mini_block_offset = static_cast<uint64_t>(mini_block_count - 1u) * mini_block_size;
+
+    if (last_mini_block_offset >= output_size) {
+        result.status_code_ = status_list::more_output_needed;
+
+        return result;
+    }
+
+    // Each block is described by its header index, mini-block indices and the end of block index
+    const uint32_t indices_per_block = mini_blocks_per_block + 2u;
+    const uint64_t stream_bit_size   = static_cast<uint64_t>(size) * byte_bits_size;
+
+    std::atomic<uint32_t> next_mini_block{0u};
+    std::atomic<uint32_t> status_code{status_list::ok};
+    uint32_t              last_mini_block_size = 0u;
+
+    const auto report_error = [&status_code](uint32_t error) {
+        uint32_t expected = status_list::ok;
+        status_code.compare_exchange_strong(expected, error);
+    };
+
+    // Every thread owns a single inflate state and decodes mini-blocks until none left
+    util::thread_pool::get_instance().parallel_for(threads_count, threads_count, [&](uint32_t) {
+        const uint32_t state_buffer_size = inflate_state<execution_path_t::software>::get_buffer_size();
+
+        std::unique_ptr<uint8_t[]> state_buffer(new (std::nothrow) uint8_t[state_buffer_size]);
+
+        if (!state_buffer) {
+            report_error(status_list::internal_error);
+
+            return;
+        }
+
+        const allocation_buffer_t state_allocation_buffer(state_buffer.get(), state_buffer.get() + state_buffer_size);
+
+        uint32_t decoded_block = no_block_decoded;
+
+        for (uint32_t i = next_mini_block++; i < mini_block_count; i = next_mini_block++) {
+            if (status_code.load() != status_list::ok) {
+                return;
+            }
+
+            const uint32_t block            = i / mini_blocks_per_block;
+            const uint32_t header_index     = block * indices_per_block;
+            const uint32_t mini_block_index = header_index + 1u + (i - block * mini_blocks_per_block);
+
+            const qpl_index &mini_block_start  = indices[mini_block_index];
+            const qpl_index &mini_block_finish = indices[mini_block_index + 1u];
+
+            if (mini_block_start.bit_offset > mini_block_finish.bit_offset ||
+                mini_block_finish.bit_offset > stream_bit_size) {
+                report_error(status_list::status_invalid_params);
+
+                return;
+            }
+
+            const bool is_last        = (i + 1u == mini_block_count);
+            uint8_t    *output_start  = output_begin + static_cast<size_t>(i) * mini_block_size;
+            uint8_t    *output_finish = is_last ? output_begin + output_size : output_start + mini_block_size;
+
+            if (block != decoded_block) {
+                auto status = decode_block_header(state_allocation_buffer,
+                                                  get_stream_part(begin, indices[header_index], indices[header_index + 1u], false),
+                                                  output_start,
+                                                  output_finish);
+
+                if (status != status_list::ok) {
+                    report_error(status);
+
+                    return;
+                }
+
+                decoded_block = block;
+            }
+
+            auto mini_block_result = decode_mini_block(state_allocation_buffer,
+                                                       get_stream_part(begin, mini_block_start, mini_block_finish, true),
+                                                       mini_block_start.crc,
+                                                       output_start,
+                                                       output_finish);
+
+            if (mini_block_result.status_code_ == QPL_STS_INTL_OUTPUT_OVERFLOW) {
+                mini_block_result.status_code_ = status_list::more_output_needed;
+            }
+
+            if (mini_block_result.status_code_ != status_list::ok) {
+                report_error(mini_block_result.status_code_);
+
+                return;
+            }
+
+            if (mini_block_result.checksums_.crc32_ != mini_block_finish.crc ||
+                (!is_last && mini_block_result.output_bytes_ != mini_block_size)) {
+                report_error(status_list::verify_error);
+
+                return;
+            }
+
+            if (is_last) {
+                last_mini_block_size = mini_block_result.output_bytes_;
+            }
+        }
+    });
+
+    result.status_code_ = status_code.load();
+
+    if (result.status_code_ == status_list::ok) {
+        const uint32_t last_block            = (mini_block_count - 1u) / mini_blocks_per_block;
+        const uint32_t last_mini_block_index = last_block * indices_per_block + 1u +
+                                               (mini_block_count - 1u - last_block * mini_blocks_per_block);
+
+        result.completed_bytes_  = size;
+        result.output_bytes_     = static_cast<uint32_t>(last_mini_block_offset) + last_mini_block_size;
+        result.checksums_.crc32_ = indices[last_mini_block_index + 1u].crc;
+    }
+
+    return result;
+}
+
+auto inflate_gzip_members_parallel(uint8_t *begin,
+                                   uint32_t size,
+                                   uint8_t *output_begin,
+                                   uint32_t output_size,
+                                   uint32_t threads_count) noexcept -> decompression_operation_result_t {
+    constexpr uint32_t trailer_size = sizeof(gzip_decorator::gzip_trailer);
+
+    decompression_operation_result_t result{};
+
+    // 1. Find the member boundaries
+    uint32_t member_count = 0u;
+    bool     is_exact     = true;
+
+    for (uint32_t offset = 0u; offset < size;) {
+        gzip_decorator::gzip_member member{};
+
+        auto status = gzip_decorator::read_member(begin + offset, size - offset, member);
+
+        if (status != status_list::ok) {
+            // A guessed boundary may point to a signature inside the data of the previous member
+            if (!is_exact) {
+                return inflate_gzip_members_fallback(begin, size, output_begin, output_size);
+            }
+
+            result.status_code_ = status;
+
+            return result;
+        }
+
+        is_exact = is_exact && member.is_exact;
+        offset  += member.byte_size;
+        member_count++;
+    }
+
+    if (member_count < 2u) {
+        result.status_code_ = status_list::not_supported_err;
+
+        return result;
+    }
+
+    const uint32_t state_buffer_size = inflate_state<execution_path_t::software>::get_buffer_size();
+
+    std::unique_ptr<gzip_member_slot_t[]> slots(new (std::nothrow) gzip_member_slot_t[member_count]);
+
+    if (!slots) {
+        result.status_code_ = status_list::internal_error;
+
+        return result;
+    }
+
+    uint64_t output_offset = 0u;
+
+    for (uint32_t i = 0u, offset = 0u; i < member_count; i++) {
+        gzip_decorator::gzip_member member{};
+
+        gzip_decorator::read_member(begin + offset, size - offset, member);
+
+        slots[i] = {begin + offset + member.header_size,
+                    begin + offset + member.byte_size - trailer_size,
+                    static_cast<uint32_t>(output_offset),
+                    member.trailer};
+
+        offset        += member.byte_size;
+        output_offset += member.trailer.input_size;
+    }
+
+    std::atomic<uint32_t> next_member{0u};
+    std::atomic<uint32_t> status_code{status_list::ok};
+
+    const auto report_error = [&status_code](uint32_t error) {
+        uint32_t expected = status_list::ok;
+        status_code.compare_exchange_strong(expected, error);
+    };
+
+    if (output_offset > output_size) {
+        report_error(status_list::more_output_needed);
+    } else {
+        // 2. Decompress the members into their places simultaneously
+        util::thread_pool::get_instance().parallel_for(threads_count, threads_count, [&](uint32_t) {
+            std::unique_ptr<uint8_t[]> state_buffer(new (std::nothrow) uint8_t[state_buffer_size]);
+
+            if (!state_buffer) {
+                report_error(status_list::internal_error);
+
+                return;
+            }
+
+            const allocation_buffer_t state_allocation_buffer(state_buffer.get(),
+                                                              state_buffer.get() + state_buffer_size);
+
+            for (uint32_t i = next_member++; i < member_count; i = next_member++) {
+                if (status_code.load() != status_list::ok) {
+                    return;
+                }
+
+                const gzip_member_slot_t &slot = slots[i];
+
+                uint8_t *output_start = output_begin + slot.output_offset;
+
+                auto member_result = inflate_gzip_member(state_allocation_buffer,
+                                                         slot.begin,
+                                                         slot.end,
+                                                         output_start,
+                                                         output_start + slot.trailer.input_size);
+
+                if (member_result.status_code_ != status_list::ok) {
+                    report_error(member_result.status_code_);
+
+                    return;
+                }
+
+                if (member_result.completed_bytes_ != static_cast<uint32_t>(std::distance(slot.begin, slot.end)) ||
+                    member_result.output_bytes_ != slot.trailer.input_size ||
+                    member_result.checksums_.crc32_ != slot.trailer.crc32) {
+                    report_error(status_list::verify_error);
+
+                    return;
+                }
+            }
+        });
+    }
+
+    result.status_code_ = status_code.load();
+
+    if (result.status_code_ == status_list::ok) {
+        uint32_t crc = 0u;
+
+        for (uint32_t i = 0u; i < member_count; i++) {
+            crc = util::crc32_gzip_combine(crc, slots[i].trailer.crc32, slots[i].trailer.input_size);
+        }
+
+        result.completed_bytes_  = size;
+        result.output_bytes_     = static_cast<uint32_t>(output_offset);
+        result.checksums_.crc32_ = crc;
+    } else if (!is_exact) {
+        // 3. Some of the guessed boundaries are wrong, so the members are found by decompressing them one by one
+        result = inflate_gzip_members_fallback(begin, size, output_begin, output_size);
+    }
+
+    return result;
+}
+
+} // namespace qpl::ml::compression
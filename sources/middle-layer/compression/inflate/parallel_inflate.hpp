@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Multi-threaded software inflate of an indexed (mini-block) stream and of a multi-member gzip stream
+ */
+
+#ifndef QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_PARALLEL_INFLATE_HPP
+#define QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_PARALLEL_INFLATE_HPP
+
+#include "common/defs.hpp"
+#include "compression/compression_defs.hpp"
+
+#include "qpl/c_api/index_table.h"
+
+namespace qpl::ml::compression {
+
+/**
+ * @brief Decompresses all mini-blocks of an indexed stream using several threads
+ *
+ * Mini-block `i` is decoded into `output_begin + i * mini_block_size`, so every mini-block except the last one
+ * must be exactly @p mini_block_size bytes long. Each thread decodes the header of a deflate block only once
+ * for all mini-blocks of this block it processes. The CRC of every decoded mini-block is checked against
+ * the cumulative CRCs stored in the index table.
+ *
+ * @param begin            indexed stream, bit offsets in the table are counted from this pointer
+ * @param size             stream size
+ * @param output_begin     destination for the decompressed data
+ * @param output_size      destination size
+ * @param index_table      index table written during the stream compression
+ * @param mini_block_size  size of a mini-block in bytes
+ * @param threads_count    maximal number of threads to use (including the calling one)
+ *
+ * @return `output_bytes_` is the total size of the decompressed data, `checksums_.crc32_` is the CRC of it
+ */
+auto inflate_mini_blocks_parallel(uint8_t *begin,
+                                  uint32_t size,
+                                  uint8_t *output_begin,
+                                  uint32_t output_size,
+                                  const qpl_index_table &index_table,
+                                  uint32_t mini_block_size,
+                                  uint32_t threads_count) noexcept -> decompression_operation_result_t;
+
+/**
+ * @brief Decompresses a stream of concatenated gzip members using several threads
+ *
+ * Member boundaries are taken from the BGZF `BC` extra subfield when present, otherwise they are guessed by
+ * the signatures of the following members. The members are decompressed simultaneously into the places
+ * given by the `ISIZE` fields of their trailers, and both `CRC32` and `ISIZE` of every member are verified.
+ * If the guessed boundaries turn out to be wrong or can't be parsed, the members are walked and decompressed
+ * one by one.
+ *
+ * @param begin          gzip stream
+ * @param size           stream size
+ * @param output_begin   destination for the decompressed data
+ * @param output_size    destination size
+ * @param threads_count  maximal number of threads to use (including the calling one)
+ *
+ * @return `output_bytes_` is the total size of the decompressed data, `checksums_.crc32_` is the CRC of it,
+ *         @ref status_list::not_supported_err if the stream consists of a single member
+ */
+auto inflate_gzip_members_parallel(uint8_t *begin,
+                                   uint32_t size,
+                                   uint8_t *output_begin,
+                                   uint32_t output_size,
+                                   uint32_t threads_count) noexcept -> decompression_operation_result_t;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_PARALLEL_INFLATE_HPP
@@ -7,6 +7,7 @@
 
 #include <util/checksum.hpp>
 #include "iterator"
+#include <cstring>
 
 #include "gzip_decorator.hpp"
 
@@ -24,6 +25,8 @@ namespace qpl::ml::compression {
 namespace gzip_sizes {
 constexpr size_t gzip_header_size  = 10;
 constexpr size_t gzip_trailer_size = 8;
+constexpr size_t gzip_subfield_header_size = 4;
+constexpr size_t min_deflate_size          = 2;
 }
 
 namespace gzip_fields {
@@ -31,6 +34,13 @@ constexpr uint8_t  ID1_RFC_VALUE             = 31u;
 constexpr uint8_t  ID2_RFC_VALUE             = 139u;
 constexpr uint8_t  CM_RFC_VALUE              = 8u;
 constexpr uint32_t GZIP_HEADER_MIN_BYTE_SIZE = 10u;
+constexpr uint8_t  BGZF_SI1_VALUE            = 66u;
+constexpr uint8_t  BGZF_SI2_VALUE            = 67u;
+constexpr uint16_t BGZF_SLEN_VALUE           = 2u;
+constexpr uint8_t  XFL_SLOWEST               = 2u;
+constexpr uint8_t  XFL_FASTEST               = 4u;
+constexpr uint8_t  OS_LAST_KNOWN             = 13u;
+constexpr uint8_t  OS_UNKNOWN                = 255u;
 }
 
 namespace gzip_flags {
@@ -56,21 +66,56 @@ std::array<uint8_t, gzip_sizes::gzip_header_size> default_gzip_header = {0x1f, 0
 static inline auto seek_until_zero(const uint8_t **begin_ptr, const uint8_t *end_ptr) noexcept -> qpl_ml_status {
     auto current_ptr = begin_ptr;
 
+    // Skip the zero-terminated string including the terminator
     do {
         if (*current_ptr == end_ptr) {
             return status_list::input_too_small;
-        } else {
-            (*current_ptr)++;
         }
-    } while ((**current_ptr) != 0u);
+    } while ((*(*current_ptr)++) != 0u);
 
     return status_list::ok;
 }
 
-static inline bool parse_gzip_flags(const uint8_t *begin_ptr,
+/**
+ * @brief Looks for the BGZF subfield `BC` in the extra field and returns the total size of the member stored in it
+ */
+static inline auto parse_gzip_extra(const uint8_t *begin_ptr,
+                                    const uint8_t *end_ptr,
+                                    uint32_t &member_size) noexcept -> qpl_ml_status {
+    const uint8_t *current_stream_ptr = begin_ptr;
+
+    while (current_stream_ptr + gzip_sizes::gzip_subfield_header_size <= end_ptr) {
+        const uint8_t si1           = current_stream_ptr[0];
+        const uint8_t si2           = current_stream_ptr[1];
+        uint16_t      subfield_size = 0u;
+
+        std::memcpy(&subfield_size, current_stream_ptr + 2, sizeof(subfield_size));
+
+        current_stream_ptr += gzip_sizes::gzip_subfield_header_size;
+
+        if (current_stream_ptr + subfield_size > end_ptr) {
+            return status_list::gzip_header_error;
+        }
+
+        if (gzip_fields::BGZF_SI1_VALUE == si1 && gzip_fields::BGZF_SI2_VALUE == si2 &&
+            gzip_fields::BGZF_SLEN_VALUE == subfield_size) {
+            uint16_t block_size = 0u;
+            std::memcpy(&block_size, current_stream_ptr, sizeof(block_size));
+
+            member_size = static_cast<uint32_t>(block_size) + 1u;
+        }
+
+        current_stream_ptr += subfield_size;
+    }
+
+    return status_list::ok;
+}
+
+static inline auto parse_gzip_flags(const uint8_t *begin_ptr,
                                     const uint8_t *end_ptr,
                                     uint8_t flags,
-                                    uint32_t &size) noexcept {
+                                    uint32_t &size,
+                                    uint32_t &member_size) noexcept -> qpl_ml_status {
     const uint8_t *current_stream_ptr = begin_ptr;
 
     if (flags & gzip_flags::reserverd_bits) {
@@ -82,13 +127,20 @@ static inline bool parse_gzip_flags(const uint8_t *begin_ptr,
             return status_list::input_too_small;
         }
 
-        uint16_t extra_length = *(reinterpret_cast<const uint16_t *>(current_stream_ptr));
+        uint16_t extra_length = 0u;
+        std::memcpy(&extra_length, current_stream_ptr, sizeof(extra_length));
         current_stream_ptr += 2;
 
         if (current_stream_ptr + extra_length > end_ptr) {
             return status_list::input_too_small;
         }
 
+        auto status = parse_gzip_extra(current_stream_ptr, current_stream_ptr + extra_length, member_size);
+
+        if (status) {
+            return status;
+        }
+
         current_stream_ptr += extra_length;
     }
 
@@ -131,7 +183,8 @@ auto gzip_decorator::read_header(const uint8_t *stream_ptr,
     const uint8_t *stream_end_ptr     = stream_ptr + stream_size;
     const uint8_t *current_stream_ptr = stream_ptr;
 
-    header.byte_size = gzip_fields::GZIP_HEADER_MIN_BYTE_SIZE;
+    header.byte_size   = gzip_fields::GZIP_HEADER_MIN_BYTE_SIZE;
+    header.member_size = 0u;
 
     const uint8_t  id1                = current_stream_ptr[0];
     const uint8_t  id2                = current_stream_ptr[1];
@@ -162,7 +215,7 @@ auto gzip_decorator::read_header(const uint8_t *stream_ptr,
 
     uint32_t gzip_extra_bytes = 0u;
 
-    auto status = parse_gzip_flags(current_stream_ptr, stream_end_ptr, flags, gzip_extra_bytes);
+    auto status = parse_gzip_flags(current_stream_ptr, stream_end_ptr, flags, gzip_extra_bytes, header.member_size);
 
     if (status) {
         return status;
@@ -175,6 +228,86 @@ auto gzip_decorator::read_header(const uint8_t *stream_ptr,
     return status;
 }
 
+static inline auto is_member_signature(const uint8_t *stream_ptr) noexcept -> bool {
+    const uint8_t extra_flags = stream_ptr[8];
+    const uint8_t os          = stream_ptr[9];
+
+    return gzip_fields::ID1_RFC_VALUE == stream_ptr[0] &&
+           gzip_fields::ID2_RFC_VALUE == stream_ptr[1] &&
+           gzip_fields::CM_RFC_VALUE == stream_ptr[2] &&
+           !(stream_ptr[3] & gzip_flags::reserverd_bits) &&
+           (0u == extra_flags || gzip_fields::XFL_SLOWEST == extra_flags || gzip_fields::XFL_FASTEST == extra_flags) &&
+           (os <= gzip_fields::OS_LAST_KNOWN || gzip_fields::OS_UNKNOWN == os);
+}
+
+auto gzip_decorator::read_member(const uint8_t *stream_ptr,
+                                 uint32_t stream_size,
+                                 gzip_member &member) noexcept -> qpl_ml_status {
+    if (stream_size < gzip_fields::GZIP_HEADER_MIN_BYTE_SIZE + gzip_sizes::gzip_trailer_size) {
+        return status_list::input_too_small;
+    }
+
+    gzip_header header{};
+
+    auto status = read_header(stream_ptr, stream_size, header);
+
+    if (status) {
+        return status;
+    }
+
+    member.header_size = header.byte_size;
+
+    if (header.member_size) {
+        // BGZF member, the size is known exactly
+        if (header.member_size < header.byte_size + gzip_sizes::gzip_trailer_size) {
+            return status_list::gzip_header_error;
+        }
+
+        if (header.member_size > stream_size) {
+            return status_list::input_too_small;
+        }
+
+        member.byte_size = header.member_size;
+        member.is_exact  = true;
+    } else {
+        // Otherwise the member is supposed to end right before the next member signature
+        const uint8_t *search_ptr = stream_ptr + header.byte_size + gzip_sizes::min_deflate_size
+                                    + gzip_sizes::gzip_trailer_size;
+        const uint8_t *last_ptr   = stream_ptr + stream_size - gzip_fields::GZIP_HEADER_MIN_BYTE_SIZE;
+
+        member.byte_size = stream_size;
+        member.is_exact  = false;
+
+        while (search_ptr <= last_ptr) {
+            search_ptr = static_cast<const uint8_t *>(std::memchr(search_ptr,
+                                                                  gzip_fields::ID1_RFC_VALUE,
+                                                                  static_cast<size_t>(std::distance(search_ptr, last_ptr)) + 1u));
+
+            if (nullptr == search_ptr) {
+                break;
+            }
+
+            if (is_member_signature(search_ptr)) {
+                member.byte_size = static_cast<uint32_t>(std::distance(stream_ptr, search_ptr));
+                break;
+            }
+
+            search_ptr++;
+        }
+
+        if (member.byte_size < header.byte_size + gzip_sizes::gzip_trailer_size) {
+            return status_list::input_too_small;
+        }
+    }
+
+    const uint8_t *trailer_ptr = stream_ptr + member.byte_size - gzip_sizes::gzip_trailer_size;
+
+    member.trailer.crc32      = *(reinterpret_cast<const uint32_t *>(trailer_ptr));
+    member.trailer.input_size = *(reinterpret_cast<const uint32_t *>(trailer_ptr + 4u));
+
+    return status_list::ok;
+}
+
 template <class F, class state_t, class ...arguments>
 auto gzip_decorator::unwrap(F function, state_t &state, arguments... args) noexcept -> decompression_operation_result_t {
     uint8_t* saved_output_ptr  = state.get_output_data(); //state.get_output_buffer;
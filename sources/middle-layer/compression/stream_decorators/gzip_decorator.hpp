@@ -47,6 +47,7 @@ public:
         uint8_t os;
         uint16_t crc16;
         uint32_t byte_size;
+        uint32_t member_size; /**< Total member size from the BGZF extra subfield `BC`, 0 if there is no one */
     };
 
     struct gzip_trailer {
@@ -54,8 +55,24 @@ public:
         uint32_t input_size;
     };
 
+    struct gzip_member {
+        uint32_t     header_size; /**< Size of the member header */
+        uint32_t     byte_size;   /**< Size of the whole member including the header and the trailer */
+        bool         is_exact;    /**< Size is read from BGZF extra field rather than guessed by the next signature */
+        gzip_trailer trailer;
+    };
+
     static auto read_header(const uint8_t *destination_ptr, uint32_t stream_size, gzip_header &header) noexcept -> qpl_ml_status;
 
+    /**
+     * @brief Reads the header of the member starting at @p stream_ptr and finds where the member ends
+     *
+     * The size is taken from the BGZF `BC` extra subfield if present. Otherwise the member is assumed to end
+     * right before the next gzip signature (or at the end of the stream), so the size must be confirmed
+     * by decompressing the member.
+     */
+    static auto read_member(const uint8_t *stream_ptr, uint32_t stream_size, gzip_member &member) noexcept -> qpl_ml_status;
+
     static inline void write_header_unsafe(const uint8_t *destination_ptr,
                                            uint32_t UNREFERENCED_PARAMETER(size)) noexcept {
         *(uint64_t *) (destination_ptr)      = *(uint64_t *) (&default_gzip_header[0]);
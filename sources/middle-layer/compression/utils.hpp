@@ -43,6 +43,7 @@ static inline auto reset_inflate_state(isal_inflate_state *state) {
     state->mini_block_size        = 0;
     state->eob_code_and_len       = 0;
     state->decomp_end_proc        = 0;
+    state->code_lengths_ptr       = nullptr;
 }
 
 } // namespace qpl::ml::compression
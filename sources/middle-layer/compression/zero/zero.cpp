@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+// core-sw
+#include "dispatcher.hpp"
+
+#include "zero.hpp"
+#include "util/checksum.hpp"
+#include "util/descriptor_processing.hpp"
+
+#include "hw_descriptors_api.h"
+#include "hw_iaa_flags.h"
+
+namespace qpl::ml::compression {
+
+static inline auto get_zero_opcode(zero_operation_type operation, zero_input_format_t input_format) noexcept -> uint32_t {
+    const bool is_32_bit_words = (input_format == zero_input_format_t::word_32_bit);
+
+    if (operation == zero_operation_type::compress) {
+        return (is_32_bit_words) ? QPL_OPCODE_Z_COMP32 : QPL_OPCODE_Z_COMP16;
+    }
+
+    return (is_32_bit_words) ? QPL_OPCODE_Z_DECOMP32 : QPL_OPCODE_Z_DECOMP16;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstack-usage=4096"
+#endif
+
+template <>
+auto call_zero_operation<execution_path_t::hardware>(zero_operation_type operation,
+                                                     zero_input_format_t input_format,
+                                                     crc_type_t crc_type,
+                                                     const uint8_t *source_ptr,
+                                                     uint32_t source_size,
+                                                     uint8_t *destination_ptr,
+                                                     uint32_t destination_size,
+                                                     int32_t numa_id) noexcept -> zero_operation_result_t {
+    HW_PATH_VOLATILE hw_completion_record HW_PATH_ALIGN_STRUCTURE completion_record{};
+    hw_descriptor HW_PATH_ALIGN_STRUCTURE                         descriptor{};
+
+    hw_iaa_descriptor_init_zero_operation(&descriptor,
+                                          get_zero_opcode(operation, input_format),
+                                          source_ptr,
+                                          source_size,
+                                          destination_ptr,
+                                          destination_size);
+
+    if (crc_type == crc_type_t::crc_32c) {
+        hw_iaa_descriptor_set_crc_rfc3720(&descriptor);
+    }
+
+    auto result = util::process_descriptor<zero_operation_result_t, util::execution_mode_t::sync>(&descriptor,
+                                                                                                  &completion_record,
+                                                                                                  numa_id);
+
+    // Accelerator always calculates checksums, they are dropped to match the software path
+    if (crc_type == crc_type_t::none) {
+        result.checksums_ = checksums_t{};
+    }
+
+    return result;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+template <>
+auto call_zero_operation<execution_path_t::software>(zero_operation_type operation,
+                                                     zero_input_format_t input_format,
+                                                     crc_type_t crc_type,
+                                                     const uint8_t *source_ptr,
+                                                     uint32_t source_size,
+                                                     uint8_t *destination_ptr,
+                                                     uint32_t destination_size,
+                                                     int32_t UNREFERENCED_PARAMETER(numa_id)) noexcept -> zero_operation_result_t {
+    zero_operation_result_t operation_result{};
+
+    const auto table       = core_sw::dispatcher::kernels_dispatcher::get_instance().get_zero_compress_table();
+    const auto index       = core_sw::dispatcher::get_zero_compress_index(operation == zero_operation_type::decompress,
+                                                                          (input_format == zero_input_format_t::word_32_bit)
+                                                                          ? 32u : 16u);
+    const auto zero_kernel = table[index];
+
+    operation_result.status_code_ = zero_kernel(source_ptr,
+                                                source_size,
+                                                destination_ptr,
+                                                destination_size,
+                                                &operation_result.output_bytes_);
+
+    if (operation_result.status_code_ != status_list::ok || crc_type == crc_type_t::none) {
+        return operation_result;
+    }
+
+    // Checksums are calculated for the uncompressed data
+    const uint8_t *data_ptr  = (operation == zero_operation_type::compress) ? source_ptr : destination_ptr;
+    const uint32_t data_size = (operation == zero_operation_type::compress) ? source_size : operation_result.output_bytes_;
+
+    operation_result.checksums_.crc32_ = (crc_type == crc_type_t::crc_32c)
+                                         ? util::crc32_iscsi_inv(data_ptr, data_ptr + data_size, 0u)
+                                         : util::crc32_gzip(data_ptr, data_ptr + data_size, 0u);
+    operation_result.checksums_.xor_   = util::xor_checksum(data_ptr, data_ptr + data_size, 0u);
+
+    return operation_result;
+}
+
+template <>
+auto call_zero_operation<execution_path_t::auto_detect>(zero_operation_type operation,
+                                                        zero_input_format_t input_format,
+                                                        crc_type_t crc_type,
+                                                        const uint8_t *source_ptr,
+                                                        uint32_t source_size,
+                                                        uint8_t *destination_ptr,
+                                                        uint32_t destination_size,
+                                                        int32_t numa_id) noexcept -> zero_operation_result_t {
+    auto hw_result = call_zero_operation<execution_path_t::hardware>(operation,
+                                                                     input_format,
+                                                                     crc_type,
+                                                                     source_ptr,
+                                                                     source_size,
+                                                                     destination_ptr,
+                                                                     destination_size,
+                                                                     numa_id);
+
+    if (hw_result.status_code_ != status_list::ok) {
+        return call_zero_operation<execution_path_t::software>(operation,
+                                                               input_format,
+                                                               crc_type,
+                                                               source_ptr,
+                                                               source_size,
+                                                               destination_ptr,
+                                                               destination_size);
+    }
+
+    return hw_result;
+}
+
+} // namespace qpl::ml::compression
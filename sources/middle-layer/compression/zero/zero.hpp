@@ -0,0 +1,33 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_COMPRESSION_ZERO_ZERO_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_COMPRESSION_ZERO_ZERO_HPP_
+
+#include "compression/zero_defs.hpp"
+#include "common/defs.hpp"
+
+namespace qpl::ml::compression {
+
+/**
+ * @brief Performs zero compress or zero decompress operation
+ *
+ * @note Checksums are calculated for the uncompressed data, i.e. the source of zero compress
+ *       and the destination of zero decompress
+ */
+template <execution_path_t path>
+auto call_zero_operation(zero_operation_type operation,
+                         zero_input_format_t input_format,
+                         crc_type_t crc_type,
+                         const uint8_t *source_ptr,
+                         uint32_t source_size,
+                         uint8_t *destination_ptr,
+                         uint32_t destination_size,
+                         int32_t numa_id = -1) noexcept -> zero_operation_result_t;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_SOURCES_MIDDLE_LAYER_COMPRESSION_ZERO_ZERO_HPP_
@@ -13,6 +13,12 @@
 #include "hw_device.hpp"
 #include "hw_descriptors_api.h"
 
+#include "hw_scheduler.hpp"
+
+#if defined( QPL_HW_EMULATION )
+#include "hw_emulated_queue.hpp"
+#endif
+
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
 #include "hw_configuration_driver.h"
 #else //DYNAMIC_LOADING_LIBACCEL_CONFIG=OFF
@@ -57,22 +63,47 @@ void hw_device::fill_hw_context(hw_accelerator_context *const hw_context_ptr) co
 }
 
 auto hw_device::enqueue_descriptor(void *desc_ptr) const noexcept -> bool {
-    uint8_t retry = 0u;
     static thread_local std::uint32_t wq_idx = 0;
 
-    // For small low-latency cases WQ with small transfer size may be preferable
-    // TODO: order WQs by priority and engines capacity, check transfer sizes and other possible features
-    for (uint64_t try_count = 0u; try_count < queue_count_; ++try_count) {
-        hw_iaa_descriptor_set_block_on_fault((hw_descriptor *) desc_ptr, working_queues_[wq_idx].get_block_on_fault());
+    auto       &tracker               = hw_inflight_tracker::get_instance();
+    const auto *completion_record_ptr = reinterpret_cast<hw_iaa_analytics_descriptor *>(desc_ptr)->completion_record_ptr;
+
+    // The least loaded WQ is tried first, the idle ones are taken round-robin
+    std::array<uint32_t, max_working_queues> order{};
+    order_by_load(queue_count_, [this](uint32_t idx) { return working_queues_[idx].load(); }, wq_idx++, order.data());
+
+    bool retry = true;
+
+    for (uint32_t try_count = 0u; retry && try_count < queue_count_; ++try_count) {
+        const auto &queue = working_queues_[order[try_count]];
+
+        hw_iaa_descriptor_set_block_on_fault((hw_descriptor *) desc_ptr, queue.get_block_on_fault());
 
-        retry = working_queues_[wq_idx].enqueue_descriptor(desc_ptr);
-        wq_idx = (wq_idx+1) % queue_count_;
-        if (!retry) {
-            break;
+        const bool is_tracked = tracker.track(completion_record_ptr, &queue.occupancy());
+
+        retry = static_cast<bool>(queue.enqueue_descriptor(desc_ptr));
+
+        if (retry && is_tracked) {
+            tracker.cancel(completion_record_ptr);
         }
     }
 
-    return static_cast<bool>(retry);
+    return retry;
+}
+
+auto hw_device::load() const noexcept -> hw_load_t {
+    hw_load_t device_load{0u, 0u, 1u};
+
+    for (uint32_t idx = 0u; idx < queue_count_; idx++) {
+        const auto queue_load = working_queues_[idx].load();
+
+        device_load.in_flight += queue_load.in_flight;
+        device_load.capacity  += queue_load.capacity;
+    }
+
+    device_load.capacity = (device_load.capacity > 0u) ? device_load.capacity : 1u;
+
+    return device_load;
 }
 
 auto hw_device::get_max_set_size() const noexcept -> uint32_t {
@@ -210,6 +241,27 @@ auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr) noexc
     return HW_ACCELERATOR_STATUS_OK;
 }
 
+#if defined( QPL_HW_EMULATION )
+auto hw_device::initialize_emulated_device() noexcept -> hw_accelerator_status {
+    // Decompression support, 1 GB transfer size and 32 KB sets, no IAA gen 2 features
+    gen_cap_register_ = (1ull << 40u) | (30ull << 16u) | (14ull << 42u) | (14ull << 47u);
+    iaa_cap_register_ = 0u;
+    numa_node_id_     = static_cast<uint64_t>(-1);  // Used by the jobs of any NUMA node
+    queue_count_      = 1u;
+    version_major_    = 1u;
+    version_minor_    = 0u;
+
+    working_queues_[0].initialize_emulated_queue(hw_emulated_queue::get_instance().queue_depth());
+
+    DIAG("emulated: engines: %" PRIu32 "\n", hw_emulated_queue::get_instance().engines_count());
+    DIAG("emulated: queue depth: %" PRIu32 "\n", hw_emulated_queue::get_instance().queue_depth());
+    DIAG("emulated: latency: %" PRIu64 " ns\n", static_cast<uint64_t>(hw_emulated_queue::get_instance().latency().count()));
+    DIAG("emulated: GENCAP: %" PRIu64 "\n", gen_cap_register_);
+
+    return HW_ACCELERATOR_STATUS_OK;
+}
+#endif
+
 auto hw_device::size() const noexcept -> size_t {
     return queue_count_;
 }
@@ -13,6 +13,7 @@
 
 #include "qpl/c_api/defs.h"
 #include "hw_queue.hpp"
+#include "hw_scheduler.hpp"
 #include "hw_devices.h"
 #include "hw_status.h"
 
@@ -33,10 +34,27 @@ public:
 
     void fill_hw_context(hw_accelerator_context *hw_context_ptr) const noexcept;
 
+    /**
+     * @brief Submits the descriptor to the least loaded work queue, the busy ones are skipped
+     *
+     * @return true if all work queues are busy
+     */
     [[nodiscard]] auto enqueue_descriptor(void *desc_ptr) const noexcept -> bool;
 
+    /**
+     * @brief Summary load of the device work queues
+     */
+    [[nodiscard]] auto load() const noexcept -> hw_load_t;
+
     [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> hw_accelerator_status;
 
+#if defined( QPL_HW_EMULATION )
+    /**
+     * @brief Initializes the device with a single software emulated work queue instead of the accelerator one
+     */
+    [[nodiscard]] auto initialize_emulated_device() noexcept -> hw_accelerator_status;
+#endif
+
     [[nodiscard]] auto size() const noexcept -> size_t;
 
     [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
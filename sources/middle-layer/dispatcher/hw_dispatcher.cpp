@@ -26,7 +26,18 @@ hw_dispatcher::hw_dispatcher() noexcept {
 }
 
 auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
-#if defined( __linux__ )
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+    DIAG("Intel QPL version %s\n", QPL_VERSION);
+    DIAG("using software emulated device\n");
+
+    // The emulated device replaces the accelerators, so libaccel-config isn't used
+    auto status = devices_[0].initialize_emulated_device();
+    QPL_HWSTS_RET(status != HW_ACCELERATOR_STATUS_OK, status);
+
+    device_count_ = 1u;
+
+    return HW_ACCELERATOR_STATUS_OK;
+#elif defined( __linux__ )
     accfg_ctx *ctx_ptr = nullptr;
 
     DIAG("Intel QPL version %s\n", QPL_VERSION);
@@ -0,0 +1,1056 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include "hw_emulated_engine.hpp"
+#include "hw_aecs_api.h"
+#include "hw_iaa_flags.h"
+#include "own_hw_definitions.h"
+
+#include "analytics/scan.hpp"
+#include "analytics/extract.hpp"
+#include "analytics/select.hpp"
+#include "analytics/expand.hpp"
+#include "other/crc.hpp"
+#include "compression/zero/zero.hpp"
+#include "compression/inflate/inflate.hpp"
+#include "compression/inflate/inflate_state.hpp"
+#include "common/allocation_buffer_t.hpp"
+#include "common/limited_buffer.hpp"
+#include "common/linear_allocator.hpp"
+#include "util/checksum.hpp"
+
+namespace qpl::ml::dispatcher {
+
+namespace {
+
+// Sizes of the scratch buffers match the ones of the software path analytics state
+constexpr uint32_t max_elements_count  = 4096u;
+constexpr uint32_t unpack_buffer_size  = (max_elements_count + 1u) * sizeof(uint32_t);
+constexpr uint32_t set_buffer_size     = 1u << 15u;
+constexpr uint32_t src2_buffer_size    = max_elements_count * sizeof(uint32_t);
+
+// Filter flags fields, see hw_analytic_descriptor_base.c
+constexpr uint32_t filter_flags_src2_be = 1u << 12u;
+
+// Suppressed output of the decompress is decoded into the scratch window of this size
+constexpr uint32_t decompress_window_size = 64u * 1024u;
+
+// Compress finds matches within the 4 KB history of the engine, see RFC 1951 for the codes of lengths and distances
+constexpr uint32_t min_match_length    = 3u;
+constexpr uint32_t max_match_length    = 258u;
+constexpr uint32_t max_match_distance  = 4096u;
+constexpr uint32_t match_hash_bits     = 12u;
+constexpr uint32_t match_table_size    = 1u << match_hash_bits;
+constexpr uint32_t eob_symbol          = 256u;
+constexpr uint32_t first_length_symbol = 257u;
+
+constexpr std::array<uint16_t, 29u> length_bases      = {3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 13u, 15u, 17u, 19u, 23u, 27u,
+                                                         31u, 35u, 43u, 51u, 59u, 67u, 83u, 99u, 115u, 131u, 163u, 195u,
+                                                         227u, 258u};
+constexpr std::array<uint8_t, 29u>  length_extra_bits = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u,
+                                                         2u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 4u, 5u, 5u, 5u, 5u, 0u};
+
+constexpr std::array<uint16_t, 30u> distance_bases      = {1u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 17u, 25u, 33u, 49u, 65u, 97u,
+                                                           129u, 193u, 257u, 385u, 513u, 769u, 1025u, 1537u, 2049u,
+                                                           3073u, 4097u, 6145u, 8193u, 12289u, 16385u, 24577u};
+constexpr std::array<uint8_t, 30u>  distance_extra_bits = {0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u, 6u,
+                                                           6u, 7u, 7u, 8u, 8u, 9u, 9u, 10u, 10u, 11u, 11u, 12u, 12u,
+                                                           13u, 13u};
+
+// Inflate state saved for the next descriptor is marked by this bit of the AECS decompress state
+constexpr uint16_t emulated_state_flag  = 0x8000u;
+constexpr uint32_t saved_states_count   = 64u;
+constexpr uint32_t max_input_accum_bits = 56u;
+
+// Compress codes keep the length in bits 18:15 and the code in bits 14:0, see hw_iaa_aecs_compress
+constexpr uint32_t code_length_shift = 15u;
+constexpr uint32_t code_mask         = (1u << code_length_shift) - 1u;
+
+using inflate_state_t = compression::inflate_state<execution_path_t::software>;
+
+constexpr inline auto get_parser(uint32_t filter_flags) noexcept -> uint32_t {
+    return filter_flags & 3u;
+}
+
+constexpr inline auto get_source_1_bit_width(uint32_t filter_flags) noexcept -> uint32_t {
+    return ((filter_flags >> 2u) & 0x1Fu) + 1u;
+}
+
+constexpr inline auto get_output_format(uint32_t filter_flags) noexcept -> uint32_t {
+    return (filter_flags >> 13u) & 3u;
+}
+
+constexpr inline auto has_dropped_bits(uint32_t filter_flags) noexcept -> bool {
+    return (filter_flags >> 17u) & 0x3FFu;
+}
+
+/**
+ * @brief Scratch buffers owned by the engine thread, allocated on the first use
+ */
+struct engine_buffers_t {
+    std::unique_ptr<uint8_t[]> unpack;
+    std::unique_ptr<uint8_t[]> set;
+    std::unique_ptr<uint8_t[]> src2;
+    std::unique_ptr<uint8_t[]> inflate_state;
+    std::unique_ptr<uint8_t[]> inflate_window;
+    std::unique_ptr<uint32_t[]> match_table;
+};
+
+auto get_engine_buffers() noexcept -> engine_buffers_t * {
+    static thread_local engine_buffers_t buffers;
+
+    if (!buffers.unpack) {
+        buffers.unpack.reset(new (std::nothrow) uint8_t[unpack_buffer_size]);
+        buffers.set.reset(new (std::nothrow) uint8_t[set_buffer_size]);
+        buffers.src2.reset(new (std::nothrow) uint8_t[src2_buffer_size]);
+        buffers.inflate_state.reset(new (std::nothrow) uint8_t[inflate_state_t::get_buffer_size()]);
+        buffers.inflate_window.reset(new (std::nothrow) uint8_t[decompress_window_size]);
+        buffers.match_table.reset(new (std::nothrow) uint32_t[match_table_size]);
+    }
+
+    if (!buffers.unpack || !buffers.set || !buffers.src2 || !buffers.inflate_state
+        || !buffers.inflate_window || !buffers.match_table) {
+        buffers = engine_buffers_t{};
+
+        return nullptr;
+    }
+
+    return &buffers;
+}
+
+/**
+ * @brief Reverse of util::convert_status_iaa_to_qpl, so the library reports the status of the software kernel
+ */
+void set_status(hw_iaa_completion_record &record, uint32_t status) noexcept {
+    if (status_list::ok == status) {
+        record.status = AD_STATUS_SUCCESS;
+    } else if (status >= status_list::hardware_status_base) {
+        record.status = static_cast<hw_operation_status>(status - status_list::hardware_status_base);
+    } else if (status >= status_list::hardware_error_base) {
+        record.status     = AD_STATUS_ANALYTICS_ERROR;
+        record.error_code = static_cast<hw_operation_error>(status - status_list::hardware_error_base);
+    } else if (status_list::more_output_needed == status) {
+        record.status = AD_STATUS_OUTPUT_OVERFLOW;
+    } else {
+        record.status = AD_STATUS_INVALID_OP_FLAG;
+    }
+}
+
+void set_analytic_result(hw_iaa_completion_record &record,
+                         const analytics::analytic_operation_result_t &result,
+                         uint32_t source_size) noexcept {
+    set_status(record, result.status_code_);
+
+    record.bytes_completed = source_size;
+    record.output_size     = result.output_bytes_;
+    record.output_bits     = result.last_bit_offset_;
+    record.min_first_agg   = result.aggregates_.min_value_;
+    record.max_last_agg    = result.aggregates_.max_value_;
+    record.sum_agg         = static_cast<uint32_t>(result.aggregates_.sum_);
+    record.crc             = result.checksums_.crc32_;
+    record.xor_checksum    = static_cast<uint16_t>(result.checksums_.xor_);
+}
+
+void execute_crc64(const hw_iaa_analytics_descriptor &descriptor, hw_iaa_completion_record &record) noexcept {
+    // CRC64 descriptor keeps the flags in place of decompression flags and the polynomial in place of the filter ones
+    const uint64_t polynomial = descriptor.filter_flags
+                                | (static_cast<uint64_t>(descriptor.num_input_elements) << 32u);
+
+    auto result = other::call_crc<execution_path_t::software>(descriptor.src1_ptr,
+                                                              descriptor.src1_size,
+                                                              polynomial,
+                                                              descriptor.decomp_flags & ADC64F_BE,
+                                                              descriptor.decomp_flags & ADC64F_INVCRC);
+
+    set_status(record, result.status_code_);
+
+    record.bytes_completed = descriptor.src1_size;
+    record.max_last_agg    = static_cast<uint32_t>(result.crc_);
+    record.sum_agg         = static_cast<uint32_t>(result.crc_ >> 32u);
+}
+
+void execute_zero_operation(const hw_iaa_analytics_descriptor &descriptor, hw_iaa_completion_record &record) noexcept {
+    const uint32_t opcode = ADOF_GET_OPCODE(descriptor.op_code_op_flags);
+
+    const auto operation    = (QPL_OPCODE_Z_DECOMP16 == opcode || QPL_OPCODE_Z_DECOMP32 == opcode)
+                              ? compression::zero_operation_type::decompress
+                              : compression::zero_operation_type::compress;
+    const auto input_format = (QPL_OPCODE_Z_COMP32 == opcode || QPL_OPCODE_Z_DECOMP32 == opcode)
+                              ? compression::zero_input_format_t::word_32_bit
+                              : compression::zero_input_format_t::word_16_bit;
+    const auto crc_type     = (descriptor.op_code_op_flags & ADOF_CRC32C)
+                              ? compression::crc_type_t::crc_32c
+                              : compression::crc_type_t::crc_32;
+
+    auto result = compression::call_zero_operation<execution_path_t::software>(operation,
+                                                                               input_format,
+                                                                               crc_type,
+                                                                               descriptor.src1_ptr,
+                                                                               descriptor.src1_size,
+                                                                               descriptor.dst_ptr,
+                                                                               descriptor.max_dst_size);
+
+    set_status(record, result.status_code_);
+
+    record.bytes_completed = descriptor.src1_size;
+    record.output_size     = result.output_bytes_;
+    record.crc             = result.checksums_.crc32_;
+    record.xor_checksum    = static_cast<uint16_t>(result.checksums_.xor_);
+}
+
+auto get_end_processing_condition(uint16_t decomp_flags) noexcept -> compression::end_processing_condition_t {
+    const bool is_stop   = decomp_flags & ADDF_STOP_ON_EOB;
+    const bool is_check  = decomp_flags & ADDF_CHECK_FOR_EOB;
+    const bool is_bfinal = decomp_flags & ADDF_SEL_BFINAL_EOB;
+
+    if (is_stop) {
+        if (is_check) {
+            return is_bfinal ? compression::stop_and_check_for_bfinal_eob : compression::stop_and_check_any_eob;
+        }
+
+        return is_bfinal ? compression::stop_on_bfinal_eob : compression::stop_on_any_eob;
+    }
+
+    if (is_check) {
+        return is_bfinal ? compression::check_for_bfinal_eob : compression::check_for_any_eob;
+    }
+
+    return compression::dont_stop_or_check;
+}
+
+/**
+ * @brief Inflate states of the streams that are continued by the next descriptor
+ *
+ * @details The accelerator keeps the decoder state in AECS, the software state doesn't fit there,
+ *          so AECS keeps only the stamp of the state stored here. The oldest states are overwritten
+ */
+class saved_inflate_states_t final {
+public:
+    static auto get_instance() noexcept -> saved_inflate_states_t & {
+        static saved_inflate_states_t instance{};
+
+        return instance;
+    }
+
+    [[nodiscard]] auto save(const uint8_t *state_ptr) noexcept -> uint64_t {
+        const uint32_t state_size = inflate_state_t::get_buffer_size();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto &slot = slots_[next_stamp_ % saved_states_count];
+
+        if (!slot.state) {
+            slot.state.reset(new (std::nothrow) uint8_t[state_size]);
+
+            if (!slot.state) {
+                return 0u;
+            }
+        }
+
+        std::memcpy(slot.state.get(), state_ptr, state_size);
+        slot.stamp = next_stamp_++;
+
+        return slot.stamp;
+    }
+
+    [[nodiscard]] auto load(uint64_t stamp, uint8_t *state_ptr) noexcept -> bool {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto &slot = slots_[stamp % saved_states_count];
+
+        if (0u == stamp || slot.stamp != stamp) {
+            return false;
+        }
+
+        std::memcpy(state_ptr, slot.state.get(), inflate_state_t::get_buffer_size());
+
+        return true;
+    }
+
+private:
+    struct slot_t {
+        uint64_t                   stamp = 0u;
+        std::unique_ptr<uint8_t[]> state;
+    };
+
+    std::mutex                             mutex_;
+    std::array<slot_t, saved_states_count> slots_{};
+    uint64_t                               next_stamp_ = 1u;
+};
+
+/**
+ * @brief Wraps the engine inflate state buffer, the state is reset unless it's continued
+ */
+auto get_inflate_state(uint8_t *buffer_ptr, bool is_continued) noexcept -> inflate_state_t {
+    allocation_buffer_t state_buffer(buffer_ptr, buffer_ptr + inflate_state_t::get_buffer_size());
+
+    const util::linear_allocator allocator(state_buffer);
+
+    return is_continued ? inflate_state_t::restore(allocator) : inflate_state_t::create<true>(allocator);
+}
+
+/**
+ * @brief Sets the history and the input accumulator of AECS to the state that starts at a block header
+ */
+auto start_inflate_from_aecs(const hw_iaa_aecs_decompress &options, isal_inflate_state &state) noexcept -> bool {
+    constexpr uint32_t history_size = sizeof(options.history_buffer);
+
+    std::array<uint8_t, history_size> history{};
+
+    // History buffer is circular after it's overflowed
+    const uint32_t write_offset   = std::min<uint32_t>(options.history_buffer_params.history_buffer_write_offset,
+                                                       history_size);
+    uint32_t       history_length = write_offset;
+
+    if (options.history_buffer_params.is_history_buffer_overflowed) {
+        std::copy(options.history_buffer + write_offset, options.history_buffer + history_size, history.begin());
+        std::copy(options.history_buffer, options.history_buffer + write_offset,
+                  history.begin() + (history_size - write_offset));
+
+        history_length = history_size;
+    } else {
+        std::copy(options.history_buffer, options.history_buffer + write_offset, history.begin());
+    }
+
+    if (0u != history_length && 0 != isal_inflate_set_dict(&state, history.data(), history_length)) {
+        return false;
+    }
+
+    // Bits left in the input accumulator precede source-1
+    uint32_t bits_count = 0u;
+
+    for (uint32_t i = 0u; i < sizeof(options.input_accum_size) && 0u != options.input_accum_size[i]; i++) {
+        const uint32_t size = options.input_accum_size[i];
+
+        if (bits_count + size > max_input_accum_bits) {
+            return false;
+        }
+
+        state.read_in |= (options.input_accum[i] & ((1ull << size) - 1u)) << bits_count;
+        bits_count += size;
+    }
+
+    state.read_in_length = static_cast<int32_t>(bits_count);
+
+    return true;
+}
+
+auto get_decompress_state(const isal_inflate_state &state) noexcept -> uint16_t {
+    switch (state.block_state) {
+        case ISAL_BLOCK_CODED: {
+            return state.bfinal ? hw_aecs_at_ll_token_final_block : hw_aecs_at_ll_token_non_final_block;
+        }
+        case ISAL_BLOCK_TYPE0: {
+            return state.bfinal ? hw_aecs_at_stored_block_final_block : hw_aecs_at_stored_block_non_final_block;
+        }
+        default: {
+            return hw_aecs_at_start_block_header;
+        }
+    }
+}
+
+auto is_inflate_stopped(const isal_inflate_state &state, compression::end_processing_condition_t condition) noexcept
+-> bool {
+    const bool is_stop_on_any_eob = compression::stop_on_any_eob == condition
+                                    || compression::stop_and_check_any_eob == condition;
+
+    return ISAL_BLOCK_INPUT_DONE == state.block_state
+           || ISAL_BLOCK_FINISH == state.block_state
+           || (ISAL_BLOCK_NEW_HDR == state.block_state && is_stop_on_any_eob);
+}
+
+void update_checksums(const uint8_t *begin, const uint8_t *end, bool is_crc32c, uint32_t &crc, uint32_t &xor_checksum)
+noexcept {
+    crc          = is_crc32c ? util::crc32_iscsi_inv(begin, end, crc) : util::crc32_gzip(begin, end, crc);
+    xor_checksum = util::xor_checksum(begin, end, xor_checksum);
+}
+
+void execute_decompress(const hw_iaa_analytics_descriptor &descriptor,
+                        engine_buffers_t &buffers,
+                        hw_iaa_completion_record &record) noexcept {
+    constexpr uint16_t unsupported_flags = ADDF_DECOMP_BE | ADDF_IGNORE_END_BITS(7u) | ADDF_ENABLE_IDXING(7u);
+
+    const uint32_t read_policy   = (descriptor.op_code_op_flags >> 16u) & 3u;
+    const uint32_t write_policy  = (descriptor.op_code_op_flags >> 18u) & 3u;
+    const uint32_t aecs_index    = (descriptor.op_code_op_flags & ADOF_AECS_SEL) ? 1u : 0u;
+    const bool     is_crc32c     = descriptor.op_code_op_flags & ADOF_CRC32C;
+    const bool     is_suppressed = descriptor.decomp_flags & ADDF_SUPPRESS_OUTPUT;
+    const bool     is_aecs_used  = AD_RDSRC2_UNUSED != read_policy || AD_WRSRC2_NEVER != write_policy;
+
+    // Huffman tables are loaded by the library into the AECS without history buffer, they aren't emulated
+    if ((descriptor.decomp_flags & unsupported_flags)
+        || (AD_RDSRC2_UNUSED != read_policy && AD_RDSRC2_AECS != read_policy)
+        || (is_aecs_used && descriptor.src2_size < sizeof(hw_iaa_aecs_analytic))) {
+        record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+
+        return;
+    }
+
+    auto *read_aecs_ptr  = reinterpret_cast<hw_iaa_aecs_analytic *>(descriptor.src2_ptr
+                                                                     + descriptor.src2_size * aecs_index);
+    auto *write_aecs_ptr = reinterpret_cast<hw_iaa_aecs_analytic *>(descriptor.src2_ptr
+                                                                     + descriptor.src2_size * (aecs_index ^ 1u));
+
+    uint32_t crc          = 0u;
+    uint32_t xor_checksum = 0u;
+    bool     is_continued = false;
+
+    if (AD_RDSRC2_AECS == read_policy) {
+        const auto &options = read_aecs_ptr->inflate_options;
+
+        crc          = read_aecs_ptr->filtering_options.crc;
+        xor_checksum = read_aecs_ptr->filtering_options.xor_checksum;
+
+        if (options.decompress_state & emulated_state_flag) {
+            uint64_t stamp = 0u;
+
+            std::memcpy(&stamp, options.reserved9, sizeof(stamp));
+
+            if (!saved_inflate_states_t::get_instance().load(stamp, buffers.inflate_state.get())) {
+                set_status(record, status_list::hardware_error_base + AD_ERROR_CODE_AECS_ERROR);
+
+                return;
+            }
+
+            is_continued = true;
+        } else if (hw_aecs_at_start_block_header != (options.decompress_state & 0xFu)) {
+            record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+
+            return;
+        }
+    }
+
+    auto state = get_inflate_state(buffers.inflate_state.get(), is_continued);
+
+    if (AD_RDSRC2_AECS == read_policy && !is_continued
+        && !start_inflate_from_aecs(read_aecs_ptr->inflate_options, *state.get_state())) {
+        set_status(record, status_list::hardware_error_base + AD_ERROR_CODE_AECS_ERROR);
+
+        return;
+    }
+
+    // Decoded data is kept in the state for the next descriptor unless the output is flushed
+    const bool is_final  = (descriptor.decomp_flags & ADDF_FLUSH_OUTPUT) || AD_WRSRC2_NEVER == write_policy;
+    const auto condition = get_end_processing_condition(descriptor.decomp_flags);
+
+    state.input(descriptor.src1_ptr, descriptor.src1_ptr + descriptor.src1_size);
+
+    if (is_final) {
+        state.terminate();
+    }
+
+    const auto *isal_state_ptr = state.get_state();
+
+    const auto has_pending_output = [isal_state_ptr]() noexcept {
+        return isal_state_ptr->tmp_out_valid != isal_state_ptr->tmp_out_processed;
+    };
+    const auto has_pending_input  = [isal_state_ptr, condition]() noexcept {
+        return 0u != isal_state_ptr->avail_in && !is_inflate_stopped(*isal_state_ptr, condition);
+    };
+
+    compression::decompression_operation_result_t result{};
+
+    uint32_t output_size = 0u;
+
+    if (is_suppressed) {
+        // Suppressed output is decoded by windows just to calculate the checksums
+        uint8_t *window_begin = buffers.inflate_window.get();
+        bool    is_window_full;
+
+        do {
+            state.output(window_begin, window_begin + decompress_window_size);
+
+            result = compression::inflate<execution_path_t::software, compression::inflate_mode_t::inflate_default>(
+                    state, condition);
+
+            update_checksums(window_begin, window_begin + result.output_bytes_, is_crc32c, crc, xor_checksum);
+
+            // Next windows continue the same state
+            is_window_full = decompress_window_size == result.output_bytes_;
+            state          = get_inflate_state(buffers.inflate_state.get(), true);
+
+            if (is_final) {
+                state.terminate();
+            }
+        } while ((status_list::ok == result.status_code_ || status_list::more_output_needed == result.status_code_)
+                 && is_window_full && (has_pending_output() || has_pending_input()));
+    } else {
+        state.output(descriptor.dst_ptr, descriptor.dst_ptr + descriptor.max_dst_size);
+
+        result = compression::inflate<execution_path_t::software, compression::inflate_mode_t::inflate_default>(
+                state, condition);
+
+        output_size = result.output_bytes_;
+
+        update_checksums(descriptor.dst_ptr, descriptor.dst_ptr + output_size, is_crc32c, crc, xor_checksum);
+    }
+
+    const bool is_overflow = status_list::more_output_needed == result.status_code_
+                             || (!is_suppressed
+                                 && 0u == isal_state_ptr->avail_out
+                                 && (has_pending_output() || has_pending_input()));
+
+    if (status_list::ok != result.status_code_ && status_list::more_output_needed != result.status_code_) {
+        set_status(record, result.status_code_);
+
+        return;
+    }
+
+    record.status          = is_overflow ? AD_STATUS_OUTPUT_OVERFLOW : AD_STATUS_SUCCESS;
+    record.bytes_completed = static_cast<uint32_t>(isal_state_ptr->next_in - descriptor.src1_ptr);
+    record.output_size     = output_size;
+    record.crc             = crc;
+    record.xor_checksum    = static_cast<uint16_t>(xor_checksum);
+
+    if (AD_WRSRC2_ALWAYS == write_policy || (AD_WRSRC2_MAYBE == write_policy && is_overflow)) {
+        const uint64_t stamp = saved_inflate_states_t::get_instance().save(buffers.inflate_state.get());
+
+        if (0u == stamp) {
+            set_status(record, status_list::internal_error);
+
+            return;
+        }
+
+        auto &options = write_aecs_ptr->inflate_options;
+
+        write_aecs_ptr->filtering_options.crc          = crc;
+        write_aecs_ptr->filtering_options.xor_checksum = xor_checksum;
+
+        options.decompress_state = get_decompress_state(*isal_state_ptr) | emulated_state_flag;
+        std::memcpy(options.reserved9, &stamp, sizeof(stamp));
+    }
+}
+
+void execute_filter(const hw_iaa_analytics_descriptor &descriptor,
+                    engine_buffers_t &buffers,
+                    hw_iaa_completion_record &record) noexcept {
+    using namespace analytics;
+
+    const uint32_t opcode       = ADOF_GET_OPCODE(descriptor.op_code_op_flags);
+    const uint32_t filter_flags = descriptor.filter_flags;
+
+    // Decompression of source-1 and bits dropping are done by the engine pipeline that isn't emulated
+    if ((descriptor.decomp_flags & ADDF_ENABLE_DECOMP) || has_dropped_bits(filter_flags)) {
+        record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+
+        return;
+    }
+
+    const auto input_format   = static_cast<stream_format_t>(get_parser(filter_flags));
+    const bool is_prle        = input_format == stream_format_t::prle_format;
+    const auto output_format  = static_cast<output_bit_width_format_t>(get_output_format(filter_flags));
+    const auto output_stream_format = (filter_flags & ADFF_OUT_BE) ? stream_format_t::be_format
+                                                                   : stream_format_t::le_format;
+
+    if (is_prle && 0u == descriptor.src1_size) {
+        set_status(record, status_list::source_is_short_error);
+
+        return;
+    }
+
+    auto *src_begin = descriptor.src1_ptr;
+    auto *src_end   = descriptor.src1_ptr + descriptor.src1_size;
+    auto *dst_begin = descriptor.dst_ptr;
+    auto *dst_end   = descriptor.dst_ptr + descriptor.max_dst_size;
+
+    auto input_stream = input_stream_t::builder(src_begin, src_end)
+            .element_count(descriptor.num_input_elements)
+            .crc_type((descriptor.op_code_op_flags & ADOF_CRC32C) ? input_stream_t::crc_t::iscsi
+                                                                  : input_stream_t::crc_t::gzip)
+            .stream_format(input_format, is_prle ? 0u : get_source_1_bit_width(filter_flags))
+            .build<execution_path_t::software>();
+
+    if (input_stream.bit_width() < 1u || input_stream.bit_width() > 32u) {
+        set_status(record, status_list::bit_width_error);
+
+        return;
+    }
+
+    limited_buffer_t unpack_buffer(buffers.unpack.get(),
+                                   buffers.unpack.get() + unpack_buffer_size,
+                                   static_cast<uint8_t>(input_stream.bit_width()));
+
+    analytic_operation_result_t result{};
+
+    switch (opcode) {
+        case QPL_OPCODE_SCAN:
+        case QPL_OPCODE_EXTRACT: {
+            // Range and initial output index are passed through AECS
+            const auto *aecs_ptr = reinterpret_cast<const hw_iaa_aecs_analytic *>(descriptor.src2_ptr);
+            const auto &options  = aecs_ptr->filtering_options;
+
+            if (QPL_OPCODE_SCAN == opcode) {
+                auto output_stream = output_stream_t<bit_stream>::builder(dst_begin, dst_end)
+                        .stream_format(output_stream_format)
+                        .bit_format(output_format, bit_bits_size)
+                        .nominal(true)
+                        .initial_output_index(options.output_mod_idx)
+                        .build<execution_path_t::software>();
+
+                // Inverted output of the range check is the out of range check
+                result = (filter_flags & ADFF_INV_OUTPUT)
+                         ? call_scan_sw<out_of_range>(input_stream, output_stream,
+                                                      options.filter_low, options.filter_high, unpack_buffer)
+                         : call_scan_sw<in_range>(input_stream, output_stream,
+                                                  options.filter_low, options.filter_high, unpack_buffer);
+            } else {
+                auto output_stream = output_stream_t<array_stream>::builder(dst_begin, dst_end)
+                        .stream_format(output_stream_format)
+                        .bit_format(output_format, input_stream.bit_width())
+                        .nominal(input_stream.bit_width() == bit_bits_size)
+                        .initial_output_index(options.output_mod_idx)
+                        .build<execution_path_t::software>();
+
+                result = call_extract<execution_path_t::software>(input_stream, output_stream,
+                                                                  options.filter_low, options.filter_high,
+                                                                  unpack_buffer);
+            }
+            break;
+        }
+        case QPL_OPCODE_SELECT:
+        case QPL_OPCODE_EXPAND: {
+            // Mask is a bit vector passed through source-2
+            auto *mask_begin = descriptor.src2_ptr;
+            auto *mask_end   = descriptor.src2_ptr + descriptor.src2_size;
+
+            auto mask_stream = input_stream_t::builder(mask_begin, mask_end)
+                    .element_count(descriptor.src2_size * byte_bits_size)
+                    .stream_format((filter_flags & filter_flags_src2_be) ? stream_format_t::be_format
+                                                                         : stream_format_t::le_format,
+                                   bit_bits_size)
+                    .build<execution_path_t::software>();
+
+            auto output_stream = output_stream_t<array_stream>::builder(dst_begin, dst_end)
+                    .stream_format(output_stream_format)
+                    .bit_format(output_format, input_stream.bit_width())
+                    .nominal(input_stream.bit_width() == bit_bits_size)
+                    .build<execution_path_t::software>();
+
+            if (QPL_OPCODE_SELECT == opcode) {
+                limited_buffer_t set_buffer(buffers.src2.get(), buffers.src2.get() + src2_buffer_size, byte_bits_size);
+                limited_buffer_t output_buffer(buffers.set.get(), buffers.set.get() + set_buffer_size, bit_bits_size);
+
+                result = call_select<execution_path_t::software>(input_stream, mask_stream, output_stream,
+                                                                 unpack_buffer, set_buffer, output_buffer);
+            } else {
+                limited_buffer_t mask_buffer(buffers.src2.get(), buffers.src2.get() + src2_buffer_size, byte_bits_size);
+                limited_buffer_t output_buffer(buffers.set.get(), buffers.set.get() + set_buffer_size, bit_bits_size);
+
+                result = call_expand<execution_path_t::software>(input_stream, mask_stream, output_stream,
+                                                                 unpack_buffer, mask_buffer, output_buffer);
+            }
+            break;
+        }
+        default: {
+            record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+
+            return;
+        }
+    }
+
+    set_analytic_result(record, result, descriptor.src1_size);
+}
+
+/**
+ * @brief Writes the deflate stream bits LSB first, the writer stops at the end of the destination
+ */
+class bit_writer_t final {
+public:
+    bit_writer_t(uint8_t *begin, uint8_t *end) noexcept
+            : begin_ptr_(begin), current_ptr_(begin), end_ptr_(end) {
+    }
+
+    [[nodiscard]] auto write(uint64_t bits, uint32_t bits_count) noexcept -> bool {
+        buffer_ |= bits << buffer_bits_;
+        buffer_bits_ += bits_count;
+
+        while (buffer_bits_ >= byte_bits_size) {
+            if (current_ptr_ == end_ptr_) {
+                return false;
+            }
+
+            *current_ptr_++ = static_cast<uint8_t>(buffer_);
+
+            buffer_ >>= byte_bits_size;
+            buffer_bits_ -= byte_bits_size;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] auto align() noexcept -> bool {
+        return write(0u, (byte_bits_size - buffer_bits_) % byte_bits_size);
+    }
+
+    [[nodiscard]] auto bytes_written() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(current_ptr_ - begin_ptr_);
+    }
+
+    [[nodiscard]] auto pending_bits() const noexcept -> uint32_t {
+        return buffer_bits_;
+    }
+
+    [[nodiscard]] auto pending_byte() const noexcept -> uint8_t {
+        return static_cast<uint8_t>(buffer_);
+    }
+
+private:
+    uint8_t  *begin_ptr_;
+    uint8_t  *current_ptr_;
+    uint8_t  *end_ptr_;
+    uint64_t buffer_      = 0u;
+    uint32_t buffer_bits_ = 0u;
+};
+
+constexpr auto reverse_code(uint32_t code, uint32_t length) noexcept -> uint32_t {
+    uint32_t result = 0u;
+
+    for (uint32_t i = 0u; i < length; i++) {
+        result = (result << 1u) | ((code >> i) & 1u);
+    }
+
+    return result;
+}
+
+template <class bases_t>
+constexpr auto get_symbol_index(const bases_t &bases, uint32_t value) noexcept -> uint32_t {
+    uint32_t index = static_cast<uint32_t>(bases.size()) - 1u;
+
+    while (bases[index] > value) {
+        index--;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Greedy LZ77 over the source with matches in the history of the engine
+ */
+template <class literal_handler_t, class match_handler_t>
+auto tokenize(const uint8_t *source_ptr,
+              uint32_t source_size,
+              bool is_literals_only,
+              uint32_t *match_table_ptr,
+              literal_handler_t &&on_literal,
+              match_handler_t &&on_match) noexcept -> bool {
+    const auto hash = [source_ptr](uint32_t position) noexcept -> uint32_t {
+        const uint32_t value = source_ptr[position]
+                               | (source_ptr[position + 1u] << 8u)
+                               | (source_ptr[position + 2u] << 16u);
+
+        return (value * 2654435761u) >> (32u - match_hash_bits);
+    };
+
+    // Table keeps positions increased by one, so zero means no match candidate
+    std::fill_n(match_table_ptr, match_table_size, 0u);
+
+    uint32_t position = 0u;
+
+    while (position < source_size) {
+        uint32_t match_length = 0u;
+        uint32_t distance     = 0u;
+
+        if (!is_literals_only && position + min_match_length <= source_size) {
+            auto &entry = match_table_ptr[hash(position)];
+
+            if (0u != entry && position + 1u - entry <= max_match_distance) {
+                const uint32_t candidate  = entry - 1u;
+                const uint32_t max_length = std::min(max_match_length, source_size - position);
+
+                distance = position - candidate;
+
+                while (match_length < max_length
+                       && source_ptr[candidate + match_length] == source_ptr[position + match_length]) {
+                    match_length++;
+                }
+            }
+
+            entry = position + 1u;
+        }
+
+        if (match_length >= min_match_length) {
+            if (!on_match(position, match_length, distance)) {
+                return false;
+            }
+
+            for (uint32_t i = position + 1u; i < position + match_length && i + min_match_length <= source_size; i++) {
+                match_table_ptr[hash(i)] = i + 1u;
+            }
+
+            position += match_length;
+        } else {
+            if (!on_literal(source_ptr[position])) {
+                return false;
+            }
+
+            position++;
+        }
+    }
+
+    return true;
+}
+
+void execute_compress(const hw_iaa_analytics_descriptor &descriptor,
+                      engine_buffers_t &buffers,
+                      hw_iaa_completion_record &record) noexcept {
+    // Compress descriptor keeps the flags in place of decompression flags and AECS in place of source-2
+    constexpr uint16_t unsupported_flags = ADCF_COMP_BE | ADCF_ENABLE_IDXING(7u) | ADCF_ENABLE_HDR_GEN(7u);
+
+    const uint16_t flags            = descriptor.decomp_flags;
+    const uint32_t read_policy      = (descriptor.op_code_op_flags >> 16u) & 3u;
+    const uint32_t write_policy     = (descriptor.op_code_op_flags >> 18u) & 3u;
+    const uint32_t aecs_index       = (descriptor.op_code_op_flags & ADOF_AECS_SEL) ? 1u : 0u;
+    const uint32_t end_processing   = (flags >> 2u) & 3u;
+    const bool     is_crc32c        = descriptor.op_code_op_flags & ADOF_CRC32C;
+    const bool     is_literals_only = flags & ADCF_GEN_LITS;
+
+    if ((flags & unsupported_flags) || (descriptor.filter_flags & ADCF_WRITE_AECS_HT)) {
+        record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+
+        return;
+    }
+
+    if ((AD_RDSRC2_UNUSED != read_policy || AD_WRSRC2_NEVER != write_policy)
+        && descriptor.src2_size < sizeof(hw_iaa_aecs_compress)) {
+        set_status(record, status_list::hardware_error_base + AD_ERROR_CODE_AECS_ERROR);
+
+        return;
+    }
+
+    hw_iaa_aecs_compress aecs{};
+
+    if (AD_RDSRC2_AECS == read_policy) {
+        std::memcpy(&aecs, descriptor.src2_ptr + descriptor.src2_size * aecs_index, sizeof(aecs));
+    }
+
+    const uint8_t *source_ptr  = descriptor.src1_ptr;
+    const uint32_t source_size = descriptor.src1_size;
+
+    uint32_t crc          = aecs.crc;
+    uint32_t xor_checksum = aecs.xor_checksum;
+
+    update_checksums(source_ptr, source_ptr + source_size, is_crc32c, crc, xor_checksum);
+
+    if (flags & ADCF_STATS_MODE) {
+        if (descriptor.max_dst_size < sizeof(hw_iaa_histogram)) {
+            set_status(record, status_list::hardware_error_base + AD_ERROR_CODE_UNRECOVERABLE_OUTPUT_OVERFLOW);
+
+            return;
+        }
+
+        hw_iaa_histogram histogram{};
+
+        static_cast<void>(tokenize(source_ptr, source_size, is_literals_only, buffers.match_table.get(),
+                                   [&histogram](uint32_t literal) noexcept {
+                                       histogram.ll_sym[literal]++;
+
+                                       return true;
+                                   },
+                                   [&histogram](uint32_t, uint32_t length, uint32_t distance) noexcept {
+                                       histogram.ll_sym[first_length_symbol
+                                                        + get_symbol_index(length_bases, length)]++;
+                                       histogram.d_sym[get_symbol_index(distance_bases, distance)]++;
+
+                                       return true;
+                                   }));
+
+        if (AD_APPEND_NOTHING != end_processing) {
+            histogram.ll_sym[eob_symbol]++;
+        }
+
+        std::memcpy(descriptor.dst_ptr, &histogram, sizeof(histogram));
+    } else {
+        const uint32_t accumulator_bits = aecs.num_output_accum_bits;
+
+        if (accumulator_bits > sizeof(aecs.output_accum) * byte_bits_size) {
+            set_status(record, status_list::hardware_error_base + AD_ERROR_CODE_AECS_ERROR);
+
+            return;
+        }
+
+        bit_writer_t writer(descriptor.dst_ptr, descriptor.dst_ptr + descriptor.max_dst_size);
+        uint32_t     status = status_list::ok;
+
+        const auto write_code = [&writer, &status](uint32_t code, uint32_t extra_bits, uint32_t extra_bits_count) {
+            const uint32_t length = (code >> code_length_shift) & 0xFu;
+
+            if (0u == length) {
+                status = status_list::hardware_error_base + AD_ERROR_CODE_INVALID_HUFFCODE;
+            } else if (!writer.write(reverse_code(code & code_mask, length) | (extra_bits << length),
+                                     length + extra_bits_count)) {
+                status = status_list::hardware_error_base + AD_ERROR_CODE_UNRECOVERABLE_OUTPUT_OVERFLOW;
+            }
+
+            return status_list::ok == status;
+        };
+
+        const auto write_literal = [&aecs, &write_code](uint32_t literal) {
+            return write_code(aecs.histogram.ll_sym[literal], 0u, 0u);
+        };
+
+        // Matches are written as literals if the table has no codes for them
+        const auto write_match = [&](uint32_t position, uint32_t length, uint32_t distance) {
+            const uint32_t length_index   = get_symbol_index(length_bases, length);
+            const uint32_t distance_index = get_symbol_index(distance_bases, distance);
+            const uint32_t length_code    = aecs.histogram.ll_sym[first_length_symbol + length_index];
+            const uint32_t distance_code  = aecs.histogram.d_sym[distance_index];
+
+            if (0u == (length_code >> code_length_shift) || 0u == (distance_code >> code_length_shift)) {
+                for (uint32_t i = position; i < position + length; i++) {
+                    if (!write_literal(source_ptr[i])) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            return write_code(length_code, length - length_bases[length_index], length_extra_bits[length_index])
+                   && write_code(distance_code, distance - distance_bases[distance_index],
+                                 distance_extra_bits[distance_index]);
+        };
+
+        bool is_ok = true;
+
+        for (uint32_t i = 0u; is_ok && i < accumulator_bits; i += byte_bits_size) {
+            const uint32_t bits_count = std::min(byte_bits_size, accumulator_bits - i);
+
+            is_ok = writer.write(aecs.output_accum[i / byte_bits_size] & ((1u << bits_count) - 1u), bits_count);
+        }
+
+        if (!is_ok) {
+            status = status_list::hardware_error_base + AD_ERROR_CODE_UNRECOVERABLE_OUTPUT_OVERFLOW;
+        }
+
+        if (status_list::ok == status) {
+            is_ok = tokenize(source_ptr, source_size, is_literals_only, buffers.match_table.get(),
+                             write_literal, write_match);
+        }
+
+        if (is_ok && AD_APPEND_NOTHING != end_processing) {
+            is_ok = write_code(aecs.histogram.ll_sym[eob_symbol], 0u, 0u);
+        }
+
+        // Empty stored block: the block header, then LEN = 0 and NLEN = 0xFFFF on the byte boundary
+        if (is_ok && (AD_APPEND_EOB_SB == end_processing || AD_APPEND_EOB_FINAL_SB == end_processing)) {
+            is_ok = writer.write(AD_APPEND_EOB_FINAL_SB == end_processing ? 1u : 0u, 3u)
+                    && writer.align()
+                    && writer.write(0xFFFF0000u, 32u);
+        }
+
+        const uint32_t last_bits = writer.pending_bits();
+        const bool     is_flush  = flags & ADCF_FLUSH_OUTPUT;
+
+        if (is_ok && is_flush && !writer.align()) {
+            is_ok = false;
+        }
+
+        if (!is_ok) {
+            set_status(record, status_list::ok == status
+                               ? status_list::hardware_error_base + AD_ERROR_CODE_UNRECOVERABLE_OUTPUT_OVERFLOW
+                               : status);
+
+            return;
+        }
+
+        record.output_size = writer.bytes_written();
+        record.output_bits = static_cast<uint8_t>(last_bits);
+
+        // Bits that don't form a whole byte are kept in the output accumulator for the next descriptor
+        if (AD_WRSRC2_ALWAYS == write_policy) {
+            aecs.crc                   = crc;
+            aecs.xor_checksum          = xor_checksum;
+            aecs.num_output_accum_bits = is_flush ? 0u : last_bits;
+
+            std::memset(aecs.output_accum, 0, sizeof(aecs.output_accum));
+            aecs.output_accum[0] = is_flush ? 0u : writer.pending_byte();
+
+            std::memcpy(descriptor.src2_ptr + descriptor.src2_size * (aecs_index ^ 1u), &aecs, sizeof(aecs));
+        }
+    }
+
+    record.status          = AD_STATUS_SUCCESS;
+    record.bytes_completed = source_size;
+    record.crc             = crc;
+    record.xor_checksum    = static_cast<uint16_t>(xor_checksum);
+}
+
+} // anonymous namespace
+
+void hw_emulated_execute_descriptor(const hw_descriptor &descriptor,
+                                    hw_iaa_completion_record &completion_record) noexcept {
+    hw_iaa_analytics_descriptor analytics_descriptor{};
+
+    std::memcpy(&analytics_descriptor, &descriptor, sizeof(analytics_descriptor));
+    std::memset(&completion_record, 0, sizeof(completion_record));
+
+    auto *buffers_ptr = get_engine_buffers();
+
+    if (!buffers_ptr) {
+        set_status(completion_record, status_list::internal_error);
+
+        return;
+    }
+
+    switch (ADOF_GET_OPCODE(analytics_descriptor.op_code_op_flags)) {
+        case QPL_OPCODE_CRC64: {
+            execute_crc64(analytics_descriptor, completion_record);
+            break;
+        }
+        case QPL_OPCODE_DECOMPRESS: {
+            execute_decompress(analytics_descriptor, *buffers_ptr, completion_record);
+            break;
+        }
+        case QPL_OPCODE_COMPRESS: {
+            execute_compress(analytics_descriptor, *buffers_ptr, completion_record);
+            break;
+        }
+        case QPL_OPCODE_Z_COMP16:
+        case QPL_OPCODE_Z_COMP32:
+        case QPL_OPCODE_Z_DECOMP16:
+        case QPL_OPCODE_Z_DECOMP32: {
+            execute_zero_operation(analytics_descriptor, completion_record);
+            break;
+        }
+        case QPL_OPCODE_SCAN:
+        case QPL_OPCODE_EXTRACT:
+        case QPL_OPCODE_SELECT:
+        case QPL_OPCODE_EXPAND: {
+            execute_filter(analytics_descriptor, *buffers_ptr, completion_record);
+            break;
+        }
+        default: {
+            completion_record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+        }
+    }
+}
+
+void hw_emulated_write_completion_record(const hw_descriptor &descriptor,
+                                         const hw_iaa_completion_record &completion_record) noexcept {
+    hw_iaa_analytics_descriptor analytics_descriptor{};
+
+    std::memcpy(&analytics_descriptor, &descriptor, sizeof(analytics_descriptor));
+
+    auto *record_ptr = analytics_descriptor.completion_record_ptr;
+    auto *source_ptr = reinterpret_cast<const uint8_t *>(&completion_record);
+
+    // The library polls the status byte with an acquire load, so it is released after the rest of the record
+    std::memcpy(record_ptr + 1u, source_ptr + 1u, sizeof(completion_record) - 1u);
+    __atomic_store_n(record_ptr, completion_record.status, __ATOMIC_RELEASE);
+}
+
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_ENGINE_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_ENGINE_HPP_
+
+#include "hw_definitions.h"
+#include "hw_completion_record_api.h"
+
+namespace qpl::ml::dispatcher {
+
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+
+/**
+ * @brief Executes the descriptor with the software kernels the way the accelerator engine does
+ *
+ * @details Supported are CRC64, Zero Compress/Decompress, Scan, Extract, Select, Expand on uncompressed source-1,
+ *          Decompress and Compress with the stream continued through AECS, and Batch of these descriptors.
+ *          Inflate state of the continued stream is kept by the engine, AECS only references it.
+ *          Big-endian Huffman codes, indexing, Huffman tables loaded into the Decompress AECS and
+ *          header generation by Compress are completed with @ref AD_STATUS_UNSUPPORTED_OPCODE status
+ *
+ * @param[in]  descriptor         descriptor copied from the work queue
+ * @param[out] completion_record  filled completion record including the status
+ */
+void hw_emulated_execute_descriptor(const hw_descriptor &descriptor,
+                                    hw_iaa_completion_record &completion_record) noexcept;
+
+/**
+ * @brief Writes the completion record to the address set in the descriptor, the status byte is written last
+ */
+void hw_emulated_write_completion_record(const hw_descriptor &descriptor,
+                                         const hw_iaa_completion_record &completion_record) noexcept;
+
+#endif
+
+}
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_ENGINE_HPP_
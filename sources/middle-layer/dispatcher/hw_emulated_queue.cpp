@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "hw_emulated_queue.hpp"
+#include "hw_emulated_engine.hpp"
+
+namespace qpl::ml::dispatcher {
+
+namespace {
+
+constexpr uint64_t default_engines_count = 8u;
+constexpr uint64_t default_queue_depth   = 128u;
+constexpr uint64_t default_latency_ns    = 0u;
+
+/**
+ * @brief Reads the unsigned setting from the environment, the default value is used if it isn't set or invalid
+ */
+auto read_setting(const char *name_ptr, uint64_t default_value, uint64_t min_value) noexcept -> uint64_t {
+    const char *value_ptr = std::getenv(name_ptr);
+
+    if (nullptr == value_ptr || '\0' == *value_ptr) {
+        return default_value;
+    }
+
+    char     *end_ptr = nullptr;
+    uint64_t value    = std::strtoull(value_ptr, &end_ptr, 10);
+
+    if ('\0' != *end_ptr) {
+        return default_value;
+    }
+
+    return (value < min_value) ? min_value : value;
+}
+
+} // anonymous namespace
+
+hw_emulated_queue::hw_emulated_queue(uint32_t engines_count,
+                                     uint32_t queue_depth,
+                                     std::chrono::nanoseconds latency) noexcept
+        : queue_depth_(queue_depth),
+          latency_(latency),
+          engines_(engines_count) {
+}
+
+auto hw_emulated_queue::get_instance() noexcept -> hw_emulated_queue & {
+    static hw_emulated_queue instance(
+            static_cast<uint32_t>(read_setting("QPL_HW_EMULATION_ENGINES", default_engines_count, 1u)),
+            static_cast<uint32_t>(read_setting("QPL_HW_EMULATION_QUEUE_DEPTH", default_queue_depth, 1u)),
+            std::chrono::nanoseconds(read_setting("QPL_HW_EMULATION_LATENCY_NS", default_latency_ns, 0u)));
+
+    return instance;
+}
+
+auto hw_emulated_queue::enqueue_descriptor(const void *desc_ptr) noexcept -> bool {
+    // Descriptor is rejected as by the full shared work queue
+    if (queued_count_.fetch_add(1u) >= queue_depth_) {
+        queued_count_.fetch_sub(1u);
+
+        return true;
+    }
+
+    hw_descriptor descriptor{};
+
+    std::memcpy(&descriptor, desc_ptr, sizeof(descriptor));
+
+    const auto completion_time = std::chrono::steady_clock::now() + latency_;
+
+    const bool is_submitted = engines_.submit([this, descriptor, completion_time]() {
+        queued_count_.fetch_sub(1u);
+
+        hw_iaa_completion_record completion_record{};
+
+        hw_emulated_execute_descriptor(descriptor, completion_record);
+
+        std::this_thread::sleep_until(completion_time);
+
+        hw_emulated_write_completion_record(descriptor, completion_record);
+    });
+
+    if (!is_submitted) {
+        queued_count_.fetch_sub(1u);
+    }
+
+    return !is_submitted;
+}
+
+auto hw_emulated_queue::engines_count() const noexcept -> uint32_t {
+    return engines_.size();
+}
+
+auto hw_emulated_queue::queue_depth() const noexcept -> uint32_t {
+    return queue_depth_;
+}
+
+auto hw_emulated_queue::latency() const noexcept -> std::chrono::nanoseconds {
+    return latency_;
+}
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_QUEUE_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_QUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "util/thread_pool.hpp"
+
+namespace qpl::ml::dispatcher {
+
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+
+/**
+ * @brief Software emulated work queue, descriptors are executed by the engine threads with the software kernels
+ *
+ * @details The queue is configured with the following environment variables:
+ *          - QPL_HW_EMULATION_ENGINES     - number of engine threads (8 by default)
+ *          - QPL_HW_EMULATION_QUEUE_DEPTH - number of descriptors accepted before the queue reports busy (128 by default)
+ *          - QPL_HW_EMULATION_LATENCY_NS  - minimal time from submission till completion (0 by default)
+ */
+class hw_emulated_queue final {
+public:
+    static auto get_instance() noexcept -> hw_emulated_queue &;
+
+    /**
+     * @brief Creates the queue that isn't configured by the environment, the device uses @ref get_instance
+     */
+    hw_emulated_queue(uint32_t engines_count, uint32_t queue_depth, std::chrono::nanoseconds latency) noexcept;
+
+    hw_emulated_queue(const hw_emulated_queue &) = delete;
+
+    auto operator=(const hw_emulated_queue &) -> hw_emulated_queue & = delete;
+
+    /**
+     * @brief Copies the descriptor into the queue as the enqueue instruction does
+     *
+     * @return true if the queue is full and the submission should be retried, false otherwise
+     */
+    [[nodiscard]] auto enqueue_descriptor(const void *desc_ptr) noexcept -> bool;
+
+    [[nodiscard]] auto engines_count() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto queue_depth() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto latency() const noexcept -> std::chrono::nanoseconds;
+
+private:
+    const uint32_t                 queue_depth_;        /**< Maximal number of descriptors in the queue */
+    const std::chrono::nanoseconds latency_;            /**< Minimal time of the descriptor execution */
+    std::atomic<uint32_t>          queued_count_{0u};   /**< Number of descriptors waiting for an engine */
+    util::thread_pool              engines_;            /**< Engine threads */
+};
+
+#endif
+
+}
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_QUEUE_HPP_
@@ -7,10 +7,15 @@
 #if defined( __linux__ )
 
 #include <fcntl.h>
+#include <inttypes.h>
 #include <sys/mman.h>
 
 #include "hw_queue.hpp"
 
+#if defined( QPL_HW_EMULATION )
+#include "hw_emulated_queue.hpp"
+#endif
+
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
 #include "hw_configuration_driver.h"
 #else //DYNAMIC_LOADING_LIBACCEL_CONFIG=OFF
@@ -28,6 +33,7 @@ namespace qpl::ml::dispatcher {
 
 hw_queue::hw_queue(hw_queue &&other) noexcept {
     priority_      = other.priority_;
+    size_          = other.size_;
     portal_mask_   = other.portal_mask_;
     portal_ptr_    = other.portal_ptr_;
     portal_offset_ = 0;
@@ -38,6 +44,7 @@ hw_queue::hw_queue(hw_queue &&other) noexcept {
 auto hw_queue::operator=(hw_queue &&other) noexcept -> hw_queue & {
     if (this != &other) {
         priority_      = other.priority_;
+        size_          = other.size_;
         portal_mask_   = other.portal_mask_;
         portal_ptr_    = other.portal_ptr_;
         portal_offset_ = 0;
@@ -69,6 +76,9 @@ auto hw_queue::get_portal_ptr() const noexcept -> void * {
 }
 
 auto hw_queue::enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status {
+#if defined( QPL_HW_EMULATION )
+    return static_cast<qpl_status>(hw_emulated_queue::get_instance().enqueue_descriptor(desc_ptr));
+#else
     uint8_t retry = 0u;
 
     void *current_place_ptr = get_portal_ptr();
@@ -78,6 +88,7 @@ auto hw_queue::enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status {
     : "=r"(retry) : "a" (current_place_ptr), "d" (desc_ptr));
 
     return static_cast<qpl_status>(retry);
+#endif
 }
 
 auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_accelerator_status {
@@ -121,6 +132,7 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_acce
 
     priority_       = accfg_wq_get_priority(work_queue_ptr);
     block_on_fault_ = accfg_wq_get_block_on_fault(work_queue_ptr);
+    size_           = static_cast<uint32_t>(accfg_wq_get_size(work_queue_ptr));
 
 #if 0
     DIAG("     %7s: size:        %d\n", work_queue_dev_name, accfg_wq_get_size(work_queue_ptr));
@@ -135,6 +147,7 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_acce
             DIAG("            %s\n", accfg_engine_get_devname(engine));
     }
 #else
+    DIAG("     %7s: size:        %" PRIu32 "\n", work_queue_dev_name, size_);
     DIAG("     %7s: priority:    %d\n", work_queue_dev_name, priority_);
     DIAG("     %7s: bof:         %d\n", work_queue_dev_name, block_on_fault_);
 #endif
@@ -152,5 +165,27 @@ auto hw_queue::get_block_on_fault() const noexcept -> bool {
     return block_on_fault_;
 }
 
+auto hw_queue::size() const noexcept -> uint32_t {
+    return size_;
+}
+
+auto hw_queue::occupancy() const noexcept -> hw_occupancy & {
+    return occupancy_;
+}
+
+auto hw_queue::load() const noexcept -> hw_load_t {
+    // Size and priority may be not reported by the driver
+    return {occupancy_.in_flight(),
+            (size_ > 0u) ? size_ : 1u,
+            (priority_ > 0) ? static_cast<uint32_t>(priority_) : 1u};
+}
+
+#if defined( QPL_HW_EMULATION )
+void hw_queue::initialize_emulated_queue(uint32_t size) noexcept {
+    priority_ = 1;
+    size_     = size;
+}
+#endif
+
 }
 #endif //__linux__
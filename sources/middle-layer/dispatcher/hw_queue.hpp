@@ -11,6 +11,7 @@
 
 #include "qpl/c_api/status.h"
 #include "hw_status.h"
+#include "hw_scheduler.hpp"
 
 namespace qpl::ml::dispatcher {
 
@@ -30,6 +31,10 @@ public:
 
     auto initialize_new_queue(descriptor_t *wq_descriptor_ptr) noexcept -> hw_accelerator_status;
 
+#if defined( QPL_HW_EMULATION )
+    void initialize_emulated_queue(uint32_t size) noexcept;
+#endif
+
     [[nodiscard]] auto get_portal_ptr() const noexcept -> void *;
 
     [[nodiscard]] auto enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status;
@@ -38,6 +43,12 @@ public:
 
     [[nodiscard]] auto get_block_on_fault() const noexcept -> bool;
 
+    [[nodiscard]] auto size() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto occupancy() const noexcept -> hw_occupancy &;
+
+    [[nodiscard]] auto load() const noexcept -> hw_load_t;
+
     void set_portal_ptr(void *portal_ptr) noexcept;
 
     virtual ~hw_queue() noexcept;
@@ -45,6 +56,8 @@ public:
 private:
     bool                          block_on_fault_ = false;
     int32_t                       priority_       = 0u;
+    uint32_t                      size_           = 0u;      /**< Number of descriptors the queue holds */
+    mutable hw_occupancy          occupancy_;                /**< Descriptors in flight */
     uint64_t                      portal_mask_    = 0u;      /**< Mask for incrementing portals */
     mutable void                  *portal_ptr_    = nullptr;
     mutable std::atomic<uint64_t> portal_offset_  = 0u;      /**< Portal for enqcmd (mod page size)*/
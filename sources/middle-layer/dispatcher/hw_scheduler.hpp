@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SCHEDULER_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SCHEDULER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Occupancy counters of the work queue
+ *
+ * @details The descriptor is in flight from the submission till the library observes its completion
+ */
+class hw_occupancy final {
+public:
+    hw_occupancy() noexcept = default;
+
+    hw_occupancy(const hw_occupancy &) = delete;
+
+    auto operator=(const hw_occupancy &) -> hw_occupancy & = delete;
+
+    /**
+     * @brief Counts the descriptor that is going to be submitted
+     */
+    inline void acquire() noexcept {
+        in_flight_.fetch_add(1u, std::memory_order_relaxed);
+        submitted_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Reverts @ref acquire if the queue didn't accept the descriptor
+     */
+    inline void cancel() noexcept {
+        in_flight_.fetch_sub(1u, std::memory_order_relaxed);
+        submitted_.fetch_sub(1u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts the completed descriptor
+     */
+    inline void release() noexcept {
+        in_flight_.fetch_sub(1u, std::memory_order_relaxed);
+        completed_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline auto in_flight() const noexcept -> uint32_t {
+        return in_flight_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline auto submitted() const noexcept -> uint64_t {
+        return submitted_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline auto completed() const noexcept -> uint64_t {
+        return completed_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> in_flight_{0u};   /**< Descriptors submitted and not completed yet */
+    std::atomic<uint64_t> submitted_{0u};   /**< Descriptors accepted by the queue */
+    std::atomic<uint64_t> completed_{0u};   /**< Descriptors which completion is observed */
+};
+
+/**
+ * @brief Load of the work queue or the device
+ */
+struct hw_load_t {
+    uint32_t in_flight = 0u;    /**< Descriptors in flight */
+    uint32_t capacity  = 1u;    /**< Size of the work queue or total size of the device work queues */
+    uint32_t weight    = 1u;    /**< Priority of the work queue */
+};
+
+/**
+ * @brief Remote NUMA node devices are used only while they are less than 1/limit occupied
+ */
+constexpr uint32_t spill_over_occupancy_limit = 2u;
+
+/**
+ * @brief Compares (in_flight + 1) / (capacity * weight) of the loads,
+ *        i.e. the descriptor is expected to complete earlier in a larger or higher priority queue with the same backlog
+ */
+constexpr inline auto is_less_loaded(const hw_load_t &a, const hw_load_t &b) noexcept -> bool {
+    const uint64_t a_cost = static_cast<uint64_t>(a.in_flight + 1u) * b.capacity * b.weight;
+    const uint64_t b_cost = static_cast<uint64_t>(b.in_flight + 1u) * a.capacity * a.weight;
+
+    return a_cost < b_cost;
+}
+
+constexpr inline auto is_spill_over_allowed(const hw_load_t &load) noexcept -> bool {
+    return static_cast<uint64_t>(load.in_flight) * spill_over_occupancy_limit < load.capacity;
+}
+
+/**
+ * @brief Writes indices of the candidates ordered from the least loaded one
+ *
+ * @details Candidates with the same load are ordered round-robin starting from the `rotation` index,
+ *          so idle queues and devices are used evenly
+ *
+ * @param[in]  count        number of candidates
+ * @param[in]  get_load     callable returning @ref hw_load_t of the candidate by its index
+ * @param[in]  rotation     index of the first candidate among the equally loaded ones
+ * @param[out] indices_ptr  array of `count` indices
+ */
+template <class load_getter_t>
+inline void order_by_load(uint32_t count,
+                          load_getter_t &&get_load,
+                          uint32_t rotation,
+                          uint32_t *indices_ptr) noexcept {
+    // Insertion sort is stable and the number of candidates is small
+    for (uint32_t i = 0u; i < count; i++) {
+        const uint32_t  index = (rotation + i) % count;
+        const hw_load_t load  = get_load(index);
+
+        uint32_t position = i;
+
+        while (position > 0u && is_less_loaded(load, get_load(indices_ptr[position - 1u]))) {
+            indices_ptr[position] = indices_ptr[position - 1u];
+            position--;
+        }
+
+        indices_ptr[position] = index;
+    }
+}
+
+/**
+ * @brief Maps completion records of the in-flight descriptors to the occupancy counters of their work queues
+ *
+ * @details The completion record identifies the descriptor, as it is the only address that both
+ *          the submission and the completion check know. If the table is full, the descriptor isn't counted
+ */
+class hw_inflight_tracker final {
+    static constexpr uint32_t slots_count = 4096u;
+    static constexpr uint32_t max_probes  = 16u;
+
+public:
+    hw_inflight_tracker() noexcept = default;
+
+    hw_inflight_tracker(const hw_inflight_tracker &) = delete;
+
+    auto operator=(const hw_inflight_tracker &) -> hw_inflight_tracker & = delete;
+
+    static inline auto get_instance() noexcept -> hw_inflight_tracker & {
+        static hw_inflight_tracker instance{};
+
+        return instance;
+    }
+
+    /**
+     * @brief Starts tracking of the descriptor and acquires the occupancy
+     *
+     * @return false if the descriptor isn't tracked
+     */
+    inline auto track(const void *completion_record_ptr, hw_occupancy *occupancy_ptr) noexcept -> bool {
+        // The record can't be in flight twice, so the previous descriptor was completed without a check
+        release(completion_record_ptr);
+
+        for (uint32_t probe = 0u; probe < max_probes; probe++) {
+            auto &slot = slots_[get_slot_index(completion_record_ptr, probe)];
+
+            const void *expected_ptr = nullptr;
+
+            if (slot.key.compare_exchange_strong(expected_ptr, completion_record_ptr, std::memory_order_acq_rel)) {
+                occupancy_ptr->acquire();
+                slot.occupancy.store(occupancy_ptr, std::memory_order_release);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Stops tracking of the completed descriptor and releases the occupancy
+     */
+    inline void release(const void *completion_record_ptr) noexcept {
+        if (auto *occupancy_ptr = untrack(completion_record_ptr)) {
+            occupancy_ptr->release();
+        }
+    }
+
+    /**
+     * @brief Stops tracking of the descriptor that wasn't accepted by the queue
+     */
+    inline void cancel(const void *completion_record_ptr) noexcept {
+        if (auto *occupancy_ptr = untrack(completion_record_ptr)) {
+            occupancy_ptr->cancel();
+        }
+    }
+
+private:
+    struct slot_t {
+        std::atomic<const void *>   key{nullptr};
+        std::atomic<hw_occupancy *> occupancy{nullptr};
+    };
+
+    static inline auto get_slot_index(const void *completion_record_ptr, uint32_t probe) noexcept -> uint32_t {
+        // Completion records are 32-byte aligned, so the low bits don't matter
+        const auto address = reinterpret_cast<uintptr_t>(completion_record_ptr) >> 5u;
+
+        return static_cast<uint32_t>((address * 0x9E3779B1u + probe) % slots_count);
+    }
+
+    inline auto untrack(const void *completion_record_ptr) noexcept -> hw_occupancy * {
+        for (uint32_t probe = 0u; probe < max_probes; probe++) {
+            auto &slot = slots_[get_slot_index(completion_record_ptr, probe)];
+
+            if (slot.key.load(std::memory_order_acquire) != completion_record_ptr) {
+                continue;
+            }
+
+            auto *occupancy_ptr = slot.occupancy.exchange(nullptr, std::memory_order_acq_rel);
+
+            const void *expected_ptr = completion_record_ptr;
+
+            if (slot.key.compare_exchange_strong(expected_ptr, nullptr, std::memory_order_acq_rel)) {
+                return occupancy_ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::array<slot_t, slots_count> slots_{};
+};
+
+}
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SCHEDULER_HPP_
@@ -48,41 +48,6 @@ static uint64_t bit_byte_swap_64(uint64_t x) {
     return y;
 }
 
-/**
- * @brief table initializer
- */
-static void crc64_init_table(uint64_t *table, uint64_t poly, bool is_big_endian) {
-    uint64_t crc = 0;
-    table[0] = 0;
-
-    if (is_big_endian) {
-        poly = bit_byte_swap_64(poly);
-        for (uint64_t i = 1; i < 256; i++) {
-            crc = i;
-            for (uint32_t j = 0; j < 8; j++) {
-                if (crc & 0x0000000000000001ULL) {
-                    crc = (crc >> 1) ^ poly;
-                } else {
-                    crc = (crc >> 1);
-                }
-            }
-            table[i] = crc;
-        }
-    } else {
-        for (uint64_t i = 1; i < 256; i++) {
-            crc = i << 56;
-            for (uint32_t j = 0; j < 8; j++) {
-                if (crc & 0x8000000000000000ULL) {
-                    crc = (crc << 1) ^ poly;
-                } else {
-                    crc = (crc << 1);
-                }
-            }
-            table[i] = crc;
-        }
-    }
-}
-
 /**
  * @brief CRC initializer
  */
@@ -106,14 +71,43 @@ static uint64_t crc64_init_crc(uint64_t polynomial, bool is_big_endian, bool is_
 }
 
 /**
- * @brief CRC calculator
+ * @brief Cached constants of CRC calculation for a polynomial
+ */
+struct crc64_constants_cache_entry_t {
+    uint64_t               polynomial      = 0u;
+    bool                   is_be_bit_order = false;
+    bool                   is_valid        = false;
+    qplc_crc64_constants_t constants       = {};
+};
+
+constexpr uint32_t crc64_constants_cache_size = 4u;
+
+/**
+ * @brief Returns CRC constants for the polynomial, they are calculated only once per thread for the last used polynomials
  */
-static uint64_t crc64_update(uint8_t data, const uint64_t *table, uint64_t crc, bool is_big_endian) {
-    if (is_big_endian) {
-        return table[data ^ (crc & 0xFF)] ^ (crc >> 8);
-    } else {
-        return table[data ^ (crc >> 56)] ^ (crc << 8);
+static auto get_crc64_constants(uint64_t polynomial, bool is_be_bit_order) noexcept -> const qplc_crc64_constants_t & {
+    static thread_local crc64_constants_cache_entry_t cache[crc64_constants_cache_size];
+    static thread_local uint32_t                      next_entry_index = 0u;
+
+    for (auto &entry : cache) {
+        if (entry.is_valid && entry.polynomial == polynomial && entry.is_be_bit_order == is_be_bit_order) {
+            return entry.constants;
+        }
     }
+
+    auto &entry = cache[next_entry_index];
+    next_entry_index = (next_entry_index + 1u) % crc64_constants_cache_size;
+
+    auto init_constants = (qplc_crc64_init_constants_t_ptr)
+            (core_sw::dispatcher::kernels_dispatcher::get_instance().get_crc64_table()[1]);
+
+    init_constants(polynomial, is_be_bit_order, &entry.constants);
+
+    entry.polynomial      = polynomial;
+    entry.is_be_bit_order = is_be_bit_order;
+    entry.is_valid        = true;
+
+    return entry.constants;
 }
 
 /**
@@ -141,14 +135,13 @@ auto perform_crc(const uint8_t *src_ptr,
                  uint64_t polynomial,
                  bool is_be_bit_order,
                  bool is_inverse) -> uint64_t {
-    uint64_t table[256];
+    auto crc64_fold = (qplc_crc64_fold_t_ptr)
+            (core_sw::dispatcher::kernels_dispatcher::get_instance().get_crc64_table()[2]);
 
-    crc64_init_table(table, polynomial, is_be_bit_order);
-    auto crc = crc64_init_crc(polynomial, is_be_bit_order, is_inverse);
+    const auto &constants = get_crc64_constants(polynomial, is_be_bit_order);
 
-    for (uint32_t i = 0; i < length; i++) {
-        crc = crc64_update(src_ptr[i], table, crc, is_be_bit_order);
-    }
+    auto crc = crc64_init_crc(polynomial, is_be_bit_order, is_inverse);
+    crc = crc64_fold(src_ptr, length, crc, &constants);
 
     return crc64_finalize(crc, polynomial, is_be_bit_order, is_inverse);
 }
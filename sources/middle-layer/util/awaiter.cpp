@@ -51,14 +51,14 @@ awaiter::awaiter(volatile void *address,
 
 awaiter::~awaiter() noexcept {
 #ifdef QPL_EFFICIENT_WAIT
-    while (initial_value_ == *address_ptr_) {
+    while (initial_value_ == load_acquire(address_ptr_)) {
         monitor_address(address_ptr_);
 
         auto start = current_time();
         wait_until(start + period_, idle_state_);
     }
 #else
-    while (initial_value_ == *address_ptr_) {
+    while (initial_value_ == load_acquire(address_ptr_)) {
         _mm_pause();
     }
 #endif
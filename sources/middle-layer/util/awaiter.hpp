@@ -15,8 +15,27 @@
 
 #include <cstdint>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace qpl::ml {
 
+/**
+ * @brief Loads the status byte of a completion record with acquire semantics, so the rest of the record
+ *        written by the accelerator or its emulator is read after the status
+ */
+inline auto load_acquire(const volatile uint8_t *address) noexcept -> uint8_t {
+#if defined(_MSC_VER)
+    const uint8_t value = *address; // Volatile loads have acquire semantics with /volatile:ms on x86
+    _ReadWriteBarrier();
+
+    return value;
+#else
+    return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+#endif
+}
+
 /**
  * @brief Class that allows to defer scope exit to the moment when a certain address is changed
  */
@@ -8,6 +8,8 @@
 #include "igzip_checksums.h"
 #include "compression/inflate/isal_kernels_wrappers.hpp"
 
+#include <array>
+
 namespace qpl::ml::util {
 
 /**
@@ -36,4 +38,90 @@ auto adler32(const uint8_t *const begin, uint32_t size, uint32_t seed) noexcept
     return (old_adler32 & most_significant_16_bits) | new_adler32;
 }
 
+/**
+ * @brief function to compute Adler-32 checksum of two concatenated streams from their checksums.
+ *
+ * Both checksums and the result use the same representation as @ref adler32,
+ * `second_size` is the number of bytes in the second stream.
+*/
+auto adler32_combine(uint32_t first_adler32, uint32_t second_adler32, uint32_t second_size) noexcept -> uint32_t {
+    const uint32_t first_a  = ((first_adler32 & least_significant_16_bits) + 1u) % adler32_mod;
+    const uint32_t second_a = ((second_adler32 & least_significant_16_bits) + 1u) % adler32_mod;
+    const uint32_t first_b  = first_adler32 >> 16u;
+    const uint32_t second_b = second_adler32 >> 16u;
+    const uint32_t remainder = second_size % adler32_mod;
+
+    uint32_t a = (first_a + second_a + adler32_mod - 1u) % adler32_mod;
+    uint32_t b = static_cast<uint32_t>((static_cast<uint64_t>(remainder) * first_a +
+                                        first_b + second_b + adler32_mod - remainder) % adler32_mod);
+
+    a = (a == 0u) ? adler32_mod - 1u : a - 1u;
+
+    return (b << 16u) | a;
+}
+
+namespace {
+
+constexpr uint32_t crc32_gzip_reflected_polynomial = 0xEDB88320u;
+
+/**
+ * @brief Multiplies two polynomials modulo the reflected CRC-32 (gzip) polynomial
+ */
+constexpr auto crc32_gzip_multiply_modulo(uint32_t a, uint32_t b) noexcept -> uint32_t {
+    uint32_t mask    = 1u << 31u;
+    uint32_t product = 0u;
+
+    while (mask) {
+        if (a & mask) {
+            product ^= b;
+        }
+
+        mask >>= 1u;
+        b = (b & 1u) ? (b >> 1u) ^ crc32_gzip_reflected_polynomial : b >> 1u;
+    }
+
+    return product;
+}
+
+/**
+ * @brief Table of x^(2^n) modulo the CRC-32 (gzip) polynomial, used to shift a CRC over appended zero bits
+ */
+constexpr auto build_x_power_table() noexcept -> std::array<uint32_t, 32u> {
+    std::array<uint32_t, 32u> table{};
+
+    uint32_t power = 1u << 30u; // x^1
+
+    table[0] = power;
+
+    for (uint32_t n = 1u; n < table.size(); n++) {
+        power    = crc32_gzip_multiply_modulo(power, power);
+        table[n] = power;
+    }
+
+    return table;
+}
+
+constexpr std::array<uint32_t, 32u> x_power_table = build_x_power_table();
+
+} // namespace
+
+/**
+ * @brief function to compute CRC-32 (gzip) of two concatenated streams from their checksums.
+ *
+ * The CRC of the first stream is shifted over `second_size` bytes by multiplication with x^(8 * second_size)
+ * modulo the polynomial, so the cost is logarithmic in the size of the second stream.
+*/
+auto crc32_gzip_combine(uint32_t first_crc, uint32_t second_crc, uint32_t second_size) noexcept -> uint32_t {
+    uint32_t shift = 1u << 31u; // x^0
+    uint32_t index = 3u;        // Start from x^(2^3), i.e. one byte
+
+    for (uint32_t size = second_size; size; size >>= 1u, index++) {
+        if (size & 1u) {
+            shift = crc32_gzip_multiply_modulo(x_power_table[index & 31u], shift);
+        }
+    }
+
+    return crc32_gzip_multiply_modulo(shift, first_crc) ^ second_crc;
+}
+
 } // namespace qpl::ml
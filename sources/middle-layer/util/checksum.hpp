@@ -39,6 +39,10 @@ enum class crc_type_t {
 
 auto adler32(const uint8_t *const begin, uint32_t size, uint32_t seed) noexcept -> uint32_t;
 
+auto adler32_combine(uint32_t first_adler32, uint32_t second_adler32, uint32_t second_size) noexcept -> uint32_t;
+
+auto crc32_gzip_combine(uint32_t first_crc, uint32_t second_crc, uint32_t second_size) noexcept -> uint32_t;
+
 template <class input_iterator_t>
 inline uint32_t crc32_gzip(const input_iterator_t source_begin,
                            const input_iterator_t source_end,
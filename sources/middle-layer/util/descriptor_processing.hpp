@@ -27,6 +27,8 @@ template <typename return_t>
 inline auto wait_descriptor_result(HW_PATH_VOLATILE hw_completion_record *const completion_record_ptr) -> return_t {
     awaiter::wait_for(&completion_record_ptr->status, AD_STATUS_INPROG);
 
+    hw_release_descriptor(const_cast<const hw_completion_record *>(completion_record_ptr));
+
     return ml::util::completion_record_convert_to_result<return_t>(completion_record_ptr);
 }
 
@@ -7,6 +7,8 @@
 #include "qpl/qpl.h"
 #include "../c_api/own_defs.h"
 
+#include "compression/inflate/parallel_inflate.hpp"
+
 qpl_status qpl_get_index_table_size(uint32_t mini_block_count,
                                     uint32_t mini_blocks_per_block,
                                     size_t *size_ptr) {
@@ -87,3 +89,33 @@ qpl_status qpl_find_mini_block_index(qpl_index_table *table_ptr,
 
     return QPL_STS_OK;
 }
+
+qpl_status qpl_decompress_mini_blocks_parallel(qpl_index_table *table_ptr,
+                                               qpl_mini_block_size mini_block_size,
+                                               uint8_t *source_ptr,
+                                               uint32_t source_size,
+                                               uint8_t *destination_ptr,
+                                               uint32_t destination_size,
+                                               uint32_t threads_count,
+                                               uint32_t *output_size_ptr) {
+    QPL_BAD_PTR2_RET(table_ptr, table_ptr->indices_ptr);
+    QPL_BAD_PTR2_RET(source_ptr, destination_ptr);
+    QPL_BAD_PTR_RET(output_size_ptr);
+    OWN_RETURN_ERROR(mini_block_size == qpl_mblk_size_none || mini_block_size > qpl_mblk_size_32k, QPL_STS_SIZE_ERR);
+    OWN_RETURN_ERROR(threads_count == 0u, QPL_STS_INVALID_PARAM_ERR);
+    if (table_ptr->mini_blocks_per_block == 0) {
+        QPL_ERROR_RET(QPL_STS_SIZE_ERR);
+    }
+
+    auto result = qpl::ml::compression::inflate_mini_blocks_parallel(source_ptr,
+                                                                     source_size,
+                                                                     destination_ptr,
+                                                                     destination_size,
+                                                                     *table_ptr,
+                                                                     1u << (mini_block_size + 8u),
+                                                                     threads_count);
+
+    *output_size_ptr = result.output_bytes_;
+
+    return static_cast<qpl_status>(result.status_code_);
+}
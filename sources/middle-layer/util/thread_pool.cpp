@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>
+#endif
+
+namespace qpl::ml::util {
+
+namespace {
+
+/**
+ * @brief State of a single @ref thread_pool::parallel_for call shared between the caller and the helpers,
+ *        lives on the stack of the caller, which waits for every helper that has started
+ */
+struct parallel_for_context {
+    std::atomic<uint32_t>   next_index{0u};
+    uint32_t                count             = 0u;
+    void                    (*iteration)(void *, uint32_t) = nullptr;
+    void                    *function_ptr     = nullptr;
+    uint32_t                finished_helpers  = 0u;
+    std::mutex              mutex;
+    std::condition_variable condition;
+};
+
+void run_parallel_for_iterations(parallel_for_context &context) noexcept {
+    for (uint32_t index = context.next_index++; index < context.count; index = context.next_index++) {
+        context.iteration(context.function_ptr, index);
+    }
+}
+
+} // namespace
+
+struct thread_pool::parallel_for_helper final : task_base {
+    explicit parallel_for_helper(parallel_for_context &context) noexcept : context_(context) {
+        owner_ptr = &context;
+    }
+
+    void run() noexcept override {
+        run_parallel_for_iterations(context_);
+
+        std::lock_guard<std::mutex> lock(context_.mutex);
+        context_.finished_helpers++;
+        context_.condition.notify_all();
+    }
+
+    parallel_for_context &context_;
+};
+
+thread_pool::thread_pool(uint32_t workers_count) noexcept {
+    if (0u == workers_count) {
+        return;
+    }
+
+    workers_.reset(new (std::nothrow) native_thread_t[workers_count]);
+
+    if (nullptr == workers_) {
+        return;
+    }
+
+    // Starting stops on the first failure, the pool works with the threads started so far
+    for (; workers_count_ < workers_count; workers_count_++) {
+#if defined(_WIN32)
+        const auto handle = _beginthreadex(nullptr, 0u, &thread_pool::worker_entry, this, 0u, nullptr);
+
+        if (0u == handle) {
+            break;
+        }
+
+        workers_[workers_count_] = reinterpret_cast<native_thread_t>(handle);
+#else
+        if (0 != pthread_create(&workers_[workers_count_], nullptr, &thread_pool::worker_entry, this)) {
+            break;
+        }
+#endif
+    }
+}
+
+thread_pool::~thread_pool() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+
+    condition_.notify_all();
+
+    for (uint32_t i = 0u; i < workers_count_; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(workers_[i], INFINITE);
+        CloseHandle(workers_[i]);
+#else
+        pthread_join(workers_[i], nullptr);
+#endif
+    }
+}
+
+auto thread_pool::get_instance() noexcept -> thread_pool & {
+    static thread_pool instance(std::thread::hardware_concurrency());
+
+    return instance;
+}
+
+auto thread_pool::size() const noexcept -> uint32_t {
+    return workers_count_;
+}
+
+void thread_pool::enqueue(task_base *task_ptr) noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (nullptr == tail_ptr_) {
+            head_ptr_ = task_ptr;
+        } else {
+            tail_ptr_->next_ptr = task_ptr;
+        }
+
+        tail_ptr_ = task_ptr;
+    }
+
+    condition_.notify_one();
+}
+
+auto thread_pool::retract(const void *owner_ptr) noexcept -> uint32_t {
+    uint32_t retracted_count = 0u;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    task_base *previous_ptr = nullptr;
+
+    for (task_base *task_ptr = head_ptr_; nullptr != task_ptr;) {
+        task_base *const next_ptr = task_ptr->next_ptr;
+
+        if (owner_ptr == task_ptr->owner_ptr) {
+            if (nullptr == previous_ptr) {
+                head_ptr_ = next_ptr;
+            } else {
+                previous_ptr->next_ptr = next_ptr;
+            }
+
+            if (tail_ptr_ == task_ptr) {
+                tail_ptr_ = previous_ptr;
+            }
+
+            delete task_ptr;
+            retracted_count++;
+        } else {
+            previous_ptr = task_ptr;
+        }
+
+        task_ptr = next_ptr;
+    }
+
+    return retracted_count;
+}
+
+void thread_pool::run_parallel_for(uint32_t count,
+                                   uint32_t max_threads,
+                                   iteration_t iteration,
+                                   void *function_ptr) noexcept {
+    if (0u == count) {
+        return;
+    }
+
+    parallel_for_context context;
+
+    context.count        = count;
+    context.iteration    = iteration;
+    context.function_ptr = function_ptr;
+
+    // The calling thread is one of the participants
+    uint32_t helpers_count = std::min(std::min(max_threads, count), size() + 1u);
+    helpers_count = (helpers_count > 0u) ? helpers_count - 1u : 0u;
+
+    uint32_t submitted_count = 0u;
+
+    for (; submitted_count < helpers_count; submitted_count++) {
+        auto *const helper_ptr = new (std::nothrow) parallel_for_helper(context);
+
+        if (nullptr == helper_ptr) {
+            break;
+        }
+
+        enqueue(helper_ptr);
+    }
+
+    run_parallel_for_iterations(context);
+
+    // Helpers that haven't started yet have nothing left to do, only the running ones are waited for
+    const uint32_t started_count = submitted_count - retract(&context);
+
+    std::unique_lock<std::mutex> lock(context.mutex);
+    context.condition.wait(lock, [&context, started_count]() { return context.finished_helpers == started_count; });
+}
+
+void thread_pool::worker_loop() noexcept {
+    while (true) {
+        task_base *task_ptr = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return is_stopped_ || nullptr != head_ptr_; });
+
+            if (is_stopped_ && nullptr == head_ptr_) {
+                return;
+            }
+
+            task_ptr  = head_ptr_;
+            head_ptr_ = task_ptr->next_ptr;
+
+            if (nullptr == head_ptr_) {
+                tail_ptr_ = nullptr;
+            }
+        }
+
+        task_ptr->run();
+
+        delete task_ptr;
+    }
+}
+
+#if defined(_WIN32)
+unsigned __stdcall thread_pool::worker_entry(void *pool_ptr) noexcept {
+    static_cast<thread_pool *>(pool_ptr)->worker_loop();
+
+    return 0u;
+}
+#else
+void *thread_pool::worker_entry(void *pool_ptr) noexcept {
+    static_cast<thread_pool *>(pool_ptr)->worker_loop();
+
+    return nullptr;
+}
+#endif
+
+} // namespace qpl::ml::util
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+namespace qpl::ml::util {
+
+/**
+ * @brief Pool of worker threads shared by the software path operations that split work between threads
+ *
+ * @note Workers are started on the first use and live until the library is unloaded.
+ *       The calling thread always participates in @ref thread_pool::parallel_for, so nested calls
+ *       and a pool without workers are both handled correctly.
+ *
+ * @note The library is built without exceptions, so the pool doesn't use the throwing allocations:
+ *       workers that can't be started are skipped and work that can't be queued is left to the caller.
+ */
+class thread_pool final {
+public:
+    /**
+     * @brief Returns the library-wide instance of the pool
+     */
+    static auto get_instance() noexcept -> thread_pool &;
+
+    /**
+     * @brief Starts the given number of workers, the pool is used in addition to the library-wide instance
+     *        by the components that need a separately sized set of threads
+     *
+     * @note @ref thread_pool::size can be less than `workers_count` if the system is out of resources
+     */
+    explicit thread_pool(uint32_t workers_count) noexcept;
+
+    thread_pool(const thread_pool &) = delete;
+
+    auto operator=(const thread_pool &) -> thread_pool & = delete;
+
+    ~thread_pool() noexcept;
+
+    /**
+     * @brief Returns number of worker threads owned by the pool
+     */
+    [[nodiscard]] auto size() const noexcept -> uint32_t;
+
+    /**
+     * @brief Queues the task for execution by one of the workers
+     *
+     * @return false if the pool has no workers or is out of memory, the task is not queued then
+     *         and the caller is expected to execute it
+     */
+    template <class task_t>
+    auto submit(task_t &&task) noexcept -> bool {
+        using node_t = task_node<std::decay_t<task_t>>;
+
+        if (0u == workers_count_) {
+            return false;
+        }
+
+        auto *const node_ptr = new (std::nothrow) node_t(std::forward<task_t>(task));
+
+        if (nullptr == node_ptr) {
+            return false;
+        }
+
+        enqueue(node_ptr);
+
+        return true;
+    }
+
+    /**
+     * @brief Calls `function(index)` for every index in [0, count) using at most `max_threads` threads
+     *        (including the calling one) and returns when all calls are completed
+     */
+    template <class function_t>
+    void parallel_for(uint32_t count, uint32_t max_threads, function_t &&function) noexcept {
+        using callable_t = std::remove_reference_t<function_t>;
+
+        run_parallel_for(count, max_threads, [](void *function_ptr, uint32_t index) {
+            (*static_cast<callable_t *>(function_ptr))(index);
+        }, const_cast<void *>(static_cast<const void *>(std::addressof(function))));
+    }
+
+private:
+#if defined(_WIN32)
+    using native_thread_t = void *;
+#else
+    using native_thread_t = pthread_t;
+#endif
+
+    using iteration_t = void (*)(void *function_ptr, uint32_t index);
+
+    /**
+     * @brief Queued task, `owner_ptr` identifies the @ref thread_pool::parallel_for call that queued it
+     */
+    struct task_base {
+        virtual ~task_base() noexcept = default;
+
+        virtual void run() noexcept = 0;
+
+        task_base  *next_ptr  = nullptr;
+        const void *owner_ptr = nullptr;
+    };
+
+    template <class task_t>
+    struct task_node final : task_base {
+        explicit task_node(task_t &&task) noexcept : task_(std::move(task)) {
+        }
+
+        explicit task_node(const task_t &task) noexcept : task_(task) {
+        }
+
+        void run() noexcept override {
+            task_();
+        }
+
+        task_t task_;
+    };
+
+    struct parallel_for_helper;
+
+    void enqueue(task_base *task_ptr) noexcept;
+
+    auto retract(const void *owner_ptr) noexcept -> uint32_t;
+
+    void run_parallel_for(uint32_t count, uint32_t max_threads, iteration_t iteration, void *function_ptr) noexcept;
+
+    void worker_loop() noexcept;
+
+#if defined(_WIN32)
+    static unsigned __stdcall worker_entry(void *pool_ptr) noexcept;
+#else
+    static void *worker_entry(void *pool_ptr) noexcept;
+#endif
+
+    std::unique_ptr<native_thread_t[]> workers_;
+    uint32_t                           workers_count_ = 0u;
+    task_base                          *head_ptr_     = nullptr;
+    task_base                          *tail_ptr_     = nullptr;
+    std::mutex                         mutex_;
+    std::condition_variable            condition_;
+    bool                               is_stopped_    = false;
+};
+
+} // namespace qpl::ml::util
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP_
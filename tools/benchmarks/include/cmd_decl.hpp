@@ -22,13 +22,17 @@ BM_DECLARE_int32(threads);
 BM_DECLARE_int32(node);
 BM_DECLARE_bool(full_time);
 BM_DECLARE_bool(no_hw);
+BM_DECLARE_string(sw_arch);
 BM_DECLARE_string(in_mem);
 BM_DECLARE_string(out_mem);
 
 BM_DECLARE_double(canned_part);
 BM_DECLARE_bool(canned_regen);
 
+BM_DECLARE_int32(elements);
+
 std::int32_t get_block_size();
 mem_loc_e    get_in_mem();
 mem_loc_e    get_out_mem();
+void         set_sw_arch();
 }
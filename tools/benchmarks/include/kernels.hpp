@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <utility.hpp>
+
+#include "dispatcher.hpp"
+
+#include <x86intrin.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+//
+// Kernel microbenchmarks measure core-sw kernels directly from the dispatcher tables,
+// so the numbers don't include middle-layer overhead
+//
+namespace bench::kernels
+{
+namespace disp = qpl::core_sw::dispatcher;
+
+struct input_size_t
+{
+    std::string   name;
+    std::uint32_t elements;
+};
+
+// Cache resident input fits into L2 together with the output, DRAM sized input exceeds LLC
+static inline const std::vector<input_size_t>& get_sizes()
+{
+    static const std::vector<input_size_t> sizes{{"cache", 16384u}, {"dram", 1u << 25u}};
+    return sizes;
+}
+
+// All tiers supported by the CPU
+static inline std::vector<disp::arch_t> get_tiers()
+{
+    std::vector<disp::arch_t> tiers;
+    for(std::int32_t arch = disp::px_arch; arch <= disp::detect_platform(); ++arch)
+        tiers.push_back(static_cast<disp::arch_t>(arch));
+
+    return tiers;
+}
+
+static inline std::string to_string(disp::arch_t arch)
+{
+    switch(arch)
+    {
+    case disp::px_arch:     return "px";
+    case disp::avx2_arch:   return "avx2";
+    case disp::avx512_arch: return "avx512";
+    default:                return "tier" + std::to_string(static_cast<std::int32_t>(arch));
+    }
+}
+
+// Tables are static, so kernels taken from the tier stay valid when the dispatcher is switched back
+template <typename GetterT>
+static inline auto get_kernel(disp::arch_t arch, GetterT &&getter)
+{
+    auto &dispatcher   = disp::kernels_dispatcher::get_instance();
+    auto  default_arch = dispatcher.get_arch();
+
+    dispatcher.set_arch(arch);
+    auto kernel = getter(dispatcher);
+    dispatcher.set_arch(default_arch);
+
+    return kernel;
+}
+
+// Size of the unpacked element for the bit width: 8u, 16u or 32u
+static inline std::uint32_t get_unpacked_bytes(std::uint32_t bit_width)
+{
+    return 1u << BITS_2_DATA_TYPE_INDEX(bit_width);
+}
+
+// Kernels may access up to a vector register past the end of the buffers
+constexpr std::size_t buffer_padding = 64u;
+
+static inline std::vector<std::uint8_t> random_bytes(std::size_t size, std::uint32_t seed = 0u)
+{
+    std::mt19937 engine(seed);
+
+    std::vector<std::uint8_t> buffer(size + buffer_padding);
+    for(auto &byte : buffer)
+        byte = static_cast<std::uint8_t>(engine());
+
+    return buffer;
+}
+
+// Unpacked elements with the values fitting into the bit width
+static inline std::vector<std::uint8_t> random_elements(std::uint32_t count, std::uint32_t bit_width, std::uint32_t seed = 0u)
+{
+    std::mt19937 engine(seed);
+
+    const std::uint32_t       mask          = (bit_width == 32u) ? UINT32_MAX : (1u << bit_width) - 1u;
+    const std::uint32_t       element_bytes = get_unpacked_bytes(bit_width);
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(count)*element_bytes + buffer_padding, 0u);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        std::uint32_t value = static_cast<std::uint32_t>(engine()) & mask;
+        for(std::uint32_t byte = 0; byte < element_bytes; ++byte)
+            buffer[i*element_bytes + byte] = static_cast<std::uint8_t>(value >> (byte*8u));
+    }
+
+    return buffer;
+}
+
+// Cycles are counted with TSC, so they are reference cycles at the nominal frequency
+template <typename CallT>
+static inline void measure(benchmark::State &state, std::uint64_t elements, std::uint64_t bytes, CallT &&call)
+{
+    std::uint64_t cycles = 0;
+    for(auto _ : state)
+    {
+        const std::uint64_t start = __rdtsc();
+        call();
+        cycles += __rdtsc() - start;
+
+        benchmark::ClobberMemory();
+    }
+
+    if(state.iterations() != 0)
+    {
+        state.counters["Cycles/Element"] = benchmark::Counter(static_cast<double>(cycles)/static_cast<double>(state.iterations()*elements));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()*elements));
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()*bytes));
+    }
+}
+
+// Registers the case for each input size, the case is called as fn(state, elements, args...)
+template <typename CaseT, typename... ArgsT>
+static inline void register_kernel(const std::string &kernel_name, disp::arch_t arch, const std::string &case_name_ext,
+                                   CaseT &&fn, ArgsT&&... args)
+{
+    for(auto &size : get_sizes())
+    {
+        std::string name = kernel_name + "/tier:" + to_string(arch) + case_name_ext + "/size:" + size.name;
+        ::benchmark::RegisterBenchmark(name.c_str(), fn, size.elements, args...)->Unit(benchmark::kNanosecond);
+    }
+}
+}
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <ops/c_api/base.hpp>
+#include <stdexcept>
+
+namespace bench::ops::c_api
+{
+template <path_e path, operation_e operation>
+class analytics_t: public operation_base_t<analytics_t<path, operation>>
+{
+public:
+    using result_t    = analytics_results_t;
+    using params_t    = analytics_params_t;
+    using data_type_t = typename result_t::data_type_t;
+    using base_t      = ops::operation_base_t<analytics_t<path, operation>>;
+    using base_api_t  = operation_base_t<analytics_t<path, operation>>;
+
+    static constexpr auto path_v = path;
+
+private:
+    using base_api_t::deinit_lib_impl;
+    using base_api_t::job_;
+    using base_t::bytes_read_;
+    using base_t::bytes_written_;
+
+public:
+    analytics_t() noexcept {}
+    ~analytics_t() noexcept
+    {
+        deinit_lib_impl();
+    }
+
+protected:
+    void init_buffers_impl(const params_t &params)
+    {
+        params_ = params;
+
+        // Enough for 32-bit elements or indices of every element
+        data_.resize(static_cast<std::size_t>(params_.elements_)*sizeof(std::uint32_t) + 64u);
+    }
+
+    void init_lib_params_impl()
+    {
+        set_buffers();
+
+        if constexpr(operation == operation_e::scan)
+            job_->op = qpl_op_scan_eq;
+        else if constexpr(operation == operation_e::extract)
+            job_->op = qpl_op_extract;
+        else if constexpr(operation == operation_e::select)
+            job_->op = qpl_op_select;
+        else if constexpr(operation == operation_e::expand)
+            job_->op = qpl_op_expand;
+        else
+            throw std::runtime_error(format("invalid analytics operation: %s", to_string(operation).c_str()));
+
+        job_->num_input_elements = params_.elements_;
+        job_->src1_bit_width     = (params_.in_format_ == input_format_e::prle) ? 0u : params_.bit_width_;
+        job_->param_low          = params_.param_low_;
+        job_->param_high         = params_.param_high_;
+        job_->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+        if(params_.decompress_)
+            job_->flags |= QPL_FLAG_DECOMPRESS_ENABLE;
+
+        switch(params_.in_format_)
+        {
+        case input_format_e::le:   job_->parser = qpl_p_le_packed_array; break;
+        case input_format_e::be:   job_->parser = qpl_p_be_packed_array; break;
+        case input_format_e::prle: job_->parser = qpl_p_parquet_rle;     break;
+        default: throw std::runtime_error(format("invalid input format: %s", to_string(params_.in_format_).c_str()));
+        }
+
+        switch(params_.out_format_)
+        {
+        case output_format_e::nominal: job_->out_bit_width = qpl_ow_nom; break;
+        case output_format_e::bits8:   job_->out_bit_width = qpl_ow_8;   break;
+        case output_format_e::bits16:  job_->out_bit_width = qpl_ow_16;  break;
+        case output_format_e::bits32:  job_->out_bit_width = qpl_ow_32;  break;
+        default: throw std::runtime_error(format("invalid output format: %s", to_string(params_.out_format_).c_str()));
+        }
+    }
+
+    void sync_execute_impl()
+    {
+        auto status = qpl_execute_job(job_);
+        if(QPL_STS_OK == status)
+        {
+            data_size_     = job_->total_out;
+            bytes_read_    = job_->total_in;
+            bytes_written_ = job_->total_out;
+        }
+        else
+            throw std::runtime_error(format("qpl_execute_job() failed with status %d", status));
+    }
+
+    void async_submit_impl()
+    {
+        auto status = qpl_submit_job(job_);
+        if(QPL_STS_OK != status)
+            throw std::runtime_error(format("qpl_submit_job() failed with status %d", status));
+    }
+
+    task_status_e async_wait_impl()
+    {
+        auto status = qpl_wait_job(job_);
+        if(QPL_STS_OK == status)
+        {
+            data_size_     = job_->total_out;
+            bytes_read_    = job_->total_in;
+            bytes_written_ = job_->total_out;
+            return task_status_e::completed;
+        }
+        else
+            throw std::runtime_error(format("qpl_wait_job() failed with status %d", status));
+    }
+
+    [[nodiscard]] task_status_e async_poll_impl()
+    {
+        auto status = qpl_check_job(job_);
+        if(QPL_STS_BEING_PROCESSED == status)
+            return task_status_e::in_progress;
+        else
+        {
+            if(QPL_STS_OK == status)
+            {
+                data_size_     = job_->total_out;
+                bytes_read_    = job_->total_in;
+                bytes_written_ = job_->total_out;
+                return task_status_e::completed;
+            }
+            else
+                throw std::runtime_error(format("qpl_check_job() failed with status %d", status));
+        }
+    }
+
+    void light_reset_impl() noexcept
+    {
+        // Paths differ in whether the stream pointers are advanced for analytics, so they are restored explicitly
+        set_buffers();
+    }
+
+    void mem_control_impl(mem_loc_e op, mem_loc_mask_e mask) const noexcept
+    {
+        if(mask&mem_loc_mask_e::src1)
+            details::mem_control(params_.p_source_data_->buffer.begin(), params_.p_source_data_->buffer.end(), op);
+        if(mask&mem_loc_mask_e::src2 && params_.p_mask_->buffer.size())
+            details::mem_control(params_.p_mask_->buffer.begin(), params_.p_mask_->buffer.end(), op);
+        if(mask&mem_loc_mask_e::dst1)
+            details::mem_control(data_.begin(), data_.end(), op);
+    }
+
+    result_t& get_result_impl() noexcept
+    {
+        result_.data_ = data_;
+        result_.data_.resize(data_size_);
+        return result_;
+    }
+
+private:
+    friend class ops::operation_base_t<analytics_t>;
+    friend class operation_base_t<analytics_t>;
+
+    void set_buffers() noexcept
+    {
+        job_->next_in_ptr   = const_cast<std::uint8_t*>(params_.p_source_data_->buffer.data());
+        job_->available_in  = static_cast<std::uint32_t>(params_.p_source_data_->buffer.size());
+        job_->next_out_ptr  = data_.data();
+        job_->available_out = static_cast<std::uint32_t>(data_.size());
+        job_->total_in      = 0;
+        job_->total_out     = 0;
+
+        if constexpr(operation == operation_e::select || operation == operation_e::expand)
+        {
+            job_->next_src2_ptr  = const_cast<std::uint8_t*>(params_.p_mask_->buffer.data());
+            job_->available_src2 = static_cast<std::uint32_t>(params_.p_mask_->buffer.size());
+            job_->src2_bit_width = 1u;
+        }
+    }
+
+    params_t    params_;
+    data_type_t data_;
+    std::size_t data_size_{0};
+    result_t    result_;
+};
+}
+
+namespace bench::ops
+{
+template <path_e path, operation_e operation>
+struct traits<operation_base_t<c_api::analytics_t<path, operation>>>
+{
+    using result_t = analytics_results_t;
+};
+}
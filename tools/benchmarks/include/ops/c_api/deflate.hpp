@@ -66,6 +66,8 @@ protected:
 
         if(params_.level_ == 1)
             job_->level = qpl_level_1;
+        else if(params_.level_ == 2)
+            job_->level = qpl_level_2;
         else if(params_.level_ == 3)
             job_->level = qpl_level_3;
         else
@@ -63,4 +63,32 @@ struct crc64_params_t
     crc_type_e            crc_type;
 };
 
+struct analytics_params_t
+{
+    explicit analytics_params_t() = default;
+    analytics_params_t(const data_t &source, const data_t &mask, std::uint32_t elements, std::uint32_t bit_width,
+                       input_format_e in_format, output_format_e out_format,
+                       std::uint32_t param_low, std::uint32_t param_high, bool decompress) :
+        p_source_data_(&source),
+        p_mask_(&mask),
+        elements_(elements),
+        bit_width_(bit_width),
+        in_format_(in_format),
+        out_format_(out_format),
+        param_low_(param_low),
+        param_high_(param_high),
+        decompress_(decompress)
+    {}
+
+    const data_t         *p_source_data_{nullptr};
+    const data_t         *p_mask_{nullptr};           // Bit vector for select and expand
+    std::uint32_t         elements_{0};               // Elements in the source, or in the mask for expand
+    std::uint32_t         bit_width_{1};
+    input_format_e        in_format_{input_format_e::le};
+    output_format_e       out_format_{output_format_e::nominal};
+    std::uint32_t         param_low_{0};
+    std::uint32_t         param_high_{0};
+    bool                  decompress_{false};         // Source is a deflate stream
+};
+
 }
@@ -39,4 +39,13 @@ struct crc64_results_t
 
     data_type_t data_;
 };
+
+struct analytics_results_t
+{
+    using data_type_t = std::vector<std::uint8_t>;
+
+    explicit analytics_results_t() {}
+
+    data_type_t data_;
+};
 }
@@ -48,6 +48,7 @@ struct statistics_t
     std::uint64_t   completed_operations{0};
     std::uint64_t   data_read{0};
     std::uint64_t   data_written{0};
+    std::uint64_t   elements{0};
 };
 
 enum class api_e
@@ -80,7 +81,11 @@ enum class operation_e
 {
     deflate,
     inflate,
-    crc64
+    crc64,
+    scan,
+    extract,
+    select,
+    expand
 };
 
 enum class stat_type_e
@@ -98,6 +103,21 @@ enum class huffman_type_e
     canned
 };
 
+enum class input_format_e
+{
+    le,
+    be,
+    prle
+};
+
+enum class output_format_e
+{
+    nominal,
+    bits8,
+    bits16,
+    bits32
+};
+
 enum class crc_type_e
 {
     crc32_gzip,
@@ -99,6 +99,11 @@ static inline std::string to_string(operation_e op)
     {
     case operation_e::deflate: return "deflate";
     case operation_e::inflate: return "inflate";
+    case operation_e::crc64:   return "crc64";
+    case operation_e::scan:    return "scan";
+    case operation_e::extract: return "extract";
+    case operation_e::select:  return "select";
+    case operation_e::expand:  return "expand";
     default:                   return "error";
     }
 }
@@ -122,6 +127,36 @@ static inline std::string to_name(huffman_type_e huffman)
     return std::string("/huffman:") + to_string(huffman);
 }
 
+static inline std::string to_string(input_format_e format)
+{
+    switch(format)
+    {
+    case input_format_e::le:   return "le";
+    case input_format_e::be:   return "be";
+    case input_format_e::prle: return "prle";
+    default:                   return "error";
+    }
+}
+static inline std::string to_name(input_format_e format)
+{
+    return std::string("/in_format:") + to_string(format);
+}
+static inline std::string to_string(output_format_e format)
+{
+    switch(format)
+    {
+    case output_format_e::nominal: return "nominal";
+    case output_format_e::bits8:   return "8";
+    case output_format_e::bits16:  return "16";
+    case output_format_e::bits32:  return "32";
+    default:                       return "error";
+    }
+}
+static inline std::string to_name(output_format_e format)
+{
+    return std::string("/out_format:") + to_string(format);
+}
+
 static inline std::string crc_to_string(crc_type_e type)
 {
     switch(type)
@@ -264,6 +299,18 @@ static inline void base_counters(benchmark::State &state, statistics_t &stat, st
                                                           benchmark::Counter::kIs1000);
         }
     }
+    else if(type == stat_type_e::filter)
+    {
+        // Note: bytes are counted on the source as it is passed to the operation, i.e. compressed for decompress-enabled runs
+        if(state.iterations() != 0) {
+            state.counters["Throughput"] = benchmark::Counter(static_cast<double>(stat.data_read / state.iterations()),
+                                                          benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads,
+                                                          benchmark::Counter::kIs1000);
+            state.counters["Elements"]   = benchmark::Counter(static_cast<double>(stat.elements / state.iterations()),
+                                                          benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads,
+                                                          benchmark::Counter::kIs1000);
+        }
+    }
 
     state.counters["Latency/Op"] = benchmark::Counter(stat.operations_per_thread,
                                                       benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads|benchmark::Counter::kInvert,
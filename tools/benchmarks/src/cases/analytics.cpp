@@ -0,0 +1,379 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <ops/ops.hpp>
+#include <data_providers.hpp>
+#include <utility.hpp>
+#include <measure.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+using namespace bench;
+
+// Synthetic column for the measurement
+struct column_t
+{
+    data_t        source;           // Packed (and optionally compressed) source
+    data_t        mask;             // Bit vector for select and expand
+    std::uint32_t elements{0};      // Value of num_input_elements
+    std::uint32_t param_low{0};
+    std::uint32_t param_high{0};
+};
+
+struct column_key_t
+{
+    operation_e    op;
+    std::uint32_t  bit_width;
+    input_format_e format;
+    double         selectivity;
+    bool           compressed;
+    std::uint32_t  elements;
+
+    bool operator==(const column_key_t &other) const
+    {
+        return op == other.op && bit_width == other.bit_width && format == other.format &&
+               selectivity == other.selectivity && compressed == other.compressed && elements == other.elements;
+    }
+};
+
+static inline std::uint32_t get_max_value(std::uint32_t bit_width)
+{
+    return (bit_width == 32u) ? UINT32_MAX : (1u << bit_width) - 1u;
+}
+
+// Element is 0 (matches the scan predicate) with the given probability, otherwise it is random non-zero value
+static std::vector<std::uint32_t> generate_values(std::uint32_t count, std::uint32_t bit_width, double selectivity, std::mt19937 &engine)
+{
+    std::bernoulli_distribution                  match(selectivity);
+    std::uniform_int_distribution<std::uint32_t> value(1u, get_max_value(bit_width));
+
+    std::vector<std::uint32_t> values(count);
+    for(auto &element : values)
+        element = match(engine) ? 0u : value(engine);
+
+    return values;
+}
+
+static std::vector<std::uint8_t> generate_mask(std::uint32_t count, double selectivity, std::mt19937 &engine)
+{
+    std::bernoulli_distribution bit(selectivity);
+
+    std::vector<std::uint8_t> mask((count + 7u)/8u, 0u);
+    for(std::uint32_t i = 0; i < count; ++i)
+    {
+        if(bit(engine))
+            mask[i/8u] |= static_cast<std::uint8_t>(1u << (i%8u));
+    }
+
+    // Source of expand can't be empty
+    mask[0] |= 1u;
+
+    return mask;
+}
+
+static std::vector<std::uint8_t> pack_le(const std::vector<std::uint32_t> &values, std::uint32_t bit_width)
+{
+    std::vector<std::uint8_t> buffer((values.size()*bit_width + 7u)/8u, 0u);
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        for(std::uint32_t bit = 0; bit < bit_width; ++bit)
+        {
+            if((values[i] >> bit) & 1u)
+            {
+                std::size_t position = i*bit_width + bit;
+                buffer[position/8u] |= static_cast<std::uint8_t>(1u << (position%8u));
+            }
+        }
+    }
+
+    return buffer;
+}
+
+static std::vector<std::uint8_t> pack_be(const std::vector<std::uint32_t> &values, std::uint32_t bit_width)
+{
+    std::vector<std::uint8_t> buffer((values.size()*bit_width + 7u)/8u, 0u);
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        for(std::uint32_t bit = 0; bit < bit_width; ++bit)
+        {
+            if((values[i] >> bit) & 1u)
+            {
+                std::size_t position = i*bit_width + (bit_width - 1u - bit);
+                buffer[position/8u] |= static_cast<std::uint8_t>(0x80u >> (position%8u));
+            }
+        }
+    }
+
+    return buffer;
+}
+
+// Parquet RLE: bit width byte followed by RLE runs for repeated groups of 8 values and bit-packed runs for the rest
+static std::vector<std::uint8_t> pack_prle(const std::vector<std::uint32_t> &values, std::uint32_t bit_width)
+{
+    std::vector<std::uint8_t>  stream{static_cast<std::uint8_t>(bit_width)};
+    std::vector<std::uint32_t> literals;
+
+    auto put_varint = [&stream](std::uint32_t value)
+    {
+        while(value >= 0x80u)
+        {
+            stream.push_back(static_cast<std::uint8_t>(value | 0x80u));
+            value >>= 7u;
+        }
+        stream.push_back(static_cast<std::uint8_t>(value));
+    };
+    auto flush_literals = [&]()
+    {
+        if(literals.empty())
+            return;
+
+        put_varint(static_cast<std::uint32_t>((literals.size()/8u) << 1u) | 1u);
+        auto packed = pack_le(literals, bit_width);
+        stream.insert(stream.end(), packed.begin(), packed.end());
+        literals.clear();
+    };
+
+    std::size_t i = 0;
+    while(i < values.size())
+    {
+        std::size_t group_end = std::min(i + 8u, values.size());
+        bool        is_run    = (group_end - i == 8u) && std::all_of(&values[i], &values[i] + 8u, [&](std::uint32_t v) { return v == values[i]; });
+
+        if(is_run)
+        {
+            std::size_t run_end = group_end;
+            while(run_end < values.size() && values[run_end] == values[i])
+                run_end++;
+
+            flush_literals();
+            put_varint(static_cast<std::uint32_t>(run_end - i) << 1u);
+            for(std::uint32_t byte = 0; byte < (bit_width + 7u)/8u; ++byte)
+                stream.push_back(static_cast<std::uint8_t>(values[i] >> (byte*8u)));
+
+            i = run_end;
+        }
+        else
+        {
+            literals.insert(literals.end(), &values[i], &values[i] + (group_end - i));
+            literals.resize((literals.size() + 7u)/8u*8u, 0u);
+
+            i = group_end;
+        }
+    }
+    flush_literals();
+
+    return stream;
+}
+
+static std::vector<std::uint8_t> compress(const std::vector<std::uint8_t> &source)
+{
+    std::uint32_t size = 0;
+    auto status = qpl_get_job_size(qpl_path_software, &size);
+    if (QPL_STS_OK != status)
+        throw std::runtime_error(format("qpl_get_job_size() failed with status %d", status));
+
+    std::unique_ptr<std::uint8_t[]> job_buffer(new std::uint8_t[size]);
+    qpl_job *job = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    status = qpl_init_job(qpl_path_software, job);
+    if (QPL_STS_OK != status)
+        throw std::runtime_error(format("qpl_init_job() failed with status %d", status));
+
+    std::vector<std::uint8_t> stream(source.size() + source.size()/2u + 1024u);
+
+    job->next_in_ptr   = const_cast<std::uint8_t*>(source.data());
+    job->available_in  = static_cast<std::uint32_t>(source.size());
+    job->next_out_ptr  = stream.data();
+    job->available_out = static_cast<std::uint32_t>(stream.size());
+    job->op            = qpl_op_compress;
+    job->level         = qpl_default_level;
+    job->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+
+    status = qpl_execute_job(job);
+    stream.resize(job->total_out);
+    qpl_fini_job(job);
+
+    if (QPL_STS_OK != status)
+        throw std::runtime_error(format("qpl_execute_job() failed with status %d", status));
+
+    return stream;
+}
+
+static std::shared_ptr<const column_t> generate_column(const column_key_t &key)
+{
+    auto column = std::make_shared<column_t>();
+
+    std::mt19937 engine(key.bit_width);
+
+    std::vector<std::uint32_t> values;
+    if(key.op == operation_e::expand)
+    {
+        // Source holds an element for each set bit of the mask
+        column->mask.buffer = generate_mask(key.elements, key.selectivity, engine);
+
+        std::uint32_t count = 0;
+        for(auto byte : column->mask.buffer)
+            count += __builtin_popcount(byte);
+
+        values           = generate_values(count, key.bit_width, key.selectivity, engine);
+        column->elements = key.elements;
+    }
+    else
+    {
+        values           = generate_values(key.elements, key.bit_width, key.selectivity, engine);
+        column->elements = key.elements;
+
+        if(key.op == operation_e::select)
+            column->mask.buffer = generate_mask(key.elements, key.selectivity, engine);
+
+        if(key.op == operation_e::extract)
+        {
+            // Extract the middle of the column
+            std::uint32_t count = std::max(1u, static_cast<std::uint32_t>(key.elements*key.selectivity));
+            column->param_low  = (key.elements - count)/2u;
+            column->param_high = column->param_low + count - 1u;
+        }
+    }
+
+    switch(key.format)
+    {
+    case input_format_e::le:   column->source.buffer = pack_le(values, key.bit_width);   break;
+    case input_format_e::be:   column->source.buffer = pack_be(values, key.bit_width);   break;
+    case input_format_e::prle: column->source.buffer = pack_prle(values, key.bit_width); break;
+    default: throw std::runtime_error(format("invalid input format: %s", to_string(key.format).c_str()));
+    }
+
+    if(key.compressed)
+        column->source.buffer = compress(column->source.buffer);
+
+    return column;
+}
+
+// Columns are generated at the measurement time, as keeping all of them for registered cases takes too much memory.
+// Cases with the same column are registered one by one, so only the last one is cached
+static std::shared_ptr<const column_t> get_column(const column_key_t &key)
+{
+    static std::mutex                      guard;
+    static column_key_t                    cached_key{};
+    static std::shared_ptr<const column_t> cached_column;
+
+    std::lock_guard<std::mutex> lock(guard);
+    if(!cached_column || !(cached_key == key))
+    {
+        cached_column = generate_column(key);
+        cached_key    = key;
+    }
+
+    return cached_column;
+}
+
+template <execution_e exec, api_e api, path_e path, operation_e operation>
+class analytics_t
+{
+public:
+    static constexpr auto exec_v = exec;
+    static constexpr auto api_v  = api;
+    static constexpr auto path_v = path;
+
+    void operator()(benchmark::State &state, const case_params_t &common_params, const data_t &,
+                    column_key_t key, output_format_e out_format) const
+    {
+        try
+        {
+            // Prepare analytics
+            auto column = get_column(key);
+            ops::analytics_params_t params(column->source, column->mask, column->elements, key.bit_width,
+                                           key.format, out_format, column->param_low, column->param_high, key.compressed);
+            std::vector<ops::analytics_t<api, path, operation>> operations;
+
+            // Measuring loop
+            auto stat = measure<exec, path>(state, common_params, operations, params);
+
+            // Set counters
+            stat.elements = stat.completed_operations*column->elements;
+            base_counters(state, stat, stat_type_e::filter);
+        }
+        catch(std::runtime_error &err) { state.SkipWithError(err.what()); }
+        catch(...)                     { state.SkipWithError("Unknown exception"); }
+    }
+};
+
+// Output modification either converts 1-bit results to indices, which must fit into the output width,
+// or widens the elements, which can't be narrowed
+static inline bool is_supported(operation_e op, std::uint32_t bit_width, output_format_e out_format, std::uint32_t elements)
+{
+    if(out_format == output_format_e::nominal)
+        return true;
+
+    std::uint32_t out_width = (out_format == output_format_e::bits8) ? 8u : (out_format == output_format_e::bits16) ? 16u : 32u;
+
+    if(op == operation_e::scan || bit_width == 1u)
+        return out_width == 32u || elements <= (1u << out_width);
+
+    return bit_width <= out_width;
+}
+
+template <path_e path, operation_e operation>
+static inline void cases_set(const column_key_t &key, output_format_e out_format)
+{
+    if(path != path_e::cpu && cmd::FLAGS_no_hw)
+        return;
+
+    std::string name = to_name(key.bit_width, "bit_width") + to_name(key.format) + to_name(out_format) +
+                       format("/selectivity:%g", key.selectivity*100) + to_name(key.compressed, "compressed");
+
+    register_benchmarks_common(to_string(operation), to_name(path, "gen_path") + name, analytics_t<execution_e::sync,  api_e::c, path, operation>{}, case_params_t{}, data_t{}, key, out_format);
+    register_benchmarks_common(to_string(operation), to_name(path, "gen_path") + name, analytics_t<execution_e::async, api_e::c, path, operation>{}, case_params_t{}, data_t{}, key, out_format);
+}
+
+template <operation_e operation>
+static inline void operation_cases_set()
+{
+    std::vector<input_format_e>  in_formats{input_format_e::le, input_format_e::be, input_format_e::prle};
+    std::vector<output_format_e> out_formats{output_format_e::nominal, output_format_e::bits8, output_format_e::bits16, output_format_e::bits32};
+    std::vector<double>          selectivities{0.001, 0.01, 0.1, 0.5, 0.9, 0.99};
+    std::vector<bool>            compression_modes{false, true};
+
+    if(cmd::FLAGS_elements <= 0)
+        throw std::runtime_error("invalid number of elements");
+
+    for(std::uint32_t bit_width = 1; bit_width <= 32u; ++bit_width)
+    {
+        for(auto &in_format : in_formats)
+        {
+            for(auto compressed : compression_modes)
+            {
+                for(auto &selectivity : selectivities)
+                {
+                    column_key_t key{operation, bit_width, in_format, selectivity, compressed, static_cast<std::uint32_t>(cmd::FLAGS_elements)};
+
+                    for(auto &out_format : out_formats)
+                    {
+                        if(!is_supported(operation, bit_width, out_format, key.elements))
+                            continue;
+
+                        cases_set<path_e::iaa, operation>(key, out_format);
+                        cases_set<path_e::cpu, operation>(key, out_format);
+                    }
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK_SET_DELAYED(analytics)
+{
+    operation_cases_set<operation_e::scan>();
+    operation_cases_set<operation_e::extract>();
+    operation_cases_set<operation_e::select>();
+    operation_cases_set<operation_e::expand>();
+}
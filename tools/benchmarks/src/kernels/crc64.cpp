@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <kernels.hpp>
+
+namespace bench::kernels
+{
+// Elements are bytes for checksums
+static void crc64(benchmark::State &state, std::uint32_t elements, qplc_crc64_t_ptr kernel, std::uint64_t poly, bool be)
+{
+    auto src = random_bytes(elements);
+
+    measure(state, elements, elements, [&]()
+    {
+        benchmark::DoNotOptimize(kernel(src.data(), elements, poly, be, 0u));
+    });
+}
+
+static void crc64_fold(benchmark::State &state, std::uint32_t elements, void *init_kernel, void *fold_kernel, std::uint64_t poly, bool be)
+{
+    auto init = reinterpret_cast<qplc_crc64_init_constants_t_ptr>(init_kernel);
+    auto fold = reinterpret_cast<qplc_crc64_fold_t_ptr>(fold_kernel);
+
+    auto src = random_bytes(elements);
+
+    // Constants are cached per polynomial by the library, so they are prepared outside of the measurement
+    qplc_crc64_constants_t constants{};
+    init(poly, be, &constants);
+
+    measure(state, elements, elements, [&]()
+    {
+        benchmark::DoNotOptimize(fold(src.data(), elements, 0u, &constants));
+    });
+}
+
+BENCHMARK_SET_DELAYED(crc64)
+{
+    struct poly_t
+    {
+        std::string   name;
+        std::uint64_t poly;
+    };
+    const std::vector<poly_t> polys{{"iscsi", 0x1EDC6F4100000000ULL}, {"ecma", 0x42F0E1EBA9EA3693ULL}};
+
+    for(auto arch : get_tiers())
+    {
+        auto crc64_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_crc64_table(); });
+        for(auto &poly : polys)
+        {
+            for(bool be : {false, true})
+            {
+                const std::string case_name = "/poly:" + poly.name + "/order:" + ((be) ? "be" : "le");
+
+                register_kernel("crc64", arch, case_name, crc64, reinterpret_cast<qplc_crc64_t_ptr>(crc64_table[0]), poly.poly, be);
+                register_kernel("crc64_fold", arch, case_name, crc64_fold, crc64_table[1], crc64_table[2], poly.poly, be);
+            }
+        }
+    }
+}
+}
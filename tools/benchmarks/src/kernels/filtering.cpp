@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <kernels.hpp>
+
+namespace bench::kernels
+{
+// Flavors in the order of the scan table
+static const char *scan_flavors[] = {"eq", "ne", "lt", "le", "gt", "ge", "range", "not_range"};
+
+static void scan(benchmark::State &state, std::uint32_t elements, qplc_scan_t_ptr kernel, std::uint32_t bit_width)
+{
+    const std::size_t src_size = static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width);
+
+    // Parameters are in the middle of the values range, so the output is mixed
+    const std::uint32_t max_value = (bit_width == 32u) ? UINT32_MAX : (1u << bit_width) - 1u;
+    const std::uint32_t low       = max_value/4u;
+    const std::uint32_t high      = max_value/4u*3u;
+
+    auto src = random_elements(elements, bit_width);
+    std::vector<std::uint8_t> dst(static_cast<std::size_t>(elements) + buffer_padding);
+
+    measure(state, elements, src_size, [&]()
+    {
+        kernel(src.data(), dst.data(), elements, low, high);
+    });
+}
+
+static void aggregates(benchmark::State &state, std::uint32_t elements, qplc_aggregates_t_ptr kernel, std::uint32_t bit_width)
+{
+    const std::size_t src_size = static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width);
+
+    // Bit aggregates take the scan output, where each byte is 0 or 1
+    auto src = random_elements(elements, bit_width);
+
+    measure(state, elements, src_size, [&]()
+    {
+        std::uint32_t min   = UINT32_MAX;
+        std::uint32_t max   = 0u;
+        std::uint64_t sum   = 0u;
+        std::uint32_t index = 0u;
+
+        kernel(src.data(), elements, &min, &max, &sum, &index);
+        benchmark::DoNotOptimize(sum);
+    });
+}
+
+static void expand(benchmark::State &state, std::uint32_t elements, qplc_expand_t_ptr kernel, std::uint32_t bit_width)
+{
+    const std::size_t src_size = static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width);
+
+    auto src  = random_elements(elements, bit_width);
+    auto mask = random_elements(elements, 1u, 1u);
+    std::vector<std::uint8_t> dst(src_size + buffer_padding);
+
+    measure(state, elements, src_size + elements, [&]()
+    {
+        std::uint32_t length_2 = elements;
+
+        benchmark::DoNotOptimize(kernel(src.data(), elements, mask.data(), &length_2, dst.data()));
+    });
+}
+
+BENCHMARK_SET_DELAYED(filtering)
+{
+    for(auto arch : get_tiers())
+    {
+        auto scan_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_scan_table(); });
+        for(std::uint32_t flavor = 0u; flavor < std::size(scan_flavors); ++flavor)
+        {
+            for(std::uint32_t bit_width : {8u, 16u, 32u})
+            {
+                auto kernel = scan_table[disp::get_scan_index(bit_width, flavor)];
+                register_kernel("scan", arch, std::string("/flavor:") + scan_flavors[flavor] + "/width:" + std::to_string(bit_width),
+                                scan, kernel, bit_width);
+            }
+        }
+
+        auto aggregates_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_aggregates_table(); });
+        for(std::uint32_t bit_width : {1u, 8u, 16u, 32u})
+        {
+            auto kernel = aggregates_table[disp::get_aggregates_index(bit_width)];
+            register_kernel("aggregates", arch, "/width:" + std::to_string(bit_width), aggregates, kernel, bit_width);
+        }
+
+        auto expand_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_expand_table(); });
+        for(std::uint32_t bit_width : {8u, 16u, 32u})
+        {
+            auto kernel = expand_table[disp::get_expand_index(bit_width)];
+            register_kernel("expand", arch, "/width:" + std::to_string(bit_width), expand, kernel, bit_width);
+        }
+    }
+}
+}
@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <kernels.hpp>
+
+namespace bench::details
+{
+registry_t& get_registry()
+{
+    static registry_t reg;
+    return reg;
+}
+}
+
+//
+// Main
+//
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    printf("SW Kernels:           ");
+    for(auto arch : bench::kernels::get_tiers())
+        printf("%s ", bench::kernels::to_string(arch).c_str());
+    printf("\n");
+
+    auto &registry = bench::details::get_registry();
+    for(auto &reg : registry)
+        reg();
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
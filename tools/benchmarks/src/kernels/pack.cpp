@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <kernels.hpp>
+
+namespace bench::kernels
+{
+static void pack(benchmark::State &state, std::uint32_t elements, qplc_pack_bits_t_ptr kernel, std::uint32_t bit_width)
+{
+    const std::size_t src_size = static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width);
+
+    auto src = random_elements(elements, bit_width);
+    std::vector<std::uint8_t> dst((static_cast<std::size_t>(elements)*bit_width + 7u)/8u + buffer_padding);
+
+    measure(state, elements, src_size, [&]()
+    {
+        kernel(src.data(), elements, dst.data(), 0u);
+    });
+}
+
+BENCHMARK_SET_DELAYED(pack)
+{
+    for(auto arch : get_tiers())
+    {
+        auto pack_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_pack_table(); });
+        for(std::uint32_t be = 0u; be <= 1u; ++be)
+        {
+            for(std::uint32_t bit_width = 1u; bit_width <= 32u; ++bit_width)
+            {
+                auto kernel = pack_table[disp::get_pack_bits_index(be, bit_width, 0u)];
+                register_kernel("pack", arch, std::string("/format:") + ((be) ? "be" : "le") + "/width:" + std::to_string(bit_width),
+                                pack, kernel, bit_width);
+            }
+        }
+    }
+}
+}
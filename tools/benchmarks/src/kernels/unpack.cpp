@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <kernels.hpp>
+
+namespace bench::kernels
+{
+static void unpack(benchmark::State &state, std::uint32_t elements, qplc_unpack_bits_t_ptr kernel, std::uint32_t bit_width)
+{
+    const std::size_t src_size = (static_cast<std::size_t>(elements)*bit_width + 7u)/8u;
+
+    auto src = random_bytes(src_size);
+    std::vector<std::uint8_t> dst(static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width) + buffer_padding);
+
+    measure(state, elements, src_size, [&]()
+    {
+        kernel(src.data(), elements, 0u, dst.data());
+    });
+}
+
+// Parquet RLE stream without the bit width byte: 4 literal octa-groups followed by a run of 32 equal values
+static std::vector<std::uint8_t> generate_prle(std::uint32_t elements, std::uint32_t bit_width)
+{
+    constexpr std::uint32_t groups   = 4u;
+    constexpr std::uint32_t run_size = 32u;
+
+    const std::uint32_t value_bytes = (bit_width + 7u)/8u;
+    const std::uint32_t value_mask  = (bit_width == 32u) ? UINT32_MAX : (1u << bit_width) - 1u;
+
+    const std::uint32_t sequences     = (elements + groups*8u + run_size - 1u)/(groups*8u + run_size);
+    const std::uint32_t literal_bytes = groups*bit_width;
+
+    auto literals = random_bytes(static_cast<std::size_t>(sequences)*literal_bytes);
+
+    std::vector<std::uint8_t> stream;
+    for(std::uint32_t sequence = 0; sequence < sequences; ++sequence)
+    {
+        stream.push_back(static_cast<std::uint8_t>((groups << 1u) | 1u));
+        auto literals_begin = literals.begin() + static_cast<std::ptrdiff_t>(sequence)*literal_bytes;
+        stream.insert(stream.end(), literals_begin, literals_begin + literal_bytes);
+
+        stream.push_back(static_cast<std::uint8_t>(run_size << 1u));
+        std::uint32_t value = (sequence*2654435761u) & value_mask;
+        for(std::uint32_t byte = 0; byte < value_bytes; ++byte)
+            stream.push_back(static_cast<std::uint8_t>(value >> (byte*8u)));
+    }
+
+    return stream;
+}
+
+static void unpack_prle(benchmark::State &state, std::uint32_t elements, qplc_unpack_prle_t_ptr kernel, std::uint32_t bit_width)
+{
+    auto src = generate_prle(elements, bit_width);
+    std::vector<std::uint8_t> dst(static_cast<std::size_t>(elements)*get_unpacked_bytes(bit_width) + buffer_padding);
+
+    measure(state, elements, src.size(), [&]()
+    {
+        std::uint8_t  *src_ptr = src.data();
+        std::uint8_t  *dst_ptr = dst.data();
+        std::int32_t   count   = 0;
+        std::uint32_t  value   = 0u;
+
+        benchmark::DoNotOptimize(kernel(&src_ptr, static_cast<std::uint32_t>(src.size()), bit_width, &dst_ptr, elements, &count, &value));
+    });
+}
+
+BENCHMARK_SET_DELAYED(unpack)
+{
+    for(auto arch : get_tiers())
+    {
+        auto unpack_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_unpack_table(); });
+        for(std::uint32_t be = 0u; be <= 1u; ++be)
+        {
+            for(std::uint32_t bit_width = 1u; bit_width <= 32u; ++bit_width)
+            {
+                auto kernel = unpack_table[disp::get_unpack_index(be, bit_width)];
+                register_kernel("unpack", arch, std::string("/format:") + ((be) ? "be" : "le") + "/width:" + std::to_string(bit_width),
+                                unpack, kernel, bit_width);
+            }
+        }
+
+        auto prle_table = get_kernel(arch, [](auto &dispatcher) { return dispatcher.get_unpack_prle_table(); });
+        for(std::uint32_t bit_width : {5u, 13u, 27u})
+        {
+            auto kernel = prle_table[disp::get_unpack_prle_index(bit_width)];
+            register_kernel("unpack_prle", arch, "/width:" + std::to_string(bit_width), unpack_prle, kernel, bit_width);
+        }
+    }
+}
+}
@@ -10,6 +10,7 @@
 #include <qpl/qpl.h>
 #include "../include/cmd_decl.hpp"
 #include "dispatcher/hw_dispatcher.hpp"
+#include "dispatcher.hpp"
 
 #if defined( __linux__ )
 #include <sys/utsname.h>
@@ -126,6 +127,16 @@ static inline accel_info_t& get_accels_info() noexcept
     return info;
 }
 
+static const char* get_sw_arch_name()
+{
+    switch (qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_arch())
+    {
+        case qpl::core_sw::dispatcher::avx512_arch: return "avx512";
+        case qpl::core_sw::dispatcher::avx2_arch:   return "avx2";
+        default:                                    return "px";
+    }
+}
+
 const extended_info_t& get_sys_info()
 {
     static extended_info_t info;
@@ -188,6 +199,7 @@ const extended_info_t& get_sys_info()
         printf("    Physical Cores:   %d\n", info.cpu_physical_cores);
         printf("    Cores per Socket: %d\n", info.cpu_physical_per_socket);
         printf("    Sockets:          %d\n", info.cpu_sockets);
+        printf("SW Kernels:           %s\n", get_sw_arch_name());
         printf("Accelerators:         %ld\n", info.accelerators.total_devices);
         for (auto& it : info.accelerators.devices_per_numa) {
             printf("    On NUMA %d:        %ld\n", it.first, it.second);
@@ -216,10 +228,13 @@ BM_DEFINE_string(in_mem, "llc");
 BM_DEFINE_string(out_mem, "cс_ram");
 BM_DEFINE_bool(full_time, false);
 BM_DEFINE_bool(no_hw, false);
+BM_DEFINE_string(sw_arch, "");
 
 BM_DEFINE_double(canned_part, -1);
 BM_DEFINE_bool(canned_regen, false);
 
+BM_DEFINE_int32(elements, 65536);
+
 static void print_help()
 {
     fprintf(stdout,
@@ -234,12 +249,16 @@ static void print_help()
             "          [--out_mem=<location>]        - output memory location: cache_ram (default), ram\n"
             "          [--full_time]                 - measure library specific task initialization and destruction\n"
             "          [--no_hw]                     - run only software implementations\n"
+            "          [--sw_arch=<arch>]            - force software kernels tier: px, avx2, avx512. Default: best supported\n"
 
             "\nCompression/decompression arguments:\n"
             "benchmark [--canned_part=<num>]         - amount of data used for tables generation:\n"
             "                                          0 - full file; (0-1) - portion of file. [1-N] - number of blocks\n"
             "          [--canned_regen]              - regen tables for each part\n"
 
+            "\nAnalytics arguments:\n"
+            "benchmark [--elements=<num>]            - number of elements in the source column (65536 by default)\n"
+
             "\nDefault benchmark arguments:\n");
 }
 
@@ -255,11 +274,14 @@ static void parse_local(int* argc, char** argv)
            benchmark::ParseInt32Flag(argv[i],   "queue_size",   &FLAGS_queue_size) ||
            benchmark::ParseInt32Flag(argv[i],   "batch_size",   &FLAGS_batch_size) ||
            benchmark::ParseBoolFlag(argv[i],    "no_hw",        &FLAGS_no_hw) ||
+           benchmark::ParseStringFlag(argv[i],  "sw_arch",      &FLAGS_sw_arch) ||
            benchmark::ParseStringFlag(argv[i],  "in_mem",       &FLAGS_in_mem) ||
            benchmark::ParseStringFlag(argv[i],  "out_mem",      &FLAGS_out_mem) ||
 
            benchmark::ParseDoubleFlag(argv[i],  "canned_part",  &FLAGS_canned_part) ||
-           benchmark::ParseBoolFlag(argv[i],    "canned_regen", &FLAGS_canned_regen))
+           benchmark::ParseBoolFlag(argv[i],    "canned_regen", &FLAGS_canned_regen) ||
+
+           benchmark::ParseInt32Flag(argv[i],   "elements",     &FLAGS_elements))
         {
             for(int j = i; j != *argc - 1; ++j)
                 argv[j] = argv[j + 1];
@@ -315,6 +337,29 @@ mem_loc_e get_in_mem()
     return mem;
 }
 
+void set_sw_arch()
+{
+    namespace disp = qpl::core_sw::dispatcher;
+
+    auto str = FLAGS_sw_arch;
+    if(str.empty())
+        return;
+
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    disp::arch_t arch;
+    if(str == "px")
+        arch = disp::px_arch;
+    else if(str == "avx2")
+        arch = disp::avx2_arch;
+    else if(str == "avx512")
+        arch = disp::avx512_arch;
+    else
+        throw std::runtime_error("invalid software kernels tier");
+
+    if(!disp::kernels_dispatcher::get_instance().set_arch(arch))
+        throw std::runtime_error("software kernels tier is not supported by the CPU");
+}
+
 mem_loc_e get_out_mem()
 {
     static mem_loc_e mem = (mem_loc_e)-1;
@@ -368,6 +413,7 @@ int main(int argc, char** argv)
     bench::cmd::parse_local(&argc, argv);
     ::benchmark::Initialize(&argc, argv);
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    bench::cmd::set_sw_arch();
     bench::details::get_sys_info();
 
     if(!bench::cmd::FLAGS_no_hw)
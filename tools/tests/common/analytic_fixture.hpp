@@ -72,6 +72,10 @@ namespace qpl::test
     {
     public:
         std::vector<uint8_t> GetCompressedSource(bool is_indexing_enabled = false) {
+            return GetCompressedData(source, is_indexing_enabled);
+        }
+
+        std::vector<uint8_t> GetCompressedData(std::vector<uint8_t> &data, bool is_indexing_enabled = false) {
             uint32_t job_size = 0;
             qpl_job   *deflate_job_ptr;
             auto     status   = qpl_get_job_size(GetExecutionPath(), &job_size);
@@ -92,23 +96,23 @@ namespace qpl::test
             }
 
             const uint32_t MINIMAL_DESTINATION_SIZE = 100u;
-            uint32_t       destination_size         = static_cast<uint32_t>(source.size()) * 2;
+            uint32_t       destination_size         = static_cast<uint32_t>(data.size()) * 2;
             destination_size = (destination_size < MINIMAL_DESTINATION_SIZE) ? MINIMAL_DESTINATION_SIZE
                                                                              : destination_size;
 
-            std::vector<uint8_t> compressed_source(destination_size, 0);
+            std::vector<uint8_t> compressed_data(destination_size, 0);
 
             deflate_job_ptr->op       = qpl_op_compress;
             deflate_job_ptr->level    = qpl_default_level;
             deflate_job_ptr->flags    = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
-            deflate_job_ptr->available_in  = static_cast<uint32_t>(source.size());
-            deflate_job_ptr->next_in_ptr   = source.data();
-            deflate_job_ptr->available_out = static_cast<uint32_t>(compressed_source.size());
-            deflate_job_ptr->next_out_ptr  = compressed_source.data();
+            deflate_job_ptr->available_in  = static_cast<uint32_t>(data.size());
+            deflate_job_ptr->next_in_ptr   = data.data();
+            deflate_job_ptr->available_out = static_cast<uint32_t>(compressed_data.size());
+            deflate_job_ptr->next_out_ptr  = compressed_data.data();
 
             if (is_indexing_enabled) {
                 deflate_job_ptr->mini_block_size = qpl_mblk_size_32k;
-                auto mini_blocks_count = static_cast<uint32_t>(compressed_source.size() / qpl_mblk_size_32k);
+                auto mini_blocks_count = static_cast<uint32_t>(compressed_data.size() / qpl_mblk_size_32k);
                 index_table.reset(mini_blocks_count, mini_blocks_count);
 
                 deflate_job_ptr->idx_array = reinterpret_cast<uint64_t *>(index_table.data());
@@ -131,9 +135,9 @@ namespace qpl::test
                 job_ptr->idx_num_written = deflate_job_ptr->idx_num_written;
             }
 
-            compressed_source.resize(deflate_job_ptr->total_out);
+            compressed_data.resize(deflate_job_ptr->total_out);
 
-            return compressed_source;
+            return compressed_data;
         }
 
     protected:
@@ -13,6 +13,32 @@ namespace qpl::test
 {
     class AnalyticMaskFixture : public AnalyticFixture
     {
+    public:
+        std::vector<uint8_t> GetCompressedMask() {
+            return GetCompressedData(mask);
+        }
+
+        /**
+         * @brief Encodes the little-endian mask as a Parquet RLE stream with a single bit-packed run
+         */
+        std::vector<uint8_t> GetPrleMask() const {
+            std::vector<uint8_t> prle_mask;
+
+            prle_mask.push_back(1u); // Bit width
+
+            uint32_t header = (static_cast<uint32_t>(mask.size()) << 1u) | 1u;
+
+            while (header > 0x7Fu) {
+                prle_mask.push_back(static_cast<uint8_t>((header & 0x7Fu) | 0x80u));
+                header >>= 7u;
+            }
+
+            prle_mask.push_back(static_cast<uint8_t>(header));
+            prle_mask.insert(prle_mask.end(), mask.begin(), mask.end());
+
+            return prle_mask;
+        }
+
     protected:
         void SetBuffers() override
         {
@@ -105,4 +105,36 @@ namespace qpl::test
         ASSERT_EQ(library_max_value, reference_max_value);
         ASSERT_EQ(library_sum_value, reference_sum_value);
     }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(aggregates, sum_64, JobFixture)
+    {
+        if (qpl_path_hardware == GetExecutionPath())
+        {
+            GTEST_SKIP() << "64-bit sum is calculated on the software path only";
+        }
+
+        constexpr uint32_t number_of_elements = 1024u;
+
+        std::vector<uint32_t> source(number_of_elements, UINT32_MAX);
+        std::vector<uint32_t> destination(number_of_elements);
+
+        job_ptr->op                 = qpl_op_extract;
+        job_ptr->next_in_ptr        = reinterpret_cast<uint8_t *>(source.data());
+        job_ptr->available_in       = static_cast<uint32_t>(source.size() * sizeof(uint32_t));
+        job_ptr->next_out_ptr       = reinterpret_cast<uint8_t *>(destination.data());
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size() * sizeof(uint32_t));
+        job_ptr->src1_bit_width     = 32u;
+        job_ptr->num_input_elements = number_of_elements;
+        job_ptr->param_low          = 0u;
+        job_ptr->param_high         = number_of_elements - 1u;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->flags              = 0u;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        const uint64_t reference_sum_value = static_cast<uint64_t>(UINT32_MAX) * number_of_elements;
+
+        ASSERT_EQ(job_ptr->sum_value_64, reference_sum_value);
+        ASSERT_EQ(job_ptr->sum_value, static_cast<uint32_t>(reference_sum_value));
+    }
 }
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t batch_jobs_count    = 70u;
+constexpr uint32_t batch_page_size     = 4096u;
+constexpr uint32_t batch_threads_count = 4u;
+
+class BatchTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        uint32_t job_size = 0u;
+        ASSERT_EQ(qpl_get_job_size(GetExecutionPath(), &job_size), QPL_STS_OK);
+
+        for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+            job_buffers.emplace_back(std::make_unique<uint8_t[]>(job_size));
+            jobs.push_back(reinterpret_cast<qpl_job *>(job_buffers.back().get()));
+
+            ASSERT_EQ(qpl_init_job(GetExecutionPath(), jobs.back()), QPL_STS_OK);
+        }
+
+        source_provider source_gen(batch_jobs_count * batch_page_size, 8u, GetSeed());
+        source = source_gen.get_source();
+
+        compressed.resize(batch_jobs_count, std::vector<uint8_t>(batch_page_size * 2u));
+        decompressed.resize(batch_jobs_count, std::vector<uint8_t>(batch_page_size));
+
+        statuses.resize(batch_jobs_count);
+        completion_bitmap.resize((batch_jobs_count + 63u) / 64u);
+
+        batch.jobs_ptr              = jobs.data();
+        batch.jobs_count            = batch_jobs_count;
+        batch.threads_count         = batch_threads_count;
+        batch.statuses_ptr          = statuses.data();
+        batch.completion_bitmap_ptr = completion_bitmap.data();
+        batch.completed_count       = 0u;
+    }
+
+    void TearDown() override {
+        for (auto job : jobs) {
+            qpl_fini_job(job);
+        }
+
+        JobFixture::TearDown();
+    }
+
+protected:
+    void CheckBatchCompleted() {
+        ASSERT_EQ(batch.completed_count, batch_jobs_count);
+
+        for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+            ASSERT_TRUE(completion_bitmap[i / 64u] & (1ULL << (i % 64u))) << "Job " << i << " is not completed";
+            ASSERT_EQ(statuses[i], QPL_STS_OK) << "Job " << i << " failed";
+        }
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers;
+    std::vector<qpl_job *>                  jobs;
+    std::vector<uint8_t>                    source;
+    std::vector<std::vector<uint8_t>>       compressed;
+    std::vector<std::vector<uint8_t>>       decompressed;
+    std::vector<qpl_status>                 statuses;
+    std::vector<uint64_t>                   completion_bitmap;
+    qpl_batch                               batch{};
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(batch, compress_decompress_pages, BatchTest) {
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        jobs[i]->op            = qpl_op_compress;
+        jobs[i]->level         = qpl_default_level;
+        jobs[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY;
+        jobs[i]->next_in_ptr   = source.data() + i * batch_page_size;
+        jobs[i]->available_in  = batch_page_size;
+        jobs[i]->next_out_ptr  = compressed[i].data();
+        jobs[i]->available_out = static_cast<uint32_t>(compressed[i].size());
+    }
+
+    ASSERT_EQ(qpl_submit_batch(&batch), QPL_STS_OK);
+    ASSERT_EQ(qpl_wait_batch(&batch), QPL_STS_OK);
+    ASSERT_NO_FATAL_FAILURE(CheckBatchCompleted());
+
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        const uint32_t compressed_size = jobs[i]->total_out;
+
+        ASSERT_EQ(qpl_init_job(GetExecutionPath(), jobs[i]), QPL_STS_OK);
+
+        jobs[i]->op            = qpl_op_decompress;
+        jobs[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        jobs[i]->next_in_ptr   = compressed[i].data();
+        jobs[i]->available_in  = compressed_size;
+        jobs[i]->next_out_ptr  = decompressed[i].data();
+        jobs[i]->available_out = static_cast<uint32_t>(decompressed[i].size());
+    }
+
+    ASSERT_EQ(qpl_submit_batch(&batch), QPL_STS_OK);
+    ASSERT_EQ(qpl_wait_batch(&batch), QPL_STS_OK);
+    ASSERT_NO_FATAL_FAILURE(CheckBatchCompleted());
+
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        std::vector<uint8_t> page(source.begin() + i * batch_page_size, source.begin() + (i + 1u) * batch_page_size);
+
+        ASSERT_EQ(jobs[i]->total_out, batch_page_size);
+        ASSERT_TRUE(CompareVectors(decompressed[i], page));
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(batch, empty, BatchTest) {
+    batch.jobs_count = 0u;
+
+    EXPECT_EQ(qpl_submit_batch(&batch), QPL_STS_SIZE_ERR);
+}
+
+}
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <random>
 
 #include "compression_huffman_table.hpp"
 #include "../../../common/operation_test.hpp"
@@ -150,6 +151,63 @@ protected:
         ASSERT_TRUE(CompareVectors(decompressed_source, source));
     }
 
+    // Builds the table from the statistics of the source, gathered in full or sampled, and compresses with it
+    void CompressStatisticsMode(qpl_compression_levels level, bool is_sampled) {
+        qpl_histogram       deflate_histogram{};
+        qpl_huffman_table_t huffman_table_ptr;
+
+        auto status = qpl_deflate_huffman_table_create(compression_table_type,
+                                                       GetExecutionPath(),
+                                                       DEFAULT_ALLOCATOR_C,
+                                                       &huffman_table_ptr);
+        ASSERT_EQ(status, QPL_STS_OK) << "Table creation failed";
+
+        if (is_sampled) {
+            status = qpl_gather_deflate_statistics_sampled(source.data(),
+                                                           static_cast<uint32_t>(source.size()),
+                                                           &deflate_histogram,
+                                                           1u,
+                                                           nullptr,
+                                                           level,
+                                                           GetExecutionPath());
+        } else {
+            status = qpl_gather_deflate_statistics(source.data(),
+                                                   static_cast<uint32_t>(source.size()),
+                                                   &deflate_histogram,
+                                                   level,
+                                                   GetExecutionPath());
+        }
+        ASSERT_EQ(status, QPL_STS_OK) << "Statistics gathering failed";
+
+        status = qpl_huffman_table_init_with_histogram(huffman_table_ptr, &deflate_histogram);
+        ASSERT_EQ(status, QPL_STS_OK) << "Table build failed";
+
+        std::fill(destination.begin(), destination.end(), 0u);
+
+        job_ptr->flags         = current_test_case.header | QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = level;
+        job_ptr->huffman_table = huffman_table_ptr;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+        status = run_job_api(job_ptr);
+        if (QPL_STS_OK != status) {
+            EXPECT_EQ(qpl_huffman_table_destroy(huffman_table_ptr), QPL_STS_OK);
+        }
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        std::vector<uint8_t> compressed(destination.begin(), destination.begin() + job_ptr->total_out);
+        std::vector<uint8_t> decompressed_source(source.size());
+
+        DecompressStream(compressed, decompressed_source);
+
+        EXPECT_EQ(qpl_huffman_table_destroy(huffman_table_ptr), QPL_STS_OK);
+        ASSERT_TRUE(CompareVectors(decompressed_source, source));
+    }
+
     void CompressFixedMode(qpl_compression_levels level, bool omit_verification = true) {
         job_ptr->huffman_table = nullptr;
         job_ptr->flags |= QPL_FLAG_FIRST | QPL_FLAG_LAST;
@@ -271,6 +329,47 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_default_level, Defla
     CompressFixedMode(qpl_default_level);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressDynamicMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, static_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressStaticMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressFixedMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_table_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressStatisticsMode(qpl_level_2, false);
+    CompressStatisticsMode(qpl_level_2, true);
+}
+
 QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index, dynamic_blocks_high_level, DeflateTest) {
     if (GetExecutionPath() == qpl_path_hardware) {
         GTEST_SKIP() << "Resource management mistake when HW test (replaced by test deflate_high.dynamic_verify";
@@ -498,4 +597,172 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_verify, static_high_level, Deflate
     qpl_fini_job(decompr_job);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_verify, sampled_multiple_jobs, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Sampled verification is supported on the software path only";
+        }
+        return;
+    }
+
+    constexpr uint32_t streams_count = 5u;
+    constexpr uint32_t jobs_count    = 3u;
+
+    uint32_t job_size = 0;
+    auto     path     = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    qpl_get_job_size(path, &job_size);
+
+    auto compression_job   = std::make_unique<uint8_t[]>(job_size);
+    auto decompression_job = std::make_unique<uint8_t[]>(job_size);
+
+    auto *compr_job   = reinterpret_cast<qpl_job *>(compression_job.get());
+    auto *decompr_job = reinterpret_cast<qpl_job *>(decompression_job.get());
+
+    qpl_init_job(path, compr_job);
+    qpl_init_job(path, decompr_job);
+
+    // Streams of several jobs check that the jobs of a stream take the same verification decision
+    compr_job->verify_interval = 2u;
+
+    for (auto &dataset: util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+        auto                  source = dataset.second;
+        std::vector<uint8_t>  destination(source.size() * 2u + 1024u, 0);
+        std::vector<uint8_t>  reference(source.size(), 0);
+        std::vector<uint64_t> indexes(source.size(), 0);
+
+        const auto chunk_size = static_cast<uint32_t>(source.size()) / jobs_count;
+
+        for (uint32_t stream = 0u; stream < streams_count; stream++) {
+            // Compress
+            compr_job->next_out_ptr    = destination.data();
+            compr_job->available_out   = static_cast<uint32_t>(destination.size());
+            compr_job->op              = qpl_op_compress;
+            compr_job->level           = qpl_default_level;
+            compr_job->mini_block_size = qpl_mblk_size_512;
+            compr_job->idx_array       = (uint64_t *) indexes.data();
+            compr_job->idx_max_size    = static_cast<uint32_t>(indexes.size());
+
+            for (uint32_t job = 0u; job < jobs_count; job++) {
+                const bool is_last_job = (job == jobs_count - 1u);
+
+                compr_job->next_in_ptr  = source.data() + job * chunk_size;
+                compr_job->available_in = (is_last_job) ?
+                                          static_cast<uint32_t>(source.size()) - job * chunk_size :
+                                          chunk_size;
+                compr_job->flags        = QPL_FLAG_DYNAMIC_HUFFMAN;
+                compr_job->flags       |= (0u == job) ? QPL_FLAG_FIRST : 0u;
+                compr_job->flags       |= (is_last_job) ? QPL_FLAG_LAST : 0u;
+
+                auto status = run_job_api(compr_job);
+                ASSERT_EQ(status, QPL_STS_OK);
+            }
+
+            // Decompress
+            decompr_job->next_in_ptr   = destination.data();
+            decompr_job->available_in  = compr_job->total_out;
+            decompr_job->next_out_ptr  = reference.data();
+            decompr_job->available_out = static_cast<uint32_t>(reference.size());
+            decompr_job->op            = qpl_op_decompress;
+            decompr_job->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+            auto status = run_job_api(decompr_job);
+            ASSERT_EQ(status, QPL_STS_OK);
+
+            // Check
+            ASSERT_TRUE(std::equal(source.begin(), source.end(), reference.begin()));
+        }
+    }
+
+    qpl_fini_job(compr_job);
+    qpl_fini_job(decompr_job);
+}
+
+class DeflateIncompressibleTest : public JobFixture {
+protected:
+    static constexpr uint32_t part_size = 64u * 1024u;
+
+    // Compressible text, random bytes standing for already compressed data, and compressible text again
+    void GenerateMixedSource() {
+        std::mt19937 random_engine(GetSeed());
+
+        const std::string text = "Intel(R) Query Processing Library (Intel(R) QPL) compresses this line. ";
+
+        source.resize(4u * part_size);
+
+        for (uint32_t i = 0u; i < source.size(); i++) {
+            source[i] = (i >= part_size && i < 3u * part_size) ?
+                        static_cast<uint8_t>(random_engine()) :
+                        static_cast<uint8_t>(text[i % text.size()]);
+        }
+    }
+
+    auto CompressAndCheck(qpl_compression_levels level, uint32_t threshold) -> uint32_t {
+        std::vector<uint8_t> compressed(source.size() * 2u + 1024u);
+        std::vector<uint8_t> decompressed(source.size());
+
+        job_ptr->op                       = qpl_op_compress;
+        job_ptr->level                    = level;
+        job_ptr->flags                    = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+        job_ptr->incompressible_threshold = threshold;
+        job_ptr->next_in_ptr              = source.data();
+        job_ptr->available_in             = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr             = compressed.data();
+        job_ptr->available_out            = static_cast<uint32_t>(compressed.size());
+
+        EXPECT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        const uint32_t compressed_size = job_ptr->total_out;
+        const uint32_t compress_crc    = job_ptr->crc;
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        EXPECT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+        EXPECT_EQ(job_ptr->crc, compress_crc);
+        EXPECT_TRUE(decompressed == source);
+
+        return compressed_size;
+    }
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_incompressible, mixed_source, DeflateIncompressibleTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Incompressible data probing is supported on the software path only";
+    }
+
+    GenerateMixedSource();
+
+    for (auto level : {qpl_default_level, qpl_high_level}) {
+        const uint32_t probed_size   = CompressAndCheck(level, 0u);
+        const uint32_t unprobed_size = CompressAndCheck(level, 101u);
+
+        // Random part is stored in both cases, the text parts are still compressed
+        EXPECT_LT(probed_size, 3u * part_size);
+        EXPECT_LE(probed_size, unprobed_size + unprobed_size / 100u);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_incompressible, random_source, DeflateIncompressibleTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Incompressible data probing is supported on the software path only";
+    }
+
+    std::mt19937 random_engine(GetSeed());
+
+    source.resize(4u * part_size + 123u);
+    std::generate(source.begin(), source.end(), [&random_engine]() {
+        return static_cast<uint8_t>(random_engine());
+    });
+
+    // Stored blocks of at most 64 KB, with 5 bytes of header each
+    const auto stored_size = static_cast<uint32_t>(source.size()) + 5u * (static_cast<uint32_t>(source.size()) / 0xFFFFu + 1u);
+
+    EXPECT_LE(CompressAndCheck(qpl_default_level, 0u), stored_size + 5u);
+}
+
 }
@@ -5,6 +5,7 @@
  ******************************************************************************/
 
 #include "algorithm"
+#include "random"
 #include "../../../common/operation_test.hpp"
 #include "ta_ll_common.hpp"
 #include "source_provider.hpp"
@@ -332,6 +333,151 @@ protected:
         }
     }
 
+    // Most of the source is made of a few literals with 1-3 bit codes, so the decoder takes several literals
+    // per lookup, while the literals met only once get codes longer than the lookup index
+    void RunHuffmanOnlyMultiSymbolTest(bool is_big_endian = false) {
+        constexpr uint32_t source_size = 64u * 1024u;
+
+        std::minstd_rand                        random_generator(GetSeed());
+        std::uniform_int_distribution<uint32_t> probability(0u, 99u);
+        std::uniform_int_distribution<uint32_t> rare_literal(4u, 127u);
+
+        source.resize(source_size);
+        for (auto &literal : source) {
+            const uint32_t value = probability(random_generator);
+
+            if (value < 60u) {
+                literal = 'a';
+            } else if (value < 80u) {
+                literal = 'b';
+            } else if (value < 90u) {
+                literal = 'c';
+            } else if (value < 95u) {
+                literal = 'd';
+            } else {
+                literal = static_cast<uint8_t>(rare_literal(random_generator));
+            }
+        }
+
+        for (uint32_t i = 128u; i < 256u; i++) {
+            source[(i * 509u) % source_size] = static_cast<uint8_t>(i);
+        }
+
+        destination.resize(source_size * 2);
+        std::fill(destination.begin(), destination.end(), 0u);
+        std::vector<uint8_t> reference_buffer(source_size, 0u);
+
+        qpl_huffman_table_t c_huffman_table;
+        auto status = qpl_huffman_only_table_create(compression_table_type,
+                                                    GetExecutionPath(),
+                                                    DEFAULT_ALLOCATOR_C,
+                                                    &c_huffman_table);
+        ASSERT_EQ(QPL_STS_OK, status) << "Table creation failed";
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_in  = source_size;
+        job_ptr->available_out = source_size * 2;
+        job_ptr->huffman_table = c_huffman_table;
+        job_ptr->flags         = QPL_FLAG_FIRST |
+                                 QPL_FLAG_LAST |
+                                 QPL_FLAG_NO_HDRS |
+                                 QPL_FLAG_GEN_LITERALS |
+                                 QPL_FLAG_DYNAMIC_HUFFMAN |
+                                 QPL_FLAG_OMIT_VERIFY |
+                                 ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+        // Compress
+        status = run_job_api(job_ptr);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        qpl_huffman_table_t d_huffman_table;
+        status = qpl_huffman_only_table_create(decompression_table_type,
+                                               GetExecutionPath(),
+                                               DEFAULT_ALLOCATOR_C,
+                                               &d_huffman_table);
+        ASSERT_EQ(QPL_STS_OK, status) << "Table creation failed";
+
+        status = qpl_huffman_table_init_with_other(d_huffman_table, c_huffman_table);
+        ASSERT_EQ(QPL_STS_OK, status) << "Decompression table creation failed";
+
+        decompression_job_ptr->op            = qpl_op_decompress;
+        decompression_job_ptr->next_in_ptr   = destination.data();
+        decompression_job_ptr->next_out_ptr  = reference_buffer.data();
+        decompression_job_ptr->available_in  = job_ptr->total_out;
+        decompression_job_ptr->available_out = source_size;
+        if (is_big_endian) {
+            decompression_job_ptr->ignore_end_bits = (16 - job_ptr->last_bit_offset) & 15;
+        } else {
+            decompression_job_ptr->ignore_end_bits = (8 - job_ptr->last_bit_offset) & 7;
+        }
+        decompression_job_ptr->huffman_table = d_huffman_table;
+        decompression_job_ptr->flags         = QPL_FLAG_NO_HDRS | QPL_FLAG_FIRST | QPL_FLAG_LAST |
+                                               ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+        // Decompress
+        status = run_job_api(decompression_job_ptr);
+
+        // IAA 1.0 limitation: cannot work if ignore_end_bits is greater than 7 bits for BE16 decompress
+        bool skip_verify = false;
+        if (is_big_endian && qpl_path_hardware == job_ptr->data_ptr.path && decompression_job_ptr->ignore_end_bits > 7) {
+            EXPECT_EQ(QPL_STS_HUFFMAN_BE_IGNORE_MORE_THAN_7_BITS_ERR, status);
+            skip_verify = true;
+        } else {
+            EXPECT_EQ(QPL_STS_OK, status);
+        }
+
+        // Free resources
+        EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(c_huffman_table)) << "Compression table destruction failed";
+        EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(d_huffman_table)) << "Decompression table destruction failed";
+
+        // Verify
+        if (!skip_verify) {
+            ASSERT_EQ(source_size, decompression_job_ptr->total_out);
+            ASSERT_TRUE(CompareVectors(source, reference_buffer, source_size));
+        }
+    }
+
+    // The table assigns 9 bit codes to all literals, so it covers a half of the code space only
+    // and a stream of set bits can't be decoded
+    void RunHuffmanOnlyCorruptCodeTest(bool is_big_endian = false) {
+        std::array<qpl_huffman_triplet, 256u> triplets{};
+        for (uint32_t i = 0u; i < triplets.size(); i++) {
+            triplets[i].value       = static_cast<uint8_t>(i);
+            triplets[i].code_length = 9u;
+            triplets[i].code        = static_cast<uint16_t>(i);
+        }
+
+        qpl_huffman_table_t d_huffman_table;
+        auto status = qpl_huffman_only_table_create(decompression_table_type,
+                                                    GetExecutionPath(),
+                                                    DEFAULT_ALLOCATOR_C,
+                                                    &d_huffman_table);
+        ASSERT_EQ(QPL_STS_OK, status) << "Table creation failed";
+
+        status = qpl_huffman_table_init_with_triplets(d_huffman_table, triplets.data(), triplets.size());
+        ASSERT_EQ(QPL_STS_OK, status) << "Decompression table creation failed";
+
+        source.assign(1024u, 0xFFu);
+        destination.resize(source.size() * 2);
+
+        decompression_job_ptr->op              = qpl_op_decompress;
+        decompression_job_ptr->next_in_ptr     = source.data();
+        decompression_job_ptr->available_in    = static_cast<uint32_t>(source.size());
+        decompression_job_ptr->next_out_ptr    = destination.data();
+        decompression_job_ptr->available_out   = static_cast<uint32_t>(destination.size());
+        decompression_job_ptr->ignore_end_bits = 0u;
+        decompression_job_ptr->huffman_table   = d_huffman_table;
+        decompression_job_ptr->flags           = QPL_FLAG_NO_HDRS | QPL_FLAG_FIRST | QPL_FLAG_LAST |
+                                                 ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+        status = run_job_api(decompression_job_ptr);
+        EXPECT_EQ(QPL_STS_BAD_LL_CODE_ERR, status);
+
+        EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(d_huffman_table)) << "Decompression table destruction failed";
+    }
+
     // Huffman only compression on SW path was inefficient due to incorrect huffman table construction
     // ISAL routine to compute histogram for HT construction did not do huffman only
     // Manually computing the histogram with a for loop and then constructing HT works properly
@@ -432,4 +578,28 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, dynamic_correct_single_value_
     RunHuffmanOnlyDynamicCorrectnessTest();
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, multi_symbol_decode_le, DeflateTestHuffmanOnly) {
+    RunHuffmanOnlyMultiSymbolTest();
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, multi_symbol_decode_be, DeflateTestHuffmanOnly) {
+    RunHuffmanOnlyMultiSymbolTest(true);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, corrupt_code_le, DeflateTestHuffmanOnly) {
+    if (qpl_path_software != GetExecutionPath()) {
+        GTEST_SKIP() << "Undecodable Huffman only code status is checked on the software path only";
+    }
+
+    RunHuffmanOnlyCorruptCodeTest();
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, corrupt_code_be, DeflateTestHuffmanOnly) {
+    if (qpl_path_software != GetExecutionPath()) {
+        GTEST_SKIP() << "Undecodable Huffman only code status is checked on the software path only";
+    }
+
+    RunHuffmanOnlyCorruptCodeTest(true);
+}
+
 }
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t statistics_window_size       = 16u * 1024u;
+constexpr uint32_t statistics_source_size       = 64u * statistics_window_size;
+constexpr uint32_t statistics_pattern_size      = 1024u;
+constexpr uint32_t statistics_sampling_interval = 4u;
+
+class DeflateStatisticsTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_gen(statistics_source_size, 8u, GetSeed());
+        random_source = source_gen.get_source();
+
+        // Repeat the pattern to make the data compressible
+        compressible_source.resize(statistics_source_size);
+
+        for (uint32_t i = 0u; i < statistics_source_size; i += statistics_pattern_size) {
+            std::copy(random_source.begin(), random_source.begin() + statistics_pattern_size, compressible_source.begin() + i);
+        }
+    }
+
+protected:
+    std::vector<uint8_t> random_source;
+    std::vector<uint8_t> compressible_source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_statistics_sampled, single_window, DeflateStatisticsTest) {
+    for (auto level : {qpl_default_level, qpl_high_level}) {
+        if (level == qpl_high_level && GetExecutionPath() == qpl_path_hardware) {
+            continue;
+        }
+
+        qpl_histogram reference_histogram{};
+        qpl_histogram histogram{};
+        uint32_t      estimated_size = 0u;
+
+        ASSERT_EQ(qpl_gather_deflate_statistics(compressible_source.data(),
+                                                statistics_window_size,
+                                                &reference_histogram,
+                                                level,
+                                                GetExecutionPath()), QPL_STS_OK);
+
+        // The source of one window is gathered completely
+        ASSERT_EQ(qpl_gather_deflate_statistics_sampled(compressible_source.data(),
+                                                        statistics_window_size,
+                                                        &histogram,
+                                                        statistics_sampling_interval,
+                                                        &estimated_size,
+                                                        level,
+                                                        GetExecutionPath()), QPL_STS_OK);
+
+        EXPECT_TRUE(std::equal(std::begin(histogram.literal_lengths),
+                               std::end(histogram.literal_lengths),
+                               std::begin(reference_histogram.literal_lengths)));
+        EXPECT_TRUE(std::equal(std::begin(histogram.distances),
+                               std::end(histogram.distances),
+                               std::begin(reference_histogram.distances)));
+        EXPECT_GT(estimated_size, 0u);
+        EXPECT_LT(estimated_size, statistics_window_size);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_statistics_sampled, estimated_size, DeflateStatisticsTest) {
+    qpl_histogram histogram{};
+    uint32_t      random_size       = 0u;
+    uint32_t      compressible_size = 0u;
+
+    ASSERT_EQ(qpl_gather_deflate_statistics_sampled(random_source.data(),
+                                                    statistics_source_size,
+                                                    &histogram,
+                                                    statistics_sampling_interval,
+                                                    &random_size,
+                                                    qpl_default_level,
+                                                    GetExecutionPath()), QPL_STS_OK);
+
+    ASSERT_EQ(qpl_gather_deflate_statistics_sampled(compressible_source.data(),
+                                                    statistics_source_size,
+                                                    &histogram,
+                                                    statistics_sampling_interval,
+                                                    &compressible_size,
+                                                    qpl_default_level,
+                                                    GetExecutionPath()), QPL_STS_OK);
+
+    // Random data can't be compressed, the repeated pattern is compressed well
+    EXPECT_GT(random_size, statistics_source_size - statistics_source_size / 16u);
+    EXPECT_LT(compressible_size, statistics_source_size / 8u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_statistics_sampled, build_table, DeflateStatisticsTest) {
+    qpl_histogram       histogram{};
+    qpl_huffman_table_t huffman_table = nullptr;
+
+    ASSERT_EQ(qpl_gather_deflate_statistics_sampled(compressible_source.data(),
+                                                    statistics_source_size,
+                                                    &histogram,
+                                                    statistics_sampling_interval,
+                                                    nullptr,
+                                                    qpl_default_level,
+                                                    GetExecutionPath()), QPL_STS_OK);
+
+    ASSERT_EQ(qpl_deflate_huffman_table_create(combined_table_type,
+                                               GetExecutionPath(),
+                                               DEFAULT_ALLOCATOR_C,
+                                               &huffman_table), QPL_STS_OK);
+    ASSERT_EQ(qpl_huffman_table_init_with_histogram(huffman_table, &histogram), QPL_STS_OK);
+
+    std::vector<uint8_t> destination(statistics_source_size * 2u);
+    std::vector<uint8_t> reference(statistics_source_size);
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->next_in_ptr   = compressible_source.data();
+    job_ptr->available_in  = statistics_source_size;
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+    job_ptr->huffman_table = huffman_table;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY;
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+    const uint32_t compressed_size = job_ptr->total_out;
+
+    ASSERT_EQ(qpl_init_job(GetExecutionPath(), job_ptr), QPL_STS_OK);
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->next_in_ptr   = destination.data();
+    job_ptr->available_in  = compressed_size;
+    job_ptr->next_out_ptr  = reference.data();
+    job_ptr->available_out = static_cast<uint32_t>(reference.size());
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+    EXPECT_TRUE(CompareVectors(reference, compressible_source));
+
+    ASSERT_EQ(qpl_huffman_table_destroy(huffman_table), QPL_STS_OK);
+}
+
+}
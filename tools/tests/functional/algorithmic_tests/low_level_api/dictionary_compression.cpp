@@ -38,6 +38,19 @@ auto get_dictionary_lengths() {
     return result;
 }
 
+/**
+ * @brief Dictionaries larger than 4k are supported by the software path only
+ */
+auto get_max_dictionary_length(const std::vector<uint8_t> &source, qpl_path_t decompression_execution_path) {
+    auto result = static_cast<uint32_t>(source.size());
+
+    if (decompression_execution_path == qpl_path_hardware) {
+        result = std::min(result, 4096u);
+    }
+
+    return result;
+}
+
 template <compression_mode mode>
 void compress_with_chunks(std::vector<uint8_t> &source,
                           std::vector<uint8_t> &destination,
@@ -446,7 +459,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_default_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -518,7 +531,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_default_stateful_compression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -593,7 +606,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_default_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -669,7 +682,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_default_stateful_compression_and_decompr
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -748,7 +761,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_high_stateless) {
                 compressed_destination.resize(source.size() * 2);
                 decompressed_destination.resize(source.size());
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -820,7 +833,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_high_stateful_compression) {
                 compressed_destination.resize(source.size() * 2);
                 decompressed_destination.resize(source.size());
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -894,7 +907,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_high_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -968,7 +981,7 @@ GTEST_TEST(ta_c_api_dictionary, dynamic_high_stateful_compression_and_decompress
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1045,7 +1058,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_default_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1116,7 +1129,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_default_stateful_compression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1190,7 +1203,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_default_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1264,7 +1277,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_default_stateful_compression_and_decompres
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1341,7 +1354,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_high_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1412,7 +1425,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_high_stateful_compression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1486,7 +1499,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_high_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1560,7 +1573,7 @@ GTEST_TEST(ta_c_api_dictionary, fixed_high_stateful_compression_and_decompressio
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1637,7 +1650,7 @@ GTEST_TEST(ta_c_api_dictionary, static_default_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1737,7 +1750,7 @@ GTEST_TEST(ta_c_api_dictionary, static_default_stateful_compression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1841,7 +1854,7 @@ GTEST_TEST(ta_c_api_dictionary, static_default_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -1945,7 +1958,7 @@ GTEST_TEST(ta_c_api_dictionary, static_default_stateful_compression_and_decompre
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2052,7 +2065,7 @@ GTEST_TEST(ta_c_api_dictionary, static_high_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2152,7 +2165,7 @@ GTEST_TEST(ta_c_api_dictionary, static_high_stateful_compression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2256,7 +2269,7 @@ GTEST_TEST(ta_c_api_dictionary, static_high_stateful_decompression) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2360,7 +2373,7 @@ GTEST_TEST(ta_c_api_dictionary, static_high_stateful_compression_and_decompressi
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2471,7 +2484,7 @@ GTEST_TEST(ta_c_api_dictionary, canned_default_stateless) {
                 decompressed_destination.resize(source.size());
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 auto dictionary_buffer_size = qpl_get_dictionary_size(sw_compr_level,
@@ -2588,7 +2601,7 @@ GTEST_TEST(ta_c_api_dictionary, canned_default_stateful) {
             for (auto dictionary_length: get_dictionary_lengths()) {
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 // Create and fill the compression table
@@ -2776,7 +2789,7 @@ GTEST_TEST(ta_c_api_dictionary, canned_high_stateless) {
             for (auto dictionary_length: get_dictionary_lengths()) {
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
 
                 std::vector<uint8_t> destination(source.size() * 2);
@@ -2944,7 +2957,7 @@ GTEST_TEST(ta_c_api_dictionary, canned_high_stateful) {
             for (auto dictionary_length: get_dictionary_lengths()) {
 
                 if (dictionary_length > 4096) {
-                    dictionary_length = static_cast<uint32_t>(source.size());
+                    dictionary_length = get_max_dictionary_length(source, decompression_execution_path);
                 }
                 // Create and fill the compression table
                 qpl_huffman_table_t c_huffman_table;
@@ -3093,4 +3106,138 @@ GTEST_TEST(ta_c_api_dictionary, canned_high_stateful) {
         }
     }
 }
+
+GTEST_TEST(ta_c_api_dictionary, prebuilt_hash_table) {
+    constexpr uint32_t dictionary_length = 32u * 1024u;
+    constexpr uint32_t record_size       = 1024u;
+
+    auto decompression_execution_path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    for (auto &dataset: util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+        if (dataset.second.size() < dictionary_length + record_size) {
+            continue;
+        }
+
+        // Small record compressed with the preceding 32k of the file as a dictionary
+        std::vector<uint8_t> record(dataset.second.begin() + dictionary_length,
+                                    dataset.second.begin() + dictionary_length + record_size);
+
+        // The dictionary without a hash table is hashed by the compression job
+        auto reference_dictionary_buffer = std::make_unique<uint8_t[]>(qpl_get_dictionary_size(sw_compression_level::SW_NONE,
+                                                                                                hw_compression_level::HW_NONE,
+                                                                                                dictionary_length));
+        auto reference_dictionary_ptr    = reinterpret_cast<qpl_dictionary *>(reference_dictionary_buffer.get());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_build_dictionary(reference_dictionary_ptr,
+                                                   sw_compression_level::SW_NONE,
+                                                   hw_compression_level::HW_NONE,
+                                                   dataset.second.data(),
+                                                   dictionary_length));
+
+        for (auto sw_compr_level: {sw_compression_level::LEVEL_0, sw_compression_level::LEVEL_1,
+                                   sw_compression_level::LEVEL_2, sw_compression_level::LEVEL_3}) {
+            auto dictionary_buffer = std::make_unique<uint8_t[]>(qpl_get_dictionary_size(sw_compr_level,
+                                                                                         hw_compression_level::HW_NONE,
+                                                                                         dictionary_length));
+            auto dictionary_ptr    = reinterpret_cast<qpl_dictionary *>(dictionary_buffer.get());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_build_dictionary(dictionary_ptr,
+                                                       sw_compr_level,
+                                                       hw_compression_level::HW_NONE,
+                                                       dataset.second.data(),
+                                                       dictionary_length));
+
+            for (auto is_dynamic: {false, true}) {
+                std::vector<uint8_t> compressed_destination(record_size * 2);
+                std::vector<uint8_t> reference_destination(record_size * 2);
+                std::vector<uint8_t> decompressed_destination(record_size);
+
+                if (is_dynamic) {
+                    compress_with_chunks<compression_mode::dynamic_compression>(record,
+                                                                                compressed_destination,
+                                                                                record_size,
+                                                                                dictionary_ptr,
+                                                                                nullptr,
+                                                                                qpl_compression_levels::qpl_default_level);
+                    compress_with_chunks<compression_mode::dynamic_compression>(record,
+                                                                                reference_destination,
+                                                                                record_size,
+                                                                                reference_dictionary_ptr,
+                                                                                nullptr,
+                                                                                qpl_compression_levels::qpl_default_level);
+                } else {
+                    compress_with_chunks<compression_mode::fixed_compression>(record,
+                                                                              compressed_destination,
+                                                                              record_size,
+                                                                              dictionary_ptr,
+                                                                              nullptr,
+                                                                              qpl_compression_levels::qpl_default_level);
+                    compress_with_chunks<compression_mode::fixed_compression>(record,
+                                                                              reference_destination,
+                                                                              record_size,
+                                                                              reference_dictionary_ptr,
+                                                                              nullptr,
+                                                                              qpl_compression_levels::qpl_default_level);
+                }
+
+                // Prebuilt hash table gives the same matches as hashing the dictionary by the job
+                ASSERT_TRUE(CompareVectors(compressed_destination, reference_destination));
+
+                if (decompression_execution_path == qpl_path_hardware) {
+                    continue;
+                }
+
+                decompress_with_chunks(compressed_destination,
+                                       decompressed_destination,
+                                       static_cast<uint32_t>(compressed_destination.size()),
+                                       dictionary_ptr);
+
+                ASSERT_TRUE(CompareVectors(decompressed_destination, record));
+            }
+        }
+    }
+}
+
+GTEST_TEST(ta_c_api_dictionary, large_dictionary_hardware_path) {
+    if (util::TestEnvironment::GetInstance().GetExecutionPath() != qpl_path_hardware) {
+        GTEST_SKIP_("Rejection of dictionaries larger than 4k is checked for the hardware path only");
+    }
+
+    constexpr uint32_t dictionary_length = 4097u;
+
+    std::vector<uint8_t> dictionary(dictionary_length, 0u);
+    std::vector<uint8_t> source(dictionary_length, 0u);
+    std::vector<uint8_t> destination(dictionary_length);
+
+    auto dictionary_buffer = std::make_unique<uint8_t[]>(qpl_get_dictionary_size(sw_compression_level::SW_NONE,
+                                                                                 hw_compression_level::HW_NONE,
+                                                                                 dictionary_length));
+    auto dictionary_ptr    = reinterpret_cast<qpl_dictionary *>(dictionary_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_build_dictionary(dictionary_ptr,
+                                               sw_compression_level::SW_NONE,
+                                               hw_compression_level::HW_NONE,
+                                               dictionary.data(),
+                                               dictionary_length));
+
+    uint32_t job_size = 0;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_hardware, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_hardware, job_ptr));
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+    job_ptr->dictionary    = dictionary_ptr;
+
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, qpl_submit_job(job_ptr));
+
+    qpl_fini_job(job_ptr);
+}
 }
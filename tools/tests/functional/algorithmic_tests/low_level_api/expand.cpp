@@ -62,6 +62,27 @@ namespace qpl::test
             }
         }
 
+        void RunWithPackedMask(std::vector<uint8_t> &packed_mask, uint32_t mask_flags)
+        {
+            job_ptr->available_src2 = static_cast<uint32_t>(packed_mask.size());
+            job_ptr->next_src2_ptr  = packed_mask.data();
+            job_ptr->flags         |= mask_flags;
+
+            auto status = run_job_api(job_ptr);
+
+            if (GetExecutionPath() == qpl_path_hardware) {
+                EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+                return;
+            }
+
+            auto reference_status = ref_expand(reference_job_ptr);
+
+            EXPECT_EQ(QPL_STS_OK, status);
+            EXPECT_EQ(QPL_STS_OK, reference_status);
+
+            EXPECT_TRUE(CompareVectors(destination, reference_destination));
+        }
+
         void SetUp() override
         {
             AnalyticFixture::SetUp();
@@ -103,4 +124,36 @@ namespace qpl::test
 
         EXPECT_TRUE(CompareVectors(destination, reference_destination));
     }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(expand, analytic_with_compressed_mask, ExpandTest)
+    {
+        std::vector<uint8_t> compressed_mask;
+        ASSERT_NO_THROW(compressed_mask = GetCompressedMask());
+
+        RunWithPackedMask(compressed_mask, QPL_FLAG_SRC2_DECOMPRESS_ENABLE);
+    }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(expand, analytic_with_prle_mask, ExpandTest)
+    {
+        if (current_test_case.flags & QPL_FLAG_SRC2_BE) {
+            GTEST_SKIP() << "Parquet RLE source-2 is always little-endian";
+        }
+
+        std::vector<uint8_t> prle_mask = GetPrleMask();
+
+        RunWithPackedMask(prle_mask, QPL_FLAG_SRC2_PRLE);
+    }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(expand, analytic_with_compressed_prle_mask, ExpandTest)
+    {
+        if (current_test_case.flags & QPL_FLAG_SRC2_BE) {
+            GTEST_SKIP() << "Parquet RLE source-2 is always little-endian";
+        }
+
+        std::vector<uint8_t> prle_mask = GetPrleMask();
+        std::vector<uint8_t> compressed_mask;
+        ASSERT_NO_THROW(compressed_mask = GetCompressedData(prle_mask));
+
+        RunWithPackedMask(compressed_mask, QPL_FLAG_SRC2_PRLE | QPL_FLAG_SRC2_DECOMPRESS_ENABLE);
+    }
 }
@@ -78,19 +78,29 @@ public:
                                                                        compression_algorithm_huffman_only};
         constexpr std::array<qpl_serialization_format_e, 2> s_types = {serialization_compact,
                                                                        serialization_raw};
+        constexpr std::array<serialization_flags_t, 2> s_flags = {0u,
+                                                                  QPL_SERIALIZATION_FLAG_IN_PLACE};
 
         for (auto &algorithm: algorithms) {
             for (auto &type_c: c_types) {
                 for (auto &type_d: d_types) {
                     for (auto &type_s: s_types) {
-                        huffman_table_test_case_t test_case{};
-
-                        test_case.algorithm      = algorithm;
-                        test_case.c_type         = type_c;
-                        test_case.d_type         = type_d;
-                        test_case.options.format = type_s; // no serialization flags are currently supported
-
-                        AddNewTestCase(test_case);
+                        for (auto &flags_s: s_flags) {
+                            // in-place layout is only available for raw format
+                            if (type_s == serialization_compact && flags_s != 0u) {
+                                continue;
+                            }
+
+                            huffman_table_test_case_t test_case{};
+
+                            test_case.algorithm      = algorithm;
+                            test_case.c_type         = type_c;
+                            test_case.d_type         = type_d;
+                            test_case.options.format = type_s;
+                            test_case.options.flags  = flags_s;
+
+                            AddNewTestCase(test_case);
+                        }
                     }
                 }
             }
@@ -123,10 +133,10 @@ protected:
     testing::AssertionResult run_init_tables();
 
     template <compression_algorithm_e algorithm>
-    testing::AssertionResult run_serialize_table(qpl_huffman_table_t &huffman_table, qpl_serialization_format_e format);
+    testing::AssertionResult run_serialize_table(qpl_huffman_table_t &huffman_table, serialization_options_t options);
 
     template <compression_algorithm_e algorithm>
-    testing::AssertionResult run_serialize_tables(qpl_serialization_format_e format);
+    testing::AssertionResult run_serialize_tables(serialization_options_t options);
 
     template <compression_algorithm_e algorithm>
     testing::AssertionResult run_init_table_with_triplets(qpl_huffman_table_t &huffman_table);
@@ -213,11 +223,10 @@ testing::AssertionResult HuffmanTableAlgorithmicTest::run_init_table(qpl_huffman
 
 template <compression_algorithm_e algorithm>
 testing::AssertionResult HuffmanTableAlgorithmicTest::run_serialize_table(qpl_huffman_table_t &huffman_table,
-                                                                          qpl_serialization_format_e format) {
-    auto status = QPL_STS_OK;
+                                                                          serialization_options_t options) {
+    constexpr size_t in_place_alignment = 64u;
 
-    serialization_options_t options;
-    options.format = format;
+    auto status = QPL_STS_OK;
 
     size_t serialized_size = 0;
 
@@ -227,50 +236,70 @@ testing::AssertionResult HuffmanTableAlgorithmicTest::run_serialize_table(qpl_hu
     if (status != QPL_STS_OK)
         return testing::AssertionFailure() << "Can't get serialized size. Status = " << status;
 
-    auto buffer = std::make_unique<uint8_t[]>(serialized_size + 1);
+    // stream serialized for in-place usage is required to be aligned
+    auto buffer = std::make_unique<uint8_t[]>(serialized_size + in_place_alignment + 1);
+
+    const size_t misalignment = reinterpret_cast<uintptr_t>(buffer.get()) % in_place_alignment;
+    uint8_t *const stream_ptr = buffer.get() + (in_place_alignment - misalignment) % in_place_alignment;
 
     uint8_t number_to_check = 42;
-    buffer.get()[serialized_size] = number_to_check;
+    stream_ptr[serialized_size] = number_to_check;
 
     status = qpl_huffman_table_serialize(huffman_table,
-                                         buffer.get(),
+                                         stream_ptr,
                                          serialized_size,
                                          options);
     if (status != QPL_STS_OK)
         return testing::AssertionFailure() << "Can't serialize table. Status = " << status;
 
     // performing simple check that we don't overwrite buffer
-    if (buffer.get()[serialized_size] != number_to_check) {
+    if (stream_ptr[serialized_size] != number_to_check) {
         return testing::AssertionFailure() << "Buffer was overwritten during serialization.";
     }
 
     qpl_huffman_table_t other_huffman_table;
 
-    status = qpl_huffman_table_deserialize(buffer.get(),
+    status = qpl_huffman_table_deserialize(stream_ptr,
                                            serialized_size,
                                            DEFAULT_ALLOCATOR_C,
                                            &other_huffman_table);
     if (status != QPL_STS_OK)
         return testing::AssertionFailure() << "Can't deserialize table. Status = " << status;
 
-    bool are_tables_equal = false;
+    auto compare_and_destroy = [&huffman_table](qpl_huffman_table_t deserialized_table) -> testing::AssertionResult {
+        bool are_tables_equal = false;
 
-    status = qpl_huffman_table_compare(huffman_table, other_huffman_table, &are_tables_equal);
-    if (status != QPL_STS_OK) {
-        qpl_huffman_table_destroy(other_huffman_table);
+        auto compare_status = qpl_huffman_table_compare(huffman_table, deserialized_table, &are_tables_equal);
+        if (compare_status != QPL_STS_OK) {
+            qpl_huffman_table_destroy(deserialized_table);
 
-        return testing::AssertionFailure() << "Error during Huffman tables comparison. Status = " << status;
-    }
+            return testing::AssertionFailure() << "Error during Huffman tables comparison. Status = " << compare_status;
+        }
 
-    status = qpl_huffman_table_destroy(other_huffman_table);
-    if (status != QPL_STS_OK) {
-        return testing::AssertionFailure() << "Can't destroy table. Status = " << status;
-    }
+        compare_status = qpl_huffman_table_destroy(deserialized_table);
+        if (compare_status != QPL_STS_OK) {
+            return testing::AssertionFailure() << "Can't destroy table. Status = " << compare_status;
+        }
 
-    if (!are_tables_equal)
-        return testing::AssertionFailure() << "Tables are not equal. Status = " << status;
+        if (!are_tables_equal)
+            return testing::AssertionFailure() << "Tables are not equal.";
 
-    return testing::AssertionSuccess();
+        return testing::AssertionSuccess();
+    };
+
+    auto result = compare_and_destroy(other_huffman_table);
+    if (!result || !(options.flags & QPL_SERIALIZATION_FLAG_IN_PLACE))
+        return result;
+
+    // the same stream is used by the table directly, without copying
+    status = qpl_huffman_table_deserialize_in_place(stream_ptr,
+                                                    serialized_size,
+                                                    DEFAULT_ALLOCATOR_C,
+                                                    &other_huffman_table);
+    if (status != QPL_STS_OK)
+        return testing::AssertionFailure() << "Can't deserialize table in place. Status = " << status;
+
+    return compare_and_destroy(other_huffman_table);
 }
 
 template <compression_algorithm_e algorithm>
@@ -287,12 +316,12 @@ testing::AssertionResult HuffmanTableAlgorithmicTest::run_init_tables() {
 }
 
 template <compression_algorithm_e algorithm>
-testing::AssertionResult HuffmanTableAlgorithmicTest::run_serialize_tables(qpl_serialization_format_e format) {
-    if (run_serialize_table<algorithm>(m_c_huffman_table, format) != testing::AssertionSuccess()) {
+testing::AssertionResult HuffmanTableAlgorithmicTest::run_serialize_tables(serialization_options_t options) {
+    if (run_serialize_table<algorithm>(m_c_huffman_table, options) != testing::AssertionSuccess()) {
         return testing::AssertionFailure() << "Can't serialize Compression table";
     }
 
-    if (run_serialize_table<algorithm>(m_d_huffman_table, format) != testing::AssertionSuccess()) {
+    if (run_serialize_table<algorithm>(m_d_huffman_table, options) != testing::AssertionSuccess()) {
         return testing::AssertionFailure() << "Can't serialize Decompression table";
     }
 
@@ -428,14 +457,11 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_histogram, Huffma
                  test_case.algorithm == compression_algorithm_huffman_only,
                  "initialization from histogram is not supported for combined table type currently with huffman only");
 
-    SKIP_TC_TEST((test_case.options.format != serialization_raw),
-                 "serialization only supports raw format");
-
     switch (test_case.algorithm) {
         case compression_algorithm_deflate:
             ASSERT_TRUE(run_create_tables<compression_algorithm_deflate>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_tables<compression_algorithm_deflate>());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_deflate>());
             ASSERT_TRUE(run_decompression<compression_algorithm_deflate>());
             break;
@@ -448,7 +474,7 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_histogram, Huffma
         case compression_algorithm_canned:
             ASSERT_TRUE(run_create_tables<compression_algorithm_canned>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_tables<compression_algorithm_canned>());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_canned>());
             ASSERT_TRUE(run_decompression<compression_algorithm_canned>());
             break;
@@ -475,14 +501,11 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, DISABLED_init_with_triplet,
     SKIP_TC_TEST(test_case.algorithm == compression_algorithm_canned,
                  "initialization with triplets is not supported for canned mode");
 
-    SKIP_TC_TEST((test_case.options.format != serialization_raw),
-                 "serialization only supports raw format");
-
     switch (test_case.algorithm) {
         case compression_algorithm_deflate:
             ASSERT_TRUE(run_create_tables<compression_algorithm_deflate>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_tables_with_triplets<compression_algorithm_deflate>());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_deflate>());
             ASSERT_TRUE(run_decompression<compression_algorithm_deflate>());
             break;
@@ -495,7 +518,7 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, DISABLED_init_with_triplet,
         case compression_algorithm_canned:
             ASSERT_TRUE(run_create_tables<compression_algorithm_canned>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_tables_with_triplets<compression_algorithm_canned>());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_canned>());
             ASSERT_TRUE(run_decompression<compression_algorithm_canned>());
             break;
@@ -525,15 +548,12 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_other, HuffmanTab
     SKIP_TC_TEST(test_case.d_type == combined_table_type,
                  "initialization of combined table type from other table is not supported currently");
 
-    SKIP_TC_TEST((test_case.options.format != serialization_raw),
-                 "serialization only supports raw format");
-
     switch (test_case.algorithm) {
         case compression_algorithm_deflate:
             ASSERT_TRUE(run_create_tables<compression_algorithm_deflate>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_table<compression_algorithm_deflate>(m_c_huffman_table));
             ASSERT_TRUE(run_init_d_table_with_c_table());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_deflate>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_deflate>());
             ASSERT_TRUE(run_decompression<compression_algorithm_deflate>());
             break;
@@ -548,7 +568,7 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_other, HuffmanTab
             ASSERT_TRUE(run_create_tables<compression_algorithm_canned>(test_case.c_type, test_case.d_type));
             ASSERT_TRUE(run_init_table<compression_algorithm_canned>(m_c_huffman_table));
             ASSERT_TRUE(run_init_d_table_with_c_table());
-            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options.format));
+            ASSERT_TRUE(run_serialize_tables<compression_algorithm_canned>(test_case.options));
             ASSERT_TRUE(run_compression<compression_algorithm_canned>());
             ASSERT_TRUE(run_decompression<compression_algorithm_canned>());
             break;
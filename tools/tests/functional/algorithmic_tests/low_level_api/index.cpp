@@ -193,6 +193,60 @@ public:
         return testing::AssertionSuccess();
     }
 
+    void CompressSource(std::vector<uint8_t> &source) {
+        uint32_t input_size   = static_cast<uint32_t>(source.size());
+        uint32_t bytes_remain = input_size;
+        uint32_t chunk_size   = 0;
+
+        job_ptr->next_in_ptr = source.data();
+        job_ptr->available_in = input_size;
+
+        job_ptr->level = qpl_default_level;
+        job_ptr->flags = QPL_FLAG_FIRST;
+
+        while (bytes_remain > 0) {
+            switch (current_test_case.compression_mode) {
+                case SINGLE_BUF_FIXED:
+                    chunk_size = bytes_remain;
+                    break;
+
+                case SINGLE_BUF_DYNAMIC:
+                    job_ptr->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
+                    chunk_size = bytes_remain;
+                    break;
+
+                case MULT_BUF_FIXED:
+                    chunk_size = current_test_case.chunk_size;
+                    job_ptr->flags |= QPL_FLAG_START_NEW_BLOCK;
+                    break;
+
+                case MULT_BUF_DYNAMIC:
+                    chunk_size = current_test_case.chunk_size;
+                    job_ptr->flags |= QPL_FLAG_START_NEW_BLOCK;
+                    job_ptr->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
+                    break;
+            }
+
+            if (current_test_case.gzip_mode == 1) {
+                job_ptr->flags |= QPL_FLAG_GZIP_MODE;
+            }
+
+            if (chunk_size >= bytes_remain) {
+                chunk_size = bytes_remain;
+                job_ptr->flags |= QPL_FLAG_LAST;
+            }
+
+            job_ptr->available_in = chunk_size;
+
+            auto result = run_job_api(job_ptr);
+
+            ASSERT_EQ(QPL_STS_OK, result);
+
+            bytes_remain -= chunk_size;
+            job_ptr->flags &= ~QPL_FLAG_FIRST;
+        }
+    }
+
     std::vector<uint64_t> index_array;
     std::vector<uint64_t> crc_array;
     IndexTestCase         current_test_case;
@@ -283,57 +337,9 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index_extended, PerformOperation,
     std::vector<uint8_t> source  = dataset[current_test_case.file_name];
     uint32_t             input_size  = static_cast<uint32_t>(source.size());
 
-    uint32_t bytes_remain          = input_size;
-    uint32_t chunk_size            = 0;
-    uint32_t mini_block_size_bytes = (1u << (job_ptr->mini_block_size + 8u));
-
-    job_ptr->next_in_ptr = source.data();
-    job_ptr->available_in = input_size;
-
-    job_ptr->level = qpl_default_level;
-    job_ptr->flags = QPL_FLAG_FIRST;
-
-    while (bytes_remain > 0) {
-        switch (current_test_case.compression_mode) {
-            case SINGLE_BUF_FIXED:
-                chunk_size = bytes_remain;
-                break;
-
-            case SINGLE_BUF_DYNAMIC:
-                job_ptr->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
-                chunk_size = bytes_remain;
-                break;
-
-            case MULT_BUF_FIXED:
-                chunk_size = current_test_case.chunk_size;
-                job_ptr->flags |= QPL_FLAG_START_NEW_BLOCK;
-                break;
-
-            case MULT_BUF_DYNAMIC:
-                chunk_size = current_test_case.chunk_size;
-                job_ptr->flags |= QPL_FLAG_START_NEW_BLOCK;
-                job_ptr->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
-                break;
-        }
-
-        if (current_test_case.gzip_mode == 1) {
-            job_ptr->flags |= QPL_FLAG_GZIP_MODE;
-        }
-
-        if (chunk_size >= bytes_remain) {
-            chunk_size = bytes_remain;
-            job_ptr->flags |= QPL_FLAG_LAST;
-        }
-
-        job_ptr->available_in = chunk_size;
-
-        auto result = run_job_api(job_ptr);
+    ASSERT_NO_FATAL_FAILURE(CompressSource(source));
 
-        ASSERT_EQ(QPL_STS_OK, result);
-
-        bytes_remain -= chunk_size;
-        job_ptr->flags &= ~QPL_FLAG_FIRST;
-    }
+    uint32_t mini_block_size_bytes = (1u << (job_ptr->mini_block_size + 8u));
 
     auto     source_it = source.begin();
     uint32_t crc_value = 0;
@@ -389,4 +395,44 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index_extended, PerformOperation,
         ASSERT_TRUE(GetMiniblock(next_mini_block, mini_blocks_per_block, restored_mini_block));
     }
 }
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index_extended, ParallelDecompression, IndexTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "Parallel decompression is supported on the software path only";
+    }
+
+    auto dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    std::vector<uint8_t> source     = dataset[current_test_case.file_name];
+    uint32_t             input_size = static_cast<uint32_t>(source.size());
+
+    ASSERT_NO_FATAL_FAILURE(CompressSource(source));
+
+    uint32_t mini_block_size_bytes = (1u << (job_ptr->mini_block_size + 8u));
+    uint32_t block_size            = (current_test_case.chunk_size == 0) ? input_size
+                                                                         : current_test_case.chunk_size;
+
+    qpl_index_table index_table;
+    index_table.mini_block_count      = (input_size + mini_block_size_bytes - 1) / mini_block_size_bytes;
+    index_table.mini_blocks_per_block = (SINGLE_BLOCK == current_test_case.block_usage)
+                                        ? index_table.mini_block_count
+                                        : block_size / mini_block_size_bytes;
+    index_table.block_count           = (index_table.mini_block_count + index_table.mini_blocks_per_block - 1)
+                                        / index_table.mini_blocks_per_block;
+    index_table.indices_ptr           = reinterpret_cast<qpl_index *>(index_array.data());
+
+    std::vector<uint8_t> decompressed(input_size);
+    uint32_t             output_size = 0;
+
+    ASSERT_EQ(QPL_STS_OK, qpl_decompress_mini_blocks_parallel(&index_table,
+                                                              job_ptr->mini_block_size,
+                                                              destination.data(),
+                                                              job_ptr->total_out,
+                                                              decompressed.data(),
+                                                              static_cast<uint32_t>(decompressed.size()),
+                                                              4u,
+                                                              &output_size));
+
+    ASSERT_EQ(output_size, input_size);
+    ASSERT_TRUE(CompareVectors(decompressed, source));
+}
 }
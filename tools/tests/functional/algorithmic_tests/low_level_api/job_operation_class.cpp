@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t class_source_size = 4096u;
+
+class JobOperationClassTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_gen(class_source_size, 8u, GetSeed());
+        source = source_gen.get_source();
+    }
+
+    void TearDown() override {
+        for (auto &buffer : job_buffers) {
+            qpl_fini_job(reinterpret_cast<qpl_job *>(buffer.get()));
+        }
+
+        JobFixture::TearDown();
+    }
+
+protected:
+    qpl_job *CreateJob(qpl_operation_class op_class) {
+        uint32_t job_size = 0u;
+
+        EXPECT_EQ(qpl_get_job_size_for_class(GetExecutionPath(), op_class, &job_size), QPL_STS_OK);
+
+        job_buffers.emplace_back(std::make_unique<uint8_t[]>(job_size));
+        auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffers.back().get());
+
+        EXPECT_EQ(qpl_init_job_for_class(GetExecutionPath(), op_class, job_ptr), QPL_STS_OK);
+
+        return job_ptr;
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers;
+    std::vector<uint8_t>                    source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_operation_class, size, JobOperationClassTest) {
+    uint32_t all_size       = 0u;
+    uint32_t analytics_size = 0u;
+    uint32_t inflate_size   = 0u;
+    uint32_t crc64_size     = 0u;
+
+    ASSERT_EQ(qpl_get_job_size(GetExecutionPath(), &all_size), QPL_STS_OK);
+    ASSERT_EQ(qpl_get_job_size_for_class(GetExecutionPath(), qpl_op_class_analytics, &analytics_size), QPL_STS_OK);
+    ASSERT_EQ(qpl_get_job_size_for_class(GetExecutionPath(), qpl_op_class_inflate, &inflate_size), QPL_STS_OK);
+    ASSERT_EQ(qpl_get_job_size_for_class(GetExecutionPath(), qpl_op_class_crc64, &crc64_size), QPL_STS_OK);
+
+    EXPECT_LE(analytics_size, all_size);
+    EXPECT_LT(inflate_size, all_size);
+    EXPECT_LT(crc64_size, inflate_size);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_operation_class, crc64, JobOperationClassTest) {
+    qpl_job *reference_job_ptr = CreateJob(qpl_op_class_all);
+    qpl_job *job_ptr           = CreateJob(qpl_op_class_crc64);
+
+    for (auto *current_job_ptr : {reference_job_ptr, job_ptr}) {
+        current_job_ptr->op           = qpl_op_crc64;
+        current_job_ptr->crc64_poly   = 0x04C11DB700000000;
+        current_job_ptr->next_in_ptr  = source.data();
+        current_job_ptr->available_in = class_source_size;
+
+        ASSERT_EQ(run_job_api(current_job_ptr), QPL_STS_OK);
+    }
+
+    EXPECT_EQ(job_ptr->crc64, reference_job_ptr->crc64);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_operation_class, reject_other_class, JobOperationClassTest) {
+    std::vector<uint8_t> destination(class_source_size * 2u);
+
+    qpl_job *job_ptr = CreateJob(qpl_op_class_analytics);
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = class_source_size;
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    EXPECT_EQ(qpl_submit_job(job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+    EXPECT_EQ(qpl_execute_job(job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+}
+
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t pool_jobs_count = 4u;
+constexpr uint32_t pool_page_size  = 4096u;
+
+class JobPoolTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_gen(pool_page_size, 8u, GetSeed());
+        source = source_gen.get_source();
+
+        compressed.resize(pool_page_size * 2u);
+        decompressed.resize(pool_page_size);
+    }
+
+    void TearDown() override {
+        if (pool) {
+            EXPECT_EQ(qpl_job_pool_destroy(pool), QPL_STS_OK);
+        }
+
+        JobFixture::TearDown();
+    }
+
+protected:
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> decompressed;
+    qpl_job_pool_t       pool = nullptr;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_pool, acquire_release, JobPoolTest) {
+    ASSERT_EQ(qpl_job_pool_create(GetExecutionPath(), qpl_op_class_analytics, pool_jobs_count, {nullptr, nullptr}, &pool),
+              QPL_STS_OK);
+
+    std::vector<qpl_job *> jobs(pool_jobs_count, nullptr);
+
+    for (auto &job : jobs) {
+        ASSERT_EQ(qpl_job_pool_acquire(pool, &job), QPL_STS_OK);
+    }
+
+    qpl_job *extra_job = nullptr;
+    EXPECT_EQ(qpl_job_pool_acquire(pool, &extra_job), QPL_STS_JOB_POOL_EXHAUSTED_ERR);
+
+    ASSERT_EQ(qpl_job_pool_release(pool, jobs[0]), QPL_STS_OK);
+    EXPECT_EQ(qpl_job_pool_release(pool, jobs[0]), QPL_STS_INVALID_PARAM_ERR);
+
+    ASSERT_EQ(qpl_job_pool_acquire(pool, &extra_job), QPL_STS_OK);
+    EXPECT_EQ(extra_job, jobs[0]);
+
+    for (auto &job : jobs) {
+        ASSERT_EQ(qpl_job_pool_release(pool, job), QPL_STS_OK);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_pool, compress_decompress_reuse, JobPoolTest) {
+    ASSERT_EQ(qpl_job_pool_create(GetExecutionPath(), qpl_op_class_all, 1u, {nullptr, nullptr}, &pool), QPL_STS_OK);
+
+    // The same job of the pool is used for both operations to check that it's reset between them
+    qpl_job *job_ptr = nullptr;
+    ASSERT_EQ(qpl_job_pool_acquire(pool, &job_ptr), QPL_STS_OK);
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY | QPL_FLAG_DYNAMIC_HUFFMAN;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = pool_page_size;
+    job_ptr->next_out_ptr  = compressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+    const uint32_t compressed_size = job_ptr->total_out;
+
+    ASSERT_EQ(qpl_job_pool_release(pool, job_ptr), QPL_STS_OK);
+    ASSERT_EQ(qpl_job_pool_acquire(pool, &job_ptr), QPL_STS_OK);
+
+    EXPECT_EQ(job_ptr->total_in, 0u);
+    EXPECT_EQ(job_ptr->total_out, 0u);
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    job_ptr->next_in_ptr   = compressed.data();
+    job_ptr->available_in  = compressed_size;
+    job_ptr->next_out_ptr  = decompressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+    ASSERT_EQ(job_ptr->total_out, pool_page_size);
+    ASSERT_TRUE(CompareVectors(decompressed, source));
+
+    ASSERT_EQ(qpl_job_pool_release(pool, job_ptr), QPL_STS_OK);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_pool, crc64_class, JobPoolTest) {
+    ASSERT_EQ(qpl_job_pool_create(GetExecutionPath(), qpl_op_class_crc64, 1u, {nullptr, nullptr}, &pool), QPL_STS_OK);
+
+    qpl_job *job_ptr = nullptr;
+    ASSERT_EQ(qpl_job_pool_acquire(pool, &job_ptr), QPL_STS_OK);
+
+    job_ptr->op           = qpl_op_crc64;
+    job_ptr->crc64_poly   = 0x04C11DB700000000;
+    job_ptr->next_in_ptr  = source.data();
+    job_ptr->available_in = pool_page_size;
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+    EXPECT_NE(job_ptr->crc64, 0u);
+
+    ASSERT_EQ(qpl_job_pool_release(pool, job_ptr), QPL_STS_OK);
+}
+
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "compression_huffman_table.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t parallel_threads_count = 4u;
+constexpr uint32_t parallel_source_size   = 1024u * 1024u + 12345u;
+
+class ParallelDeflateTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        // Whole dataset is repeated to get a source that consists of several segments
+        // and contains matches crossing segment boundaries
+        for (auto &dataset: util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+            source.insert(source.end(), dataset.second.begin(), dataset.second.end());
+        }
+
+        if (source.empty()) {
+            source_provider source_gen(parallel_source_size, 8u, GetSeed());
+            source = source_gen.get_source();
+        }
+
+        while (source.size() < parallel_source_size) {
+            source.insert(source.end(), source.begin(), source.begin() + (parallel_source_size - source.size()));
+        }
+    }
+
+    void RunTest(uint32_t flags, qpl_compression_levels level, qpl_huffman_table_t huffman_table = nullptr) {
+        if (GetExecutionPath() != qpl_path_software) {
+            GTEST_SKIP() << "Parallel compression is supported on the software path only";
+        }
+
+        std::vector<uint8_t> parallel_destination(source.size() * 2u);
+        std::vector<uint8_t> reference_destination(source.size() * 2u);
+        std::vector<uint8_t> decompressed(source.size());
+
+        // Reference
+        ASSERT_EQ(Compress(reference_destination, flags, level, huffman_table, 1u), QPL_STS_OK);
+
+        const uint32_t reference_size = job_ptr->total_out;
+        const uint32_t reference_crc  = job_ptr->crc;
+
+        // Parallel
+        ASSERT_EQ(qpl_init_job(GetExecutionPath(), job_ptr), QPL_STS_OK);
+        ASSERT_EQ(Compress(parallel_destination, flags, level, huffman_table, parallel_threads_count), QPL_STS_OK);
+
+        const uint32_t parallel_size = job_ptr->total_out;
+
+        EXPECT_EQ(job_ptr->total_in, source.size());
+        EXPECT_EQ(job_ptr->crc, reference_crc);
+
+        if (flags & (QPL_FLAG_GZIP_MODE | QPL_FLAG_ZLIB_MODE)) {
+            const uint32_t trailer_size = (flags & QPL_FLAG_GZIP_MODE) ? 8u : 4u;
+
+            ASSERT_TRUE(CompareSegments(parallel_destination.begin() + parallel_size - trailer_size,
+                                        parallel_destination.begin() + parallel_size,
+                                        reference_destination.begin() + reference_size - trailer_size,
+                                        reference_destination.begin() + reference_size,
+                                        "Trailer mismatch"));
+        }
+
+        // Decompression
+        const uint32_t header_size = (flags & QPL_FLAG_ZLIB_MODE) ? 2u : 0u;
+        const uint32_t footer_size = (flags & QPL_FLAG_ZLIB_MODE) ? 4u : 0u;
+
+        ASSERT_EQ(qpl_init_job(GetExecutionPath(), job_ptr), QPL_STS_OK);
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->next_in_ptr   = parallel_destination.data() + header_size;
+        job_ptr->available_in  = parallel_size - header_size - footer_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | (flags & QPL_FLAG_GZIP_MODE);
+
+        ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+        ASSERT_EQ(job_ptr->total_out, source.size());
+        EXPECT_EQ(job_ptr->crc, reference_crc);
+
+        ASSERT_TRUE(CompareVectors(decompressed, source));
+    }
+
+protected:
+    auto Compress(std::vector<uint8_t> &destination,
+                  uint32_t flags,
+                  qpl_compression_levels level,
+                  qpl_huffman_table_t huffman_table,
+                  uint32_t threads_count) -> qpl_status {
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | flags;
+        job_ptr->level         = level;
+        job_ptr->huffman_table = huffman_table;
+
+        return qpl_execute_job_parallel(job_ptr, threads_count);
+    }
+
+    std::vector<uint8_t> source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, fixed_default, ParallelDeflateTest) {
+    RunTest(0u, qpl_default_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, dynamic_default, ParallelDeflateTest) {
+    RunTest(QPL_FLAG_DYNAMIC_HUFFMAN, qpl_default_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, dynamic_high, ParallelDeflateTest) {
+    RunTest(QPL_FLAG_DYNAMIC_HUFFMAN, qpl_high_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, dynamic_gzip, ParallelDeflateTest) {
+    RunTest(QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_GZIP_MODE, qpl_default_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, dynamic_zlib, ParallelDeflateTest) {
+    RunTest(QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_ZLIB_MODE, qpl_default_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, fixed_omit_verify, ParallelDeflateTest) {
+    RunTest(QPL_FLAG_OMIT_VERIFY, qpl_default_level);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, static_default, ParallelDeflateTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "Parallel compression is supported on the software path only";
+    }
+
+    qpl_huffman_table_t c_huffman_table = nullptr;
+
+    ASSERT_EQ(qpl_deflate_huffman_table_create(compression_table_type,
+                                               GetExecutionPath(),
+                                               DEFAULT_ALLOCATOR_C,
+                                               &c_huffman_table), QPL_STS_OK);
+
+    qpl_histogram histogram{};
+
+    ASSERT_EQ(qpl_gather_deflate_statistics(source.data(),
+                                            static_cast<uint32_t>(source.size()),
+                                            &histogram,
+                                            qpl_default_level,
+                                            GetExecutionPath()), QPL_STS_OK);
+
+    ASSERT_EQ(qpl_huffman_table_init_with_histogram(c_huffman_table, &histogram), QPL_STS_OK);
+
+    RunTest(0u, qpl_default_level, c_huffman_table);
+
+    EXPECT_EQ(qpl_huffman_table_destroy(c_huffman_table), QPL_STS_OK);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_parallel, short_destination, ParallelDeflateTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "Parallel compression is supported on the software path only";
+    }
+
+    // Errors of the parallel compression are reported as is instead of falling back to the serial one
+    std::vector<uint8_t> destination(1024u);
+
+    EXPECT_EQ(Compress(destination, QPL_FLAG_DYNAMIC_HUFFMAN, qpl_default_level, nullptr, parallel_threads_count),
+              QPL_STS_MORE_OUTPUT_NEEDED);
+}
+
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t members_threads_count = 4u;
+constexpr uint32_t members_source_size   = 256u * 1024u + 123u;
+constexpr uint32_t member_size           = 16u * 1024u;
+constexpr uint32_t gzip_header_size      = 10u;
+constexpr uint32_t gzip_trailer_size     = 8u;
+constexpr uint32_t bgzf_extra_size       = 8u;
+
+class ParallelGzipInflateTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_gen(members_source_size, 8u, GetSeed());
+        source = source_gen.get_source();
+
+        // Repeat the first part to make the data compressible
+        std::copy(source.begin(), source.begin() + members_source_size / 2u, source.begin() + members_source_size / 2u);
+    }
+
+    void RunTest(const std::vector<uint8_t> &stream, qpl_status expected_status = QPL_STS_OK) {
+        if (GetExecutionPath() != qpl_path_software) {
+            GTEST_SKIP() << "Parallel decompression is supported on the software path only";
+        }
+
+        std::vector<uint8_t> destination(source.size());
+
+        ASSERT_EQ(qpl_init_job(GetExecutionPath(), job_ptr), QPL_STS_OK);
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->next_in_ptr   = const_cast<uint8_t *>(stream.data());
+        job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE;
+
+        ASSERT_EQ(qpl_execute_job_parallel(job_ptr, members_threads_count), expected_status);
+
+        if (QPL_STS_OK == expected_status) {
+            ASSERT_EQ(job_ptr->total_out, source.size());
+            EXPECT_EQ(job_ptr->crc, Crc32(source.data(), static_cast<uint32_t>(source.size())));
+
+            ASSERT_TRUE(CompareVectors(destination, source));
+        }
+    }
+
+protected:
+    /**
+     * @brief Compresses every `member_size` bytes of the source into a separate gzip member
+     */
+    auto CompressMembers(bool is_bgzf) -> std::vector<uint8_t> {
+        std::vector<uint8_t> stream;
+        std::vector<uint8_t> member(member_size * 2u);
+
+        for (uint32_t offset = 0u; offset < source.size(); offset += member_size) {
+            const auto size = std::min(member_size, static_cast<uint32_t>(source.size()) - offset);
+
+            EXPECT_EQ(qpl_init_job(GetExecutionPath(), job_ptr), QPL_STS_OK);
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->level         = qpl_default_level;
+            job_ptr->next_in_ptr   = source.data() + offset;
+            job_ptr->available_in  = size;
+            job_ptr->next_out_ptr  = member.data();
+            job_ptr->available_out = static_cast<uint32_t>(member.size());
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_GZIP_MODE;
+
+            EXPECT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+            const uint32_t member_begin = static_cast<uint32_t>(stream.size());
+
+            stream.insert(stream.end(), member.begin(), member.begin() + job_ptr->total_out);
+
+            if (is_bgzf) {
+                // Insert the extra field with the `BC` subfield storing the member size minus one
+                const uint32_t block_size = job_ptr->total_out + bgzf_extra_size - 1u;
+                const uint8_t  extra[]    = {6u, 0u, 'B', 'C', 2u, 0u,
+                                             static_cast<uint8_t>(block_size),
+                                             static_cast<uint8_t>(block_size >> 8u)};
+
+                stream[member_begin + 3u] |= 4u;
+                stream.insert(stream.begin() + member_begin + gzip_header_size, std::begin(extra), std::end(extra));
+            }
+        }
+
+        return stream;
+    }
+
+    /**
+     * @brief Writes a gzip member with a single stored block
+     */
+    static void AppendStoredMember(std::vector<uint8_t> &stream, const uint8_t *data_ptr, uint32_t size) {
+        const uint8_t header[] = {0x1fu, 0x8bu, 0x08u, 0u, 0u, 0u, 0u, 0u, 0u, 0xffu};
+        const uint8_t block[]  = {1u,
+                                  static_cast<uint8_t>(size), static_cast<uint8_t>(size >> 8u),
+                                  static_cast<uint8_t>(~size), static_cast<uint8_t>(~size >> 8u)};
+
+        stream.insert(stream.end(), std::begin(header), std::end(header));
+        stream.insert(stream.end(), std::begin(block), std::end(block));
+        stream.insert(stream.end(), data_ptr, data_ptr + size);
+
+        const uint32_t crc = Crc32(data_ptr, size);
+
+        for (uint32_t value : {crc, size}) {
+            for (uint32_t i = 0u; i < 4u; i++) {
+                stream.push_back(static_cast<uint8_t>(value >> (i * 8u)));
+            }
+        }
+    }
+
+    static auto Crc32(const uint8_t *data_ptr, uint32_t size) -> uint32_t {
+        uint32_t crc = UINT32_MAX;
+
+        for (uint32_t i = 0u; i < size; i++) {
+            crc ^= data_ptr[i];
+
+            for (uint32_t bit = 0u; bit < 8u; bit++) {
+                crc = (crc >> 1u) ^ (0xEDB88320u & (0u - (crc & 1u)));
+            }
+        }
+
+        return ~crc;
+    }
+
+    std::vector<uint8_t> source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate_parallel, gzip_members, ParallelGzipInflateTest) {
+    RunTest(CompressMembers(false));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate_parallel, bgzf_members, ParallelGzipInflateTest) {
+    RunTest(CompressMembers(true));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate_parallel, false_member_signature, ParallelGzipInflateTest) {
+    // The data of stored blocks contain gzip signatures, so the members are found by walking them
+    const uint8_t signature[] = {0x1fu, 0x8bu, 0x08u, 0u, 0u, 0u, 0u, 0u, 0u, 0xffu};
+
+    for (uint32_t offset = 0u; offset + sizeof(signature) <= source.size(); offset += member_size / 3u) {
+        std::copy(std::begin(signature), std::end(signature), source.begin() + offset);
+    }
+
+    std::vector<uint8_t> stream;
+
+    for (uint32_t offset = 0u; offset < source.size(); offset += member_size) {
+        AppendStoredMember(stream,
+                           source.data() + offset,
+                           std::min(member_size, static_cast<uint32_t>(source.size()) - offset));
+    }
+
+    RunTest(stream);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate_parallel, unparsable_member_signature, ParallelGzipInflateTest) {
+    // The signature in the data of the member before the last one has an extra field running past the stream end,
+    // so the header at the guessed boundary can't be read and the members are found by walking them
+    const uint8_t signature[] = {0x1fu, 0x8bu, 0x08u, 0x04u, 0u, 0u, 0u, 0u, 0u, 0xffu, 0xffu, 0xffu};
+
+    const uint32_t last_member_offset = (static_cast<uint32_t>(source.size()) - 1u) / member_size * member_size;
+
+    std::copy(std::begin(signature), std::end(signature), source.begin() + last_member_offset - 100u);
+
+    std::vector<uint8_t> stream;
+
+    for (uint32_t offset = 0u; offset < source.size(); offset += member_size) {
+        AppendStoredMember(stream,
+                           source.data() + offset,
+                           std::min(member_size, static_cast<uint32_t>(source.size()) - offset));
+    }
+
+    RunTest(stream);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate_parallel, corrupted_trailer, ParallelGzipInflateTest) {
+    for (bool is_bgzf : {false, true}) {
+        auto stream = CompressMembers(is_bgzf);
+
+        // CRC of the last member
+        stream[stream.size() - gzip_trailer_size] ^= 1u;
+
+        RunTest(stream, QPL_STS_INTL_VERIFY_ERR);
+    }
+}
+
+}
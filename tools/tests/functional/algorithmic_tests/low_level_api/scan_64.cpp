@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+// 64-bit scans process the source by chunks of this number of elements
+constexpr uint32_t scan_64_chunk_elements = 1u << 24u;
+
+class Scan64Test : public JobFixture {
+protected:
+    void RunScan(uint32_t bit_width, uint32_t elements_count, uint32_t prologue, uint32_t flags) {
+        std::mt19937 random_generator(GetSeed());
+        std::uniform_int_distribution<uint32_t> distribution(0u, UINT8_MAX);
+
+        source.resize(prologue + bits_to_bytes(elements_count * bit_width));
+
+        for (auto &byte : source) {
+            byte = static_cast<uint8_t>(distribution(random_generator));
+        }
+
+        const uint32_t max_value = static_cast<uint32_t>((1ull << bit_width) - 1u);
+
+        // Reference is the regular scan with 32-bit fields
+        std::vector<uint8_t> reference_destination(bits_to_bytes(elements_count), 0u);
+
+        FillJob(job_ptr, bit_width, prologue, max_value, flags);
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = reference_destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(reference_destination.size());
+        job_ptr->num_input_elements = elements_count;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        const uint32_t reference_total_out   = job_ptr->total_out;
+        const uint32_t reference_crc         = job_ptr->crc;
+        const uint32_t reference_xor         = job_ptr->xor_checksum;
+        const uint32_t reference_first_index = job_ptr->first_index_min_value;
+        const uint32_t reference_last_index  = job_ptr->last_index_max_value;
+        const uint64_t reference_sum         = job_ptr->sum_value_64;
+
+        destination.assign(bits_to_bytes(elements_count), 0u);
+
+        FillJob(job_ptr, bit_width, prologue, max_value, flags | QPL_FLAG_ANALYTICS_64);
+        job_ptr->next_in_ptr           = source.data();
+        job_ptr->available_in_64       = source.size();
+        job_ptr->next_out_ptr          = destination.data();
+        job_ptr->available_out_64      = destination.size();
+        job_ptr->num_input_elements_64 = elements_count;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        EXPECT_EQ(job_ptr->total_in_64, source.size());
+        EXPECT_EQ(job_ptr->total_out_64, reference_total_out);
+        EXPECT_EQ(job_ptr->available_in_64, 0u);
+        EXPECT_EQ(job_ptr->next_in_ptr, source.data() + source.size());
+        EXPECT_EQ(job_ptr->next_out_ptr, destination.data() + reference_total_out);
+        EXPECT_EQ(job_ptr->sum_value_64, reference_sum);
+        EXPECT_EQ(job_ptr->sum_value, static_cast<uint32_t>(reference_sum));
+        EXPECT_EQ(job_ptr->first_index_min_value_64, reference_first_index);
+        EXPECT_EQ(job_ptr->last_index_max_value_64, reference_last_index);
+
+        if (!(flags & QPL_FLAG_OMIT_CHECKSUMS)) {
+            EXPECT_EQ(job_ptr->crc, reference_crc);
+            EXPECT_EQ(job_ptr->xor_checksum, reference_xor);
+        }
+
+        EXPECT_TRUE(CompareVectors(destination, reference_destination, reference_total_out));
+    }
+
+    static void FillJob(qpl_job *job, uint32_t bit_width, uint32_t prologue, uint32_t max_value, uint32_t flags) {
+        job->op                 = qpl_op_scan_range;
+        job->param_low          = max_value / 4u;
+        job->param_high         = max_value / 4u * 3u;
+        job->src1_bit_width     = bit_width;
+        job->parser             = qpl_p_le_packed_array;
+        job->drop_initial_bytes = prologue;
+        job->out_bit_width      = qpl_ow_nom;
+        job->flags              = flags;
+        job->crc                = 0u;
+        job->xor_checksum       = 0u;
+        job->total_in           = 0u;
+        job->total_out          = 0u;
+        job->total_in_64        = 0u;
+        job->total_out_64       = 0u;
+    }
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_64, chunks, Scan64Test) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "64-bit scan is performed on the software path only";
+    }
+
+    RunScan(1u, 2u * scan_64_chunk_elements + 5u, 0u, 0u);
+    RunScan(8u, scan_64_chunk_elements + 3u, 0u, QPL_FLAG_CRC32C);
+
+    // Odd prologue shifts the chunks of the source against the 16-bit words of the XOR checksum
+    RunScan(3u, scan_64_chunk_elements + 11u, 3u, 0u);
+    RunScan(16u, 1000u, 1u, QPL_FLAG_OMIT_CHECKSUMS);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_64, not_supported_modes, Scan64Test) {
+    constexpr uint32_t elements_count = 1000u;
+
+    source.assign(elements_count, 1u);
+    destination.assign(bits_to_bytes(elements_count), 0u);
+
+    FillJob(job_ptr, 8u, 0u, UINT8_MAX, QPL_FLAG_ANALYTICS_64);
+    job_ptr->next_in_ptr           = source.data();
+    job_ptr->available_in_64       = source.size();
+    job_ptr->next_out_ptr          = destination.data();
+    job_ptr->available_out_64      = destination.size();
+    job_ptr->num_input_elements_64 = elements_count;
+
+    if (GetExecutionPath() == qpl_path_hardware) {
+        EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, run_job_api(job_ptr));
+        return;
+    }
+
+    job_ptr->out_bit_width = qpl_ow_32;
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, run_job_api(job_ptr));
+
+    job_ptr->out_bit_width = qpl_ow_nom;
+    job_ptr->parser        = qpl_p_parquet_rle;
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, run_job_api(job_ptr));
+
+    job_ptr->parser = qpl_p_le_packed_array;
+    job_ptr->op     = qpl_op_extract;
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, run_job_api(job_ptr));
+
+    job_ptr->op                    = qpl_op_scan_eq;
+    job_ptr->num_input_elements_64 = 2u * elements_count;
+    EXPECT_EQ(QPL_STS_SRC_IS_SHORT_ERR, run_job_api(job_ptr));
+}
+
+}
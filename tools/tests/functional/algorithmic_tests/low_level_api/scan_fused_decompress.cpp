@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "test_sources.hpp"
+#include "util.hpp"
+#include "qpl_api_ref.h"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+// Compressed byte-aligned columns are scanned right in the decompress buffer by tiles of 16 KB
+constexpr uint32_t fused_scan_tile_size = 16u * 1024u;
+
+class FusedScanTest : public ReferenceFixture {
+protected:
+    void RunScan(uint32_t bit_width, uint32_t elements_count, uint16_t prologue) {
+        AnalyticInputStream input_stream(elements_count,
+                                         static_cast<uint8_t>(bit_width),
+                                         qpl_p_le_packed_array,
+                                         prologue);
+
+        std::vector<uint8_t> compressed_source;
+        ASSERT_NO_THROW(compressed_source = util::compress_stream(input_stream));
+
+        const uint32_t max_input_value = static_cast<uint32_t>((1ull << bit_width) - 1u);
+
+        destination.assign(bits_to_bytes(elements_count), 0u);
+        reference_destination.assign(bits_to_bytes(elements_count), 0u);
+
+        FillJob(job_ptr, elements_count, bit_width, prologue, max_input_value);
+        job_ptr->next_in_ptr   = compressed_source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(compressed_source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->flags         = QPL_FLAG_DECOMPRESS_ENABLE;
+
+        FillJob(reference_job_ptr, elements_count, bit_width, prologue, max_input_value);
+        reference_job_ptr->next_in_ptr   = input_stream.data();
+        reference_job_ptr->available_in  = static_cast<uint32_t>(input_stream.size());
+        reference_job_ptr->next_out_ptr  = reference_destination.data();
+        reference_job_ptr->available_out = static_cast<uint32_t>(reference_destination.size());
+        reference_job_ptr->flags         = 0u;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+        ASSERT_EQ(QPL_STS_OK, ref_compare(reference_job_ptr));
+
+        EXPECT_EQ(job_ptr->total_out, reference_job_ptr->total_out);
+        EXPECT_TRUE(compare_crc32_field(job_ptr, reference_job_ptr));
+        EXPECT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
+    }
+
+    static void FillJob(qpl_job *job,
+                        uint32_t elements_count,
+                        uint32_t bit_width,
+                        uint32_t prologue,
+                        uint32_t max_value) {
+        job->op                 = qpl_op_scan_range;
+        job->param_low          = max_value / 4u;
+        job->param_high         = max_value / 4u * 3u;
+        job->num_input_elements = elements_count;
+        job->src1_bit_width     = bit_width;
+        job->parser             = qpl_p_le_packed_array;
+        job->drop_initial_bytes = prologue;
+        job->out_bit_width      = qpl_ow_nom;
+        job->crc                = 0u;
+        job->xor_checksum       = 0u;
+        job->total_in           = 0u;
+        job->total_out          = 0u;
+    }
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_fused_decompress, tiles_8u, FusedScanTest) {
+    RunScan(8u, 3u * fused_scan_tile_size + 123u, 0u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_fused_decompress, tiles_16u, FusedScanTest) {
+    RunScan(16u, 3u * fused_scan_tile_size / 2u + 45u, 0u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_fused_decompress, tiles_32u, FusedScanTest) {
+    RunScan(32u, 3u * fused_scan_tile_size / 4u + 7u, 0u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_fused_decompress, dropped_bytes, FusedScanTest) {
+    // Unaligned prologue shifts the elements of every tile in the decompress buffer
+    for (uint16_t prologue : {1u, 3u, 1000u}) {
+        RunScan(8u, 2u * fused_scan_tile_size + 5u, prologue);
+        RunScan(16u, fused_scan_tile_size + 5u, prologue);
+        RunScan(32u, fused_scan_tile_size / 2u + 5u, prologue);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_fused_decompress, source_is_short, FusedScanTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "Fused decompress and scan is performed on the software path only";
+    }
+
+    constexpr uint32_t elements_count = 2u * fused_scan_tile_size;
+
+    for (uint32_t bit_width : {8u, 16u, 32u}) {
+        AnalyticInputStream input_stream(elements_count, static_cast<uint8_t>(bit_width));
+
+        std::vector<uint8_t> compressed_source;
+        ASSERT_NO_THROW(compressed_source = util::compress_stream(input_stream));
+
+        // The job requests more elements than the compressed stream holds
+        destination.assign(bits_to_bytes(2u * elements_count), 0u);
+
+        FillJob(job_ptr, 2u * elements_count, bit_width, 0u, UINT32_MAX);
+        job_ptr->next_in_ptr   = compressed_source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(compressed_source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->flags         = QPL_FLAG_DECOMPRESS_ENABLE;
+
+        EXPECT_EQ(QPL_STS_SRC_IS_SHORT_ERR, run_job_api(job_ptr)) << "Bit width: " << bit_width;
+    }
+}
+
+}
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "qpl/qpl.h"
+#include "../../../common/analytic_fixture.hpp"
+#include "util.hpp"
+#include "qpl_api_ref.h"
+#include "ta_ll_common.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test
+{
+    class ScanProgramTest : public AnalyticFixture
+    {
+    public:
+        void InitializeTestCases()
+        {
+            std::vector<uint32_t> lengths = GenerateNumberOfElementsVector();
+
+            for (uint32_t length : lengths)
+            {
+                for (uint32_t source_bit_width = 1; source_bit_width <= 32; source_bit_width++)
+                {
+                    for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array, qpl_p_parquet_rle})
+                    {
+                        uint32_t max_input_value = (1ull << source_bit_width) - 1;
+                        AnalyticTestCase test_case;
+                        test_case.operation = qpl_op_scan_program;
+                        test_case.number_of_elements = length;
+                        test_case.source_bit_width = source_bit_width;
+                        test_case.destination_bit_width = 1u;
+                        test_case.lower_bound = max_input_value / 4;
+                        test_case.upper_bound = max_input_value / 4 * 3;
+                        test_case.parser = parser;
+                        test_case.flags = 0u;
+
+                        AddNewTestCase(test_case);
+                    }
+                }
+            }
+        }
+
+        void SetUp() override
+        {
+            AnalyticFixture::SetUp();
+            InitializeTestCases();
+        }
+
+    protected:
+        void SetUpBeforeIteration() override
+        {
+            AnalyticFixture::SetUpBeforeIteration();
+
+            const uint32_t lower_bound = current_test_case.lower_bound;
+            const uint32_t upper_bound = current_test_case.upper_bound;
+            const uint32_t middle      = lower_bound + (upper_bound - lower_bound) / 2u;
+
+            // not ((range(lower, upper) and ne(middle)) or lt(lower / 2))
+            program = {};
+            program.instructions_count = 6u;
+            program.instructions[0] = {qpl_scan_predicate, qpl_op_scan_range, lower_bound, upper_bound};
+            program.instructions[1] = {qpl_scan_predicate, qpl_op_scan_ne, middle, 0u};
+            program.instructions[2] = {qpl_scan_and, qpl_op_scan_eq, 0u, 0u};
+            program.instructions[3] = {qpl_scan_predicate, qpl_op_scan_lt, lower_bound / 2u, 0u};
+            program.instructions[4] = {qpl_scan_or, qpl_op_scan_eq, 0u, 0u};
+            program.instructions[5] = {qpl_scan_not, qpl_op_scan_eq, 0u, 0u};
+
+            job_ptr->scan_program = &program;
+        }
+
+        std::vector<uint8_t> RunReferenceScan(qpl_operation operation, uint32_t param_low, uint32_t param_high)
+        {
+            std::vector<uint8_t> result(reference_destination.size(), 0u);
+
+            reference_job_ptr->op            = operation;
+            reference_job_ptr->param_low     = param_low;
+            reference_job_ptr->param_high    = param_high;
+            reference_job_ptr->next_in_ptr   = source.data();
+            reference_job_ptr->available_in  = static_cast<uint32_t>(source.size());
+            reference_job_ptr->next_out_ptr  = result.data();
+            reference_job_ptr->available_out = static_cast<uint32_t>(result.size());
+            reference_job_ptr->total_in      = 0u;
+            reference_job_ptr->total_out     = 0u;
+
+            EXPECT_EQ(QPL_STS_OK, ref_compare(reference_job_ptr));
+
+            result.resize(reference_job_ptr->total_out);
+
+            return result;
+        }
+
+        std::vector<uint8_t> GetReferenceResult()
+        {
+            const auto &range_instruction = program.instructions[0];
+            const auto &ne_instruction    = program.instructions[1];
+            const auto &lt_instruction    = program.instructions[3];
+
+            auto in_range  = RunReferenceScan(qpl_op_scan_range,
+                                              range_instruction.param_low,
+                                              range_instruction.param_high);
+            auto not_equal = RunReferenceScan(qpl_op_scan_ne, ne_instruction.param_low, 0u);
+            auto less      = RunReferenceScan(qpl_op_scan_lt, lt_instruction.param_low, 0u);
+
+            std::vector<uint8_t> result(in_range.size());
+
+            for (size_t i = 0u; i < result.size(); i++)
+            {
+                result[i] = static_cast<uint8_t>(~((in_range[i] & not_equal[i]) | less[i]));
+            }
+
+            // Bits after the last element are not a part of the bit vector
+            const uint32_t tail_bits = current_test_case.number_of_elements & 7u;
+
+            if (0u != tail_bits && !result.empty())
+            {
+                result.back() &= static_cast<uint8_t>((1u << tail_bits) - 1u);
+            }
+
+            return result;
+        }
+
+        qpl_scan_program program{};
+    };
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(scan_program, combined_predicates, ScanProgramTest)
+    {
+        auto status = run_job_api(job_ptr);
+
+        if (GetExecutionPath() == qpl_path_hardware)
+        {
+            EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+            return;
+        }
+
+        EXPECT_EQ(QPL_STS_OK, status);
+
+        auto reference = GetReferenceResult();
+
+        EXPECT_EQ(reference.size(), job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(destination, reference, job_ptr->total_out));
+    }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(scan_program, combined_predicates_with_decompress, ScanProgramTest)
+    {
+        std::vector<uint8_t> compressed_source;
+        ASSERT_NO_THROW(compressed_source = GetCompressedSource());
+        job_ptr->available_in = static_cast<uint32_t>(compressed_source.size());
+        job_ptr->next_in_ptr  = compressed_source.data();
+        job_ptr->flags       |= QPL_FLAG_DECOMPRESS_ENABLE;
+
+        if (current_test_case.parser == qpl_p_parquet_rle) {
+            job_ptr->src1_bit_width = 0u;
+        }
+
+        auto status = run_job_api(job_ptr);
+
+        if (GetExecutionPath() == qpl_path_hardware)
+        {
+            EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+            return;
+        }
+
+        EXPECT_EQ(QPL_STS_OK, status);
+
+        auto reference = GetReferenceResult();
+
+        EXPECT_EQ(reference.size(), job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(destination, reference, job_ptr->total_out));
+    }
+}
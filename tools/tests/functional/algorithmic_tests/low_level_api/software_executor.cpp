@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+#include "check_result.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t executor_threads_count = 2u;
+constexpr uint32_t executor_jobs_count    = 8u;
+constexpr uint32_t executor_source_size   = 64u * 1024u;
+constexpr uint32_t executor_client_threads = 4u;
+
+class SoftwareExecutorTest : public JobFixture {
+public:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_gen(executor_source_size, 8u, GetSeed());
+        source = source_gen.get_source();
+    }
+
+    void TearDown() override {
+        qpl_set_software_async_threads(0u);
+
+        for (auto &buffer : job_buffers) {
+            qpl_fini_job(reinterpret_cast<qpl_job *>(buffer.get()));
+        }
+
+        JobFixture::TearDown();
+    }
+
+protected:
+    qpl_job *CreateJob() {
+        uint32_t job_size = 0u;
+
+        EXPECT_EQ(qpl_get_job_size(qpl_path_software, &job_size), QPL_STS_OK);
+
+        job_buffers.emplace_back(std::make_unique<uint8_t[]>(job_size));
+        auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffers.back().get());
+
+        EXPECT_EQ(qpl_init_job(qpl_path_software, job_ptr), QPL_STS_OK);
+
+        return job_ptr;
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers;
+    std::vector<uint8_t>                    source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(software_executor, crc64, SoftwareExecutorTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "The software executor is used on the software path only";
+    }
+
+    qpl_job *reference_job_ptr = CreateJob();
+
+    reference_job_ptr->op           = qpl_op_crc64;
+    reference_job_ptr->crc64_poly   = 0x04C11DB700000000;
+    reference_job_ptr->next_in_ptr  = source.data();
+    reference_job_ptr->available_in = executor_source_size;
+
+    ASSERT_EQ(qpl_execute_job(reference_job_ptr), QPL_STS_OK);
+
+    ASSERT_EQ(qpl_set_software_async_threads(executor_threads_count), QPL_STS_OK);
+
+    std::vector<qpl_job *> jobs;
+
+    for (uint32_t i = 0u; i < executor_jobs_count; i++) {
+        qpl_job *job_ptr = CreateJob();
+
+        job_ptr->op           = qpl_op_crc64;
+        job_ptr->crc64_poly   = 0x04C11DB700000000;
+        job_ptr->next_in_ptr  = source.data();
+        job_ptr->available_in = executor_source_size;
+
+        ASSERT_EQ(qpl_submit_job(job_ptr), QPL_STS_OK);
+
+        jobs.push_back(job_ptr);
+    }
+
+    for (auto *job_ptr : jobs) {
+        ASSERT_EQ(qpl_wait_job(job_ptr), QPL_STS_OK);
+        EXPECT_EQ(qpl_check_job(job_ptr), QPL_STS_OK);
+        EXPECT_EQ(job_ptr->crc64, reference_job_ptr->crc64);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(software_executor, deflate_inflate, SoftwareExecutorTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "The software executor is used on the software path only";
+    }
+
+    ASSERT_EQ(qpl_set_software_async_threads(executor_threads_count), QPL_STS_OK);
+
+    std::vector<std::vector<uint8_t>> compressed(executor_jobs_count, std::vector<uint8_t>(executor_source_size * 2u));
+    std::vector<std::vector<uint8_t>> decompressed(executor_jobs_count, std::vector<uint8_t>(executor_source_size));
+    std::vector<qpl_job *>            jobs;
+
+    for (uint32_t i = 0u; i < executor_jobs_count; i++) {
+        qpl_job *job_ptr = CreateJob();
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = executor_source_size;
+        job_ptr->next_out_ptr  = compressed[i].data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed[i].size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+
+        ASSERT_EQ(qpl_submit_job(job_ptr), QPL_STS_OK);
+
+        jobs.push_back(job_ptr);
+    }
+
+    for (uint32_t i = 0u; i < executor_jobs_count; i++) {
+        ASSERT_EQ(qpl_wait_job(jobs[i]), QPL_STS_OK);
+
+        const uint32_t compressed_size = jobs[i]->total_out;
+
+        ASSERT_EQ(qpl_init_job(qpl_path_software, jobs[i]), QPL_STS_OK);
+
+        jobs[i]->op            = qpl_op_decompress;
+        jobs[i]->next_in_ptr   = compressed[i].data();
+        jobs[i]->available_in  = compressed_size;
+        jobs[i]->next_out_ptr  = decompressed[i].data();
+        jobs[i]->available_out = static_cast<uint32_t>(decompressed[i].size());
+        jobs[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+        ASSERT_EQ(qpl_submit_job(jobs[i]), QPL_STS_OK);
+    }
+
+    // Jobs queued before the executor is disabled are completed
+    ASSERT_EQ(qpl_set_software_async_threads(0u), QPL_STS_OK);
+
+    for (uint32_t i = 0u; i < executor_jobs_count; i++) {
+        ASSERT_EQ(qpl_check_job(jobs[i]), QPL_STS_OK);
+        EXPECT_TRUE(CompareVectors(decompressed[i], source));
+    }
+}
+
+// Several threads submit jobs and poll them with qpl_check_job() while the executor threads publish the statuses,
+// the results read after the poll must be complete. Build with -DSANITIZE_THREADS=ON to check the synchronization
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(software_executor, concurrent_submit_and_poll, SoftwareExecutorTest) {
+    if (GetExecutionPath() != qpl_path_software) {
+        GTEST_SKIP() << "The software executor is used on the software path only";
+    }
+
+    qpl_job *reference_job_ptr = CreateJob();
+
+    reference_job_ptr->op           = qpl_op_crc64;
+    reference_job_ptr->crc64_poly   = 0x04C11DB700000000;
+    reference_job_ptr->next_in_ptr  = source.data();
+    reference_job_ptr->available_in = executor_source_size;
+
+    ASSERT_EQ(qpl_execute_job(reference_job_ptr), QPL_STS_OK);
+
+    ASSERT_EQ(qpl_set_software_async_threads(executor_threads_count), QPL_STS_OK);
+
+    // Jobs are created up front, the fixture keeps the buffers
+    std::vector<std::vector<qpl_job *>> client_jobs(executor_client_threads);
+
+    for (auto &jobs : client_jobs) {
+        for (uint32_t i = 0u; i < executor_jobs_count; i++) {
+            jobs.push_back(CreateJob());
+        }
+    }
+
+    std::vector<uint32_t>    failures(executor_client_threads, 0u);
+    std::vector<std::thread> clients;
+
+    for (uint32_t client = 0u; client < executor_client_threads; client++) {
+        clients.emplace_back([&, client]() {
+            for (auto *job_ptr : client_jobs[client]) {
+                job_ptr->op           = qpl_op_crc64;
+                job_ptr->crc64_poly   = 0x04C11DB700000000;
+                job_ptr->next_in_ptr  = source.data();
+                job_ptr->available_in = executor_source_size;
+
+                if (QPL_STS_OK != qpl_submit_job(job_ptr)) {
+                    failures[client]++;
+                }
+            }
+
+            for (auto *job_ptr : client_jobs[client]) {
+                qpl_status status = QPL_STS_BEING_PROCESSED;
+
+                while (QPL_STS_BEING_PROCESSED == (status = qpl_check_job(job_ptr))) {
+                    std::this_thread::yield();
+                }
+
+                if (QPL_STS_OK != status || job_ptr->crc64 != reference_job_ptr->crc64) {
+                    failures[client]++;
+                }
+            }
+        });
+    }
+
+    for (auto &client : clients) {
+        client.join();
+    }
+
+    for (uint32_t client = 0u; client < executor_client_threads; client++) {
+        EXPECT_EQ(failures[client], 0u) << "Fail on: client thread " << client;
+    }
+}
+
+}
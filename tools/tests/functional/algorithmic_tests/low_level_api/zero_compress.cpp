@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "../../../common/operation_test.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t zero_tag_size           = 4u;
+constexpr uint32_t zero_block_words        = 32u;
+constexpr uint32_t zero_nonzero_percentage = 10u;
+
+class ZeroCompressTest : public JobFixture {
+protected:
+    void GenerateSparseSource(uint32_t source_size, uint32_t word_size) {
+        std::mt19937                            random_engine(GetSeed());
+        std::uniform_int_distribution<uint32_t> percentage(0u, 99u);
+        std::uniform_int_distribution<uint32_t> byte_value(1u, 255u);
+
+        source.assign(source_size, 0u);
+
+        for (uint32_t i = 0u; i + word_size <= source_size; i += word_size) {
+            if (percentage(random_engine) < zero_nonzero_percentage) {
+                source[i] = static_cast<uint8_t>(byte_value(random_engine));
+            }
+        }
+    }
+
+    static uint32_t GetMaxCompressedSize(uint32_t source_size, uint32_t word_size) {
+        const uint32_t block_size = zero_block_words * word_size;
+
+        return source_size + ((source_size + block_size - 1u) / block_size) * zero_tag_size;
+    }
+
+    void PrepareJob(qpl_operation operation,
+                    uint32_t flags,
+                    uint8_t *source_ptr,
+                    uint32_t source_size,
+                    uint8_t *destination_ptr,
+                    uint32_t destination_size) {
+        job_ptr->op            = operation;
+        job_ptr->flags         = flags;
+        job_ptr->next_in_ptr   = source_ptr;
+        job_ptr->available_in  = source_size;
+        job_ptr->next_out_ptr  = destination_ptr;
+        job_ptr->available_out = destination_size;
+    }
+
+    void CheckRoundTrip(qpl_operation compress_operation,
+                        qpl_operation decompress_operation,
+                        uint32_t word_size,
+                        uint32_t flags) {
+        for (uint32_t source_size : {4096u, 4096u + 3u * word_size, word_size}) {
+            GenerateSparseSource(source_size, word_size);
+
+            std::vector<uint8_t> compressed(GetMaxCompressedSize(source_size, word_size));
+            std::vector<uint8_t> decompressed(source_size);
+
+            PrepareJob(compress_operation, flags,
+                       source.data(), source_size,
+                       compressed.data(), static_cast<uint32_t>(compressed.size()));
+            ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+            const uint32_t compressed_size = job_ptr->total_out;
+            const uint32_t compress_crc    = job_ptr->crc;
+
+            EXPECT_LT(compressed_size, source_size / 2u + zero_tag_size + word_size);
+
+            PrepareJob(decompress_operation, flags,
+                       compressed.data(), compressed_size,
+                       decompressed.data(), static_cast<uint32_t>(decompressed.size()));
+            ASSERT_EQ(run_job_api(job_ptr), QPL_STS_OK);
+
+            EXPECT_EQ(job_ptr->total_out, source_size);
+            EXPECT_EQ(job_ptr->crc, compress_crc);
+            EXPECT_EQ(decompressed, source);
+        }
+    }
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(zero_compress, round_trip_16u, ZeroCompressTest) {
+    CheckRoundTrip(qpl_op_z_compress16, qpl_op_z_decompress16, sizeof(uint16_t), 0u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(zero_compress, round_trip_32u, ZeroCompressTest) {
+    CheckRoundTrip(qpl_op_z_compress32, qpl_op_z_decompress32, sizeof(uint32_t), 0u);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(zero_compress, round_trip_crc32c, ZeroCompressTest) {
+    CheckRoundTrip(qpl_op_z_compress32, qpl_op_z_decompress32, sizeof(uint32_t), QPL_FLAG_CRC32C);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(zero_compress, short_destination, ZeroCompressTest) {
+    constexpr uint32_t source_size = 4096u;
+
+    GenerateSparseSource(source_size, sizeof(uint32_t));
+    source[source_size - sizeof(uint32_t)] = 1u;
+
+    destination.resize(zero_tag_size);
+
+    PrepareJob(qpl_op_z_compress32, 0u,
+               source.data(), source_size,
+               destination.data(), static_cast<uint32_t>(destination.size()));
+
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_DST_IS_SHORT_ERR);
+}
+
+}
@@ -369,5 +369,36 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(huffman_table, deserialize) {
     qpl_huffman_table_destroy(table);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(huffman_table, deserialize_in_place) {
+    alignas(64) uint8_t buffer_ptr[128] = {};
+    size_t  buffer_size = sizeof(buffer_ptr);
+
+    qpl_huffman_table_t table{};
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_huffman_table_deserialize_in_place(nullptr,
+                                                                           buffer_size,
+                                                                           DEFAULT_ALLOCATOR_C,
+                                                                           &table));
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_huffman_table_deserialize_in_place(buffer_ptr,
+                                                                       0,
+                                                                       DEFAULT_ALLOCATOR_C,
+                                                                       &table));
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_huffman_table_deserialize_in_place(buffer_ptr,
+                                                                           buffer_size,
+                                                                           DEFAULT_ALLOCATOR_C,
+                                                                           nullptr));
+
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_huffman_table_deserialize_in_place(buffer_ptr + 1,
+                                                                                buffer_size - 1,
+                                                                                DEFAULT_ALLOCATOR_C,
+                                                                                &table));
+
+    EXPECT_EQ(QPL_STS_SERIALIZATION_FORMAT_ERROR, qpl_huffman_table_deserialize_in_place(buffer_ptr,
+                                                                                         buffer_size,
+                                                                                         DEFAULT_ALLOCATOR_C,
+                                                                                         &table));
+}
 
 }
@@ -130,4 +130,38 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, find_mini_block_index) {
 
     EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
 }
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, decompress_mini_blocks_parallel) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+    std::array<qpl_index, 3u>                   indices{};
+    uint32_t                                    output_size = 0u;
+
+    qpl_index_table table{};
+    table.block_count           = 1u;
+    table.mini_block_count      = 1u;
+    table.mini_blocks_per_block = 1u;
+    table.indices_ptr           = indices.data();
+
+    auto status = qpl_decompress_mini_blocks_parallel(&table, qpl_mblk_size_512,
+                                                      source.data(), SOURCE_ARRAY_SIZE,
+                                                      destination.data(), DESTINATION_ARRAY_SIZE,
+                                                      0u, &output_size);
+
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, status) << "Fail on: zero threads count";
+
+    status = qpl_decompress_mini_blocks_parallel(&table, qpl_mblk_size_512,
+                                                 source.data(), SOURCE_ARRAY_SIZE,
+                                                 destination.data(), DESTINATION_ARRAY_SIZE,
+                                                 1u, nullptr);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status) << "Fail on: output size pointer is null";
+
+    status = qpl_decompress_mini_blocks_parallel(&table, qpl_mblk_size_none,
+                                                 source.data(), SOURCE_ARRAY_SIZE,
+                                                 destination.data(), DESTINATION_ARRAY_SIZE,
+                                                 1u, &output_size);
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, status) << "Fail on: mini-block size is none";
+}
 } // namespace qpl::test
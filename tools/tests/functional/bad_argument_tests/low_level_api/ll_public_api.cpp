@@ -172,6 +172,27 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics_sampled, test) {
+    qpl_status             status;
+    uint8_t                source;
+    uint32_t               source_length = 1u;
+    qpl_histogram          deflate_histogram{};
+    qpl_path_t             path          = qpl_path_software;
+    qpl_compression_levels level         = qpl_default_level;
+
+    status = qpl_gather_deflate_statistics_sampled(nullptr, source_length, &deflate_histogram, 1u, nullptr, level, path);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_sampled(&source, source_length, nullptr, 1u, nullptr, level, path);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_sampled(&source, source_length, &deflate_histogram, 1u, nullptr, INCORRECT_LEVEL, path);
+    EXPECT_EQ(status, QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL);
+
+    status = qpl_gather_deflate_statistics_sampled(&source, source_length, &deflate_histogram, 1u, nullptr, level, INCORRECT_PATH);
+    EXPECT_EQ(status, QPL_STS_PATH_ERR);
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_existing_dict_size, test) {
     size_t dictionary_size = 0;
 
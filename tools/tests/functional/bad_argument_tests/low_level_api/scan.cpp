@@ -101,4 +101,46 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, drop_initial_bytes) {
                                                                                    | QPL_FLAG_DECOMPRESS_ENABLE);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, scan_program_errors) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+    qpl_scan_program                            program{};
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 8u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, OUTPUT_BIT_WIDTH);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, OPERATION_FLAGS, qpl_op_scan_program);
+
+    if (qpl_path_hardware == job_ptr->data_ptr.path) {
+        job_ptr->scan_program = &program;
+
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: hardware path";
+
+        return;
+    }
+
+    job_ptr->scan_program = nullptr;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NULL_PTR_ERR) << "Fail on: program is null";
+
+    job_ptr->scan_program = &program;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: program is empty";
+
+    program.instructions_count = QPL_SCAN_PROGRAM_MAX_SIZE + 1u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: program is too long";
+
+    program.instructions_count = 1u;
+    program.instructions[0]    = {qpl_scan_predicate, qpl_op_extract, 1u, 0u};
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: predicate is not a comparison";
+
+    program.instructions_count = 2u;
+    program.instructions[0]    = {qpl_scan_predicate, qpl_op_scan_eq, 1u, 0u};
+    program.instructions[1]    = {static_cast<qpl_scan_instruction_type>(qpl_scan_not + 1u), qpl_op_scan_eq, 0u, 0u};
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: unknown instruction type";
+
+    program.instructions[1] = {qpl_scan_and, qpl_op_scan_eq, 0u, 0u};
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: operand is missing";
+
+    program.instructions[1] = {qpl_scan_predicate, qpl_op_scan_lt, 2u, 0u};
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: several results are left";
+}
+
 }
@@ -10,7 +10,7 @@ uint8_t reserved_op_codes[RESERVED_OPCODES_COUNT] = {0x02, 0x03, 0x06, 0x07,
                                                      0x0A, 0x0B, 0x0E, 0x0F,
                                                      0x16, 0x17, 0x18, 0x19,
                                                      0x1A, 0x1B, 0x1C, 0x1D,
-                                                     0x1E, 0x1F, 0x28, 0x29};
+                                                     0x1E, 0x1F, 0x29, 0x2A};
 
 void set_input_stream(qpl_job *job_ptr,
                       uint8_t *source_ptr,
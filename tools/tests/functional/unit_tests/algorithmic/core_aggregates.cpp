@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 #include <array>
+#include <cstring>
 
 #include "gtest/gtest.h"
 #include "qpl_test_environment.hpp"
@@ -17,6 +18,10 @@
 #include "qplc_api.h"
 #include "dispatcher.hpp"
 
+namespace qpl::core_sw::dispatcher {
+extern aggregates_table_t avx2_aggregates_table;
+}
+
 qplc_aggregates_t_ptr qplc_aggregates(uint32_t index) {
     static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
 
@@ -25,7 +30,7 @@ qplc_aggregates_t_ptr qplc_aggregates(uint32_t index) {
 
 static void ref_qplc_bit_aggregates_8u(const uint8_t* src_ptr, uint32_t length,
     uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-    uint32_t* sum_ptr, uint32_t* index_ptr) {
+    uint64_t* sum_ptr, uint32_t* index_ptr) {
 
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -39,7 +44,7 @@ static void ref_qplc_bit_aggregates_8u(const uint8_t* src_ptr, uint32_t length,
 
 static void ref_qplc_aggregates_8u(const uint8_t* src_ptr, uint32_t length,
     uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-    uint32_t* sum_ptr, uint32_t* index_ptr) {
+    uint64_t* sum_ptr, uint32_t* index_ptr) {
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
         *min_value_ptr = (src_ptr[idx] < *min_value_ptr) ? src_ptr[idx] : *min_value_ptr;
@@ -49,7 +54,7 @@ static void ref_qplc_aggregates_8u(const uint8_t* src_ptr, uint32_t length,
 
 static void ref_qplc_aggregates_16u(const uint8_t* src_ptr, uint32_t length,
     uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-    uint32_t* sum_ptr, uint32_t* index_ptr) {
+    uint64_t* sum_ptr, uint32_t* index_ptr) {
     const uint16_t* src_16u_ptr = (uint16_t*)src_ptr;
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_16u_ptr[idx];
@@ -60,7 +65,7 @@ static void ref_qplc_aggregates_16u(const uint8_t* src_ptr, uint32_t length,
 
 static void ref_qplc_aggregates_32u(const uint8_t* src_ptr, uint32_t length,
     uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-    uint32_t* sum_ptr, uint32_t* index_ptr) {
+    uint64_t* sum_ptr, uint32_t* index_ptr) {
     const uint32_t* src_32u_ptr = (uint32_t*)src_ptr;
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_32u_ptr[idx];
@@ -85,11 +90,11 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bit_aggregates_8u, base) {
     randomizer         random_value(0u, static_cast<double>(UINT8_MAX), seed);
     uint32_t    min_value_ptr;
     uint32_t    max_value_ptr;
-    uint32_t    sum_ptr;
+    uint64_t    sum_ptr;
     uint32_t    index_ptr;
     uint32_t    ref_min_value_ptr;
     uint32_t    ref_max_value_ptr;
-    uint32_t    ref_sum_ptr;
+    uint64_t    ref_sum_ptr;
     uint32_t    ref_index_ptr;
 
     {
@@ -185,11 +190,11 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_8u, base) {
     randomizer         random_value(0u, static_cast<double>(UINT8_MAX), seed);
     uint32_t    min_value_ptr;
     uint32_t    max_value_ptr;
-    uint32_t    sum_ptr;
+    uint64_t    sum_ptr;
     uint32_t    index_ptr;
     uint32_t    ref_min_value_ptr;
     uint32_t    ref_max_value_ptr;
-    uint32_t    ref_sum_ptr;
+    uint64_t    ref_sum_ptr;
     uint32_t    ref_index_ptr;
 
     {
@@ -321,11 +326,11 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_16u, base) {
     randomizer         random_value(0u, static_cast<double>(UINT16_MAX), seed);
     uint32_t    min_value_ptr;
     uint32_t    max_value_ptr;
-    uint32_t    sum_ptr;
+    uint64_t    sum_ptr;
     uint32_t    index_ptr;
     uint32_t    ref_min_value_ptr;
     uint32_t    ref_max_value_ptr;
-    uint32_t    ref_sum_ptr;
+    uint64_t    ref_sum_ptr;
     uint32_t    ref_index_ptr;
 
     {
@@ -457,11 +462,11 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_32u, base) {
     randomizer         random_value(0u, static_cast<double>(UINT32_MAX), seed);
     uint32_t    min_value_ptr;
     uint32_t    max_value_ptr;
-    uint32_t    sum_ptr;
+    uint64_t    sum_ptr;
     uint32_t    index_ptr;
     uint32_t    ref_min_value_ptr;
     uint32_t    ref_max_value_ptr;
-    uint32_t    ref_sum_ptr;
+    uint64_t    ref_sum_ptr;
     uint32_t    ref_index_ptr;
 
     {
@@ -586,4 +591,57 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_32u, base) {
         ASSERT_EQ(index_ptr, ref_index_ptr);
     }
 }
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates, avx2) {
+    if (qpl::core_sw::dispatcher::detect_platform() < qpl::core_sw::dispatcher::avx2_arch) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+
+    const qplc_aggregates_t_ptr reference_table[] = {ref_qplc_bit_aggregates_8u,
+                                                     ref_qplc_aggregates_8u,
+                                                     ref_qplc_aggregates_16u,
+                                                     ref_qplc_aggregates_32u};
+    const uint32_t              max_values[]      = {1u, QPL_TEST_MAX_8U, QPL_TEST_MAX_16U, QPL_TEST_MAX_32U};
+    const uint32_t              element_sizes[]   = {1u, 1u, 2u, 4u};
+
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint32_t)> source{};
+    uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer         random_value(0u, static_cast<double>(UINT32_MAX), seed);
+
+    for (uint32_t function_index = fun_indx_bit_aggregates_8u;
+         function_index <= fun_indx_aggregates_32u;
+         function_index++) {
+        const uint32_t element_size = element_sizes[function_index];
+
+        for (uint32_t indx = 0; indx < TEST_BUFFER_SIZE; indx++) {
+            const uint32_t value = static_cast<uint32_t>(random_value) & max_values[function_index];
+
+            std::memcpy(source.data() + indx * element_size, &value, element_size);
+        }
+
+        // Lengths cover every tail after the 256-bit loop, initial states cover the first and the next calls
+        for (uint32_t length = 1; length <= TEST_BUFFER_SIZE; length++) {
+            for (uint32_t initial_min : {QPL_TEST_MAX_32U, 0u, 1u}) {
+                uint32_t min_value     = initial_min;
+                uint32_t max_value     = 0u;
+                uint64_t sum           = 0u;
+                uint32_t index         = length;
+                uint32_t ref_min_value = initial_min;
+                uint32_t ref_max_value = 0u;
+                uint64_t ref_sum       = 0u;
+                uint32_t ref_index     = length;
+
+                qpl::core_sw::dispatcher::avx2_aggregates_table[function_index](source.data(), length,
+                                                                               &min_value, &max_value, &sum, &index);
+                reference_table[function_index](source.data(), length,
+                                                &ref_min_value, &ref_max_value, &ref_sum, &ref_index);
+
+                ASSERT_EQ(min_value, ref_min_value) << "function: " << function_index << ", length: " << length;
+                ASSERT_EQ(max_value, ref_max_value) << "function: " << function_index << ", length: " << length;
+                ASSERT_EQ(sum, ref_sum) << "function: " << function_index << ", length: " << length;
+                ASSERT_EQ(index, ref_index) << "function: " << function_index << ", length: " << length;
+            }
+        }
+    }
+}
 }
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_checksum.h"
+#include "dispatcher.hpp"
+
+namespace qpl::core_sw::dispatcher {
+extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
+extern crc64_table_t avx512_crc64_table;
+extern crc64_table_t avx512_vpclmulqdq_crc64_table;
+}
+
+namespace qpl::test {
+
+    static uint64_t ref_reflect_64(uint64_t value) {
+        uint64_t result = 0u;
+
+        for (uint32_t i = 0u; i < 64u; i++) {
+            result |= ((value >> i) & 1u) << (63u - i);
+        }
+
+        return result;
+    }
+
+    static uint64_t ref_crc64(const uint8_t *src_ptr, uint32_t length, uint64_t crc, uint64_t polynomial, bool be_flag) {
+        if (be_flag) {
+            const uint64_t reflected_polynomial = ref_reflect_64(polynomial);
+
+            for (uint32_t i = 0u; i < length; i++) {
+                crc ^= src_ptr[i];
+                for (uint32_t j = 0u; j < 8u; j++) {
+                    crc = (crc & 1u) ? (crc >> 1u) ^ reflected_polynomial : (crc >> 1u);
+                }
+            }
+        } else {
+            for (uint32_t i = 0u; i < length; i++) {
+                crc ^= static_cast<uint64_t>(src_ptr[i]) << 56u;
+                for (uint32_t j = 0u; j < 8u; j++) {
+                    crc = (crc >> 63u) ? (crc << 1u) ^ polynomial : (crc << 1u);
+                }
+            }
+        }
+
+        return crc;
+    }
+
+    using TestEnviroment = qpl::test::util::TestEnvironment;
+    using randomizer = qpl::test::random;
+
+    constexpr uint32_t TEST_BUFFER_SIZE = 4096u + 64u;
+
+    static void check_crc64_fold(const core_sw::dispatcher::crc64_table_t &table) {
+        const auto init_constants = reinterpret_cast<qplc_crc64_init_constants_t_ptr>(table[1u]);
+        const auto fold           = reinterpret_cast<qplc_crc64_fold_t_ptr>(table[2u]);
+
+        const uint32_t seed = TestEnviroment::GetInstance().GetSeed();
+
+        randomizer random_byte(0u, UINT8_MAX, seed);
+        randomizer random_32u(0u, UINT32_MAX, seed);
+
+        std::vector<uint8_t> source(TEST_BUFFER_SIZE);
+
+        for (auto &byte : source) {
+            byte = static_cast<uint8_t>(random_byte);
+        }
+
+        qplc_crc64_constants_t constants;
+
+        for (bool be_flag : {false, true}) {
+            for (uint32_t iteration = 0u; iteration < 8u; iteration++) {
+                // Both odd and even polynomials are checked, they differ in Barrett reduction for the BE bit order
+                const uint64_t polynomial = (((static_cast<uint64_t>(static_cast<uint32_t>(random_32u)) << 32u)
+                                             | static_cast<uint32_t>(random_32u)) & ~1ULL) | (iteration & 1u);
+                const uint64_t initial_crc = static_cast<uint32_t>(random_32u);
+
+                init_constants(polynomial, be_flag, &constants);
+
+                // Lengths cover table-only, 128-bit, 512-bit and 2048-bit folding paths
+                for (uint32_t length : {0u, 1u, 15u, 16u, 17u, 63u, 64u, 65u, 80u, 255u, 256u, 257u, 511u, 1000u, 4096u}) {
+                    // Unaligned source is checked as well
+                    const uint8_t *src_ptr = source.data() + (iteration % 64u);
+
+                    const uint64_t crc           = fold(src_ptr, length, initial_crc, &constants);
+                    const uint64_t reference_crc = ref_crc64(src_ptr, length, initial_crc, polynomial, be_flag);
+
+                    ASSERT_EQ(crc, reference_crc) << "length: " << length << ", be: " << be_flag;
+                }
+
+                // Every length shorter than the widest fold block, from an unaligned source
+                for (uint32_t length = 1u; length < 256u; length++) {
+                    const uint8_t *src_ptr = source.data() + 1u + (length % 63u);
+
+                    const uint64_t crc           = fold(src_ptr, length, initial_crc, &constants);
+                    const uint64_t reference_crc = ref_crc64(src_ptr, length, initial_crc, polynomial, be_flag);
+
+                    ASSERT_EQ(crc, reference_crc) << "length: " << length << ", be: " << be_flag;
+                }
+            }
+        }
+    }
+
+    QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64_fold, base) {
+        check_crc64_fold(core_sw::dispatcher::px_crc64_table);
+    }
+
+    QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64_fold, avx2) {
+        if (core_sw::dispatcher::detect_platform() < core_sw::dispatcher::avx2_arch) {
+            GTEST_SKIP() << "AVX2 is not supported";
+        }
+
+        check_crc64_fold(core_sw::dispatcher::avx2_crc64_table);
+    }
+
+    QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64_fold, avx512) {
+        if (core_sw::dispatcher::detect_platform() < core_sw::dispatcher::avx512_arch) {
+            GTEST_SKIP() << "AVX-512 is not supported";
+        }
+
+        check_crc64_fold(core_sw::dispatcher::avx512_crc64_table);
+    }
+
+    QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64_fold, avx512_vpclmulqdq) {
+        if (core_sw::dispatcher::detect_platform() < core_sw::dispatcher::avx512_arch
+            || !core_sw::dispatcher::is_vpclmulqdq_supported()) {
+            GTEST_SKIP() << "AVX-512 VPCLMULQDQ is not supported";
+        }
+
+        check_crc64_fold(core_sw::dispatcher::avx512_vpclmulqdq_crc64_table);
+    }
+}
@@ -15,10 +15,8 @@
 #include "qplc_api.h"
 #include "dispatcher.hpp"
 
-static inline qplc_pack_bits_t_ptr qplc_pack_bits(uint32_t index) {
-    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_pack_table();
-
-    return (qplc_pack_bits_t_ptr) table[index];
+namespace qpl::core_sw::dispatcher {
+extern pack_table_t avx2_pack_table;
 }
 
 typedef void (*qplc_pack_8u_type)(const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit);
@@ -96,7 +94,8 @@ constexpr uint32_t TEST_BUFFER_SIZE = 64u;
 
 namespace qpl::test {
 using randomizer = qpl::test::random;
-QPL_UNIT_API_ALGORITHMIC_TEST(qplc_pack_8u, base) {
+
+static void check_pack_8u(const core_sw::dispatcher::pack_table_t &table) {
     std::array<uint8_t, TEST_BUFFER_SIZE> buffer{};
     std::array<uint8_t, TEST_BUFFER_SIZE> source{};
     std::array<uint8_t, TEST_BUFFER_SIZE> destination{};
@@ -123,7 +122,7 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_pack_8u, base) {
                 }
                 destination.fill(0);
                 reference.fill(0);
-                qplc_pack_bits(nbits - 1)(source.data(), length, destination.data(), start_bit);
+                table[nbits - 1](source.data(), length, destination.data(), start_bit);
                 ref_qplc_pack_8u_tabl[nbits - 1](source.data(), length, reference.data(), start_bit);
                 ASSERT_TRUE(CompareSegments(reference.begin(), reference.end(),
                     destination.begin(), destination.end(), "FAIL qplc_pack_8u!!! "));
@@ -131,4 +130,16 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_pack_8u, base) {
         }
     }
 }
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_pack_8u, base) {
+    check_pack_8u(qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_pack_table());
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_pack_8u, avx2) {
+    if (qpl::core_sw::dispatcher::detect_platform() < qpl::core_sw::dispatcher::avx2_arch) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+
+    check_pack_8u(qpl::core_sw::dispatcher::avx2_pack_table);
+}
 }
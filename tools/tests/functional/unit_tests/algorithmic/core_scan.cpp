@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#include <array>
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_api.h"
+#include "dispatcher.hpp"
+#include "check_result.hpp"
+
+namespace qpl::core_sw::dispatcher {
+extern scan_table_t   avx2_scan_table;
+extern scan_i_table_t avx2_scan_i_table;
+}
+
+// Comparisons go in the order of the scan tables: EQ, NE, LT, LE, GT, GE, RANGE, NOT_RANGE
+static uint8_t ref_qplc_scan(uint32_t comparison, uint32_t value, uint32_t low_value, uint32_t high_value) {
+    switch (comparison) {
+        case 0u: return (value == low_value) ? 1u : 0u;
+        case 1u: return (value != low_value) ? 1u : 0u;
+        case 2u: return (value < low_value) ? 1u : 0u;
+        case 3u: return (value <= low_value) ? 1u : 0u;
+        case 4u: return (value > low_value) ? 1u : 0u;
+        case 5u: return (value >= low_value) ? 1u : 0u;
+        case 6u: return (value >= low_value && value <= high_value) ? 1u : 0u;
+        default: return (value >= low_value && value <= high_value) ? 0u : 1u;
+    }
+}
+
+constexpr uint32_t SCAN_COMPARISONS_COUNT = 8u;
+constexpr uint32_t TEST_BUFFER_SIZE       = 128u;
+
+namespace qpl::test {
+using randomizer = qpl::test::random;
+
+static void check_scan(const core_sw::dispatcher::scan_table_t &table,
+                       const core_sw::dispatcher::scan_i_table_t &table_i) {
+    const uint32_t element_sizes[] = {sizeof(uint8_t), sizeof(uint16_t), sizeof(uint32_t)};
+
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint32_t)> source{};
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint32_t)> source_destination{};
+    std::array<uint8_t, TEST_BUFFER_SIZE>                    destination{};
+    std::array<uint8_t, TEST_BUFFER_SIZE>                    reference{};
+    std::array<uint32_t, TEST_BUFFER_SIZE>                   values{};
+
+    uint64_t   seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer random_value(0u, static_cast<double>(UINT32_MAX), seed);
+
+    for (uint32_t width_index = 0u; width_index < 3u; width_index++) {
+        const uint32_t element_size = element_sizes[width_index];
+
+        // Elements are close to the boundaries of the type, so the comparisons are checked for the sign bit
+        for (uint32_t indx = 0; indx < TEST_BUFFER_SIZE; indx++) {
+            const uint32_t random = static_cast<uint32_t>(random_value);
+            const uint32_t max    = (sizeof(uint32_t) == element_size) ? UINT32_MAX : (1u << (element_size * 8u)) - 1u;
+
+            values[indx] = (random & 1u) ? max - (random >> 1u) % 8u : (random >> 1u) % 8u;
+            std::memcpy(source.data() + indx * element_size, &values[indx], element_size);
+        }
+
+        for (uint32_t comparison = 0u; comparison < SCAN_COMPARISONS_COUNT; comparison++) {
+            const uint32_t table_index = width_index + comparison * 3u;
+
+            // Lengths cover every tail after the 256-bit loop
+            for (uint32_t length = 1; length <= TEST_BUFFER_SIZE; length++) {
+                const uint32_t low_value  = values[length - 1u];
+                const uint32_t high_value = values[(length * 7u) % TEST_BUFFER_SIZE];
+
+                for (uint32_t indx = 0; indx < length; indx++) {
+                    reference[indx] = ref_qplc_scan(comparison, values[indx], low_value, high_value);
+                }
+
+                destination.fill(0);
+                table[table_index](source.data(), destination.data(), length, low_value, high_value);
+
+                ASSERT_TRUE(CompareSegments(reference.begin(), reference.begin() + length,
+                                            destination.begin(), destination.begin() + length,
+                                            "FAIL qplc_scan!!! "))
+                                    << "width: " << element_size << ", comparison: " << comparison;
+
+                source_destination = source;
+                table_i[table_index](source_destination.data(), length, low_value, high_value);
+
+                ASSERT_TRUE(CompareSegments(reference.begin(), reference.begin() + length,
+                                            source_destination.begin(), source_destination.begin() + length,
+                                            "FAIL qplc_scan_i!!! "))
+                                    << "width: " << element_size << ", comparison: " << comparison;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan, base) {
+    const auto &dispatcher = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance();
+
+    check_scan(dispatcher.get_scan_table(), dispatcher.get_scan_i_table());
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan, avx2) {
+    if (qpl::core_sw::dispatcher::detect_platform() < qpl::core_sw::dispatcher::avx2_arch) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+
+    check_scan(qpl::core_sw::dispatcher::avx2_scan_table, qpl::core_sw::dispatcher::avx2_scan_i_table);
+}
+}
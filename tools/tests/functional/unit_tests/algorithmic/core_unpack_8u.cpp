@@ -21,10 +21,8 @@ static inline qplc_pack_bits_t_ptr qplc_pack_bits(uint32_t index) {
     return (qplc_pack_bits_t_ptr) table[index];
 }
 
-static inline qplc_unpack_bits_t_ptr qplc_unpack_bits(uint32_t index) {
-    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
-
-    return (qplc_unpack_bits_t_ptr) table[index];
+namespace qpl::core_sw::dispatcher {
+extern unpack_table_t avx2_unpack_table;
 }
 
 static void fill_src_buffer_8u(uint8_t* src, uint8_t* dst, size_t length, uint32_t nbits) {
@@ -45,7 +43,7 @@ constexpr uint32_t TEST_BUFFER_SIZE = 64u;
 
 namespace qpl::test {
 using randomizer = qpl::test::random;
-QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_8u, base) {
+static void check_unpack_8u(const core_sw::dispatcher::unpack_table_t &table) {
     std::array<uint8_t, TEST_BUFFER_SIZE> buffer{};
     std::array<uint8_t, TEST_BUFFER_SIZE> source{};
     std::array<uint8_t, TEST_BUFFER_SIZE> source_pack{};
@@ -77,11 +75,23 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_8u, base) {
 
                 qplc_pack_bits(nbits - 1)(source.data(), length, source_pack.data(), start_bit);
                 fill_reference_buffer_8u(source.data(), reference.data(), length);
-                qplc_unpack_bits(nbits - 1)(source_pack.data(), length, start_bit, destination.data());
+                table[nbits - 1](source_pack.data(), length, start_bit, destination.data());
                 ASSERT_TRUE(CompareSegments(reference.begin(), reference.end(),
                     destination.begin(), destination.end(), "FAIL qplc_unpack_8u!!! "));
             }
         }
     }
 }
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_8u, base) {
+    check_unpack_8u(qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table());
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_8u, avx2) {
+    if (qpl::core_sw::dispatcher::detect_platform() < qpl::core_sw::dispatcher::avx2_arch) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+
+    check_unpack_8u(qpl::core_sw::dispatcher::avx2_unpack_table);
+}
 }
@@ -0,0 +1,308 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Tests
+ */
+
+#if defined( __linux__ ) && defined( QPL_HW_EMULATION )
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "hw_descriptors_api.h"
+#include "hw_completion_record_api.h"
+#include "hw_status.h"
+#include "dispatcher/hw_emulated_queue.hpp"
+#include "../t_common.hpp"
+
+namespace qpl::test {
+
+using namespace qpl::ml::dispatcher;
+
+constexpr uint64_t crc64_polynomial = 0x9A6C9329AC4BC9B5ull;
+
+struct job_deleter_t {
+    void operator()(qpl_job *job_ptr) const {
+        qpl_fini_job(job_ptr);
+        delete[] reinterpret_cast<uint8_t *>(job_ptr);
+    }
+};
+
+using job_ptr_t = std::unique_ptr<qpl_job, job_deleter_t>;
+
+static auto init_job(qpl_path_t path) -> job_ptr_t {
+    uint32_t size = 0u;
+
+    if (QPL_STS_OK != qpl_get_job_size(path, &size)) {
+        return nullptr;
+    }
+
+    auto *job_ptr = reinterpret_cast<qpl_job *>(new uint8_t[size]);
+
+    if (QPL_STS_OK != qpl_init_job(path, job_ptr)) {
+        delete[] reinterpret_cast<uint8_t *>(job_ptr);
+
+        return nullptr;
+    }
+
+    return job_ptr_t(job_ptr);
+}
+
+static auto generate_text(uint32_t size, uint32_t seed) -> std::vector<uint8_t> {
+    const std::vector<std::string> words = {"select ", "from ", "where ", "column ", "table ", "group by "};
+
+    std::mt19937                            random_generator(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0u, UINT8_MAX);
+    std::vector<uint8_t>                    text;
+
+    while (text.size() < size) {
+        const auto &word = words[distribution(random_generator) % words.size()];
+
+        text.insert(text.end(), word.begin(), word.end());
+
+        if (0u == distribution(random_generator) % 8u) {
+            text.push_back(static_cast<uint8_t>(distribution(random_generator)));
+        }
+    }
+
+    text.resize(size);
+
+    return text;
+}
+
+static auto compress(qpl_path_t path,
+                     const std::vector<uint8_t> &source,
+                     uint32_t chunk_size,
+                     uint32_t flags) -> std::vector<uint8_t> {
+    auto job_ptr = init_job(path);
+
+    if (!job_ptr) {
+        return {};
+    }
+
+    std::vector<uint8_t> destination(source.size() * 2u + 1024u);
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    for (uint32_t offset = 0u; offset < source.size(); offset += chunk_size) {
+        const uint32_t size = std::min(chunk_size, static_cast<uint32_t>(source.size()) - offset);
+
+        job_ptr->next_in_ptr  = const_cast<uint8_t *>(source.data()) + offset;
+        job_ptr->available_in = size;
+        job_ptr->flags        = flags
+                                | ((0u == offset) ? QPL_FLAG_FIRST : 0u)
+                                | ((offset + size == source.size()) ? QPL_FLAG_LAST : 0u);
+
+        if (QPL_STS_OK != qpl_execute_job(job_ptr.get())) {
+            return {};
+        }
+    }
+
+    destination.resize(job_ptr->total_out);
+
+    return destination;
+}
+
+static auto decompress(qpl_path_t path,
+                       const std::vector<uint8_t> &source,
+                       uint32_t chunk_size,
+                       uint32_t uncompressed_size) -> std::vector<uint8_t> {
+    auto job_ptr = init_job(path);
+
+    if (!job_ptr) {
+        return {};
+    }
+
+    std::vector<uint8_t> destination(uncompressed_size);
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    for (uint32_t offset = 0u; offset < source.size(); offset += chunk_size) {
+        const uint32_t size = std::min(chunk_size, static_cast<uint32_t>(source.size()) - offset);
+
+        job_ptr->next_in_ptr  = const_cast<uint8_t *>(source.data()) + offset;
+        job_ptr->available_in = size;
+        job_ptr->flags        = ((0u == offset) ? QPL_FLAG_FIRST : 0u)
+                                | ((offset + size == source.size()) ? QPL_FLAG_LAST : 0u);
+
+        if (QPL_STS_OK != qpl_execute_job(job_ptr.get())) {
+            return {};
+        }
+    }
+
+    destination.resize(job_ptr->total_out);
+
+    return destination;
+}
+
+/**
+ * @brief Submits the descriptor to the queue and polls its completion record
+ */
+static auto execute(hw_emulated_queue &queue, hw_descriptor &descriptor, hw_iaa_completion_record &record) -> bool {
+    hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<hw_completion_record *>(&record));
+
+    if (queue.enqueue_descriptor(&descriptor)) {
+        return false;
+    }
+
+    while (AD_STATUS_INPROG == reinterpret_cast<volatile hw_iaa_completion_record &>(record).status) {
+    }
+
+    return true;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_queue, crc64) {
+    const auto source = generate_text(10000u, 1u);
+
+    uint64_t crc[2] = {};
+
+    for (auto path : {qpl_path_software, qpl_path_hardware}) {
+        auto job_ptr = init_job(path);
+        ASSERT_NE(nullptr, job_ptr);
+
+        job_ptr->op           = qpl_op_crc64;
+        job_ptr->next_in_ptr  = const_cast<uint8_t *>(source.data());
+        job_ptr->available_in = static_cast<uint32_t>(source.size());
+        job_ptr->crc64_poly   = crc64_polynomial;
+        job_ptr->flags        = QPL_FLAG_CRC64_INV;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr.get()));
+
+        crc[qpl_path_hardware == path] = job_ptr->crc64;
+    }
+
+    EXPECT_EQ(crc[0], crc[1]);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_queue, scan) {
+    const auto source = generate_text(10000u, 2u);
+
+    std::vector<uint8_t> destination[2];
+
+    for (auto path : {qpl_path_software, qpl_path_hardware}) {
+        auto job_ptr = init_job(path);
+        ASSERT_NE(nullptr, job_ptr);
+
+        auto &output = destination[qpl_path_hardware == path];
+
+        output.assign(source.size() / 8u, 0u);
+
+        job_ptr->op                 = qpl_op_scan_range;
+        job_ptr->next_in_ptr        = const_cast<uint8_t *>(source.data());
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = output.data();
+        job_ptr->available_out      = static_cast<uint32_t>(output.size());
+        job_ptr->src1_bit_width     = 8u;
+        job_ptr->num_input_elements = static_cast<uint32_t>(source.size());
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->param_low          = 'a';
+        job_ptr->param_high         = 'm';
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr.get()));
+
+        output.resize(job_ptr->total_out);
+    }
+
+    EXPECT_EQ(destination[0], destination[1]);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_queue, decompress) {
+    const auto source     = generate_text(100000u, 3u);
+    const auto compressed = compress(qpl_path_software, source, static_cast<uint32_t>(source.size()),
+                                     QPL_FLAG_DYNAMIC_HUFFMAN);
+    ASSERT_FALSE(compressed.empty());
+
+    const auto size = static_cast<uint32_t>(source.size());
+
+    // Single job, then the stream continued by the next jobs through AECS
+    EXPECT_EQ(source, decompress(qpl_path_hardware, compressed, static_cast<uint32_t>(compressed.size()), size));
+    EXPECT_EQ(source, decompress(qpl_path_hardware, compressed, 997u, size));
+    EXPECT_EQ(source, decompress(qpl_path_hardware, compressed, 1u << 12u, size));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_queue, compress) {
+    const auto source = generate_text(100000u, 4u);
+    const auto size   = static_cast<uint32_t>(source.size());
+
+    // Compressed stream is verified by the library with the suppressed output decompress
+    for (uint32_t flags : {0u, static_cast<uint32_t>(QPL_FLAG_DYNAMIC_HUFFMAN)}) {
+        for (uint32_t chunk_size : {size, 10000u, 4099u}) {
+            const auto compressed = compress(qpl_path_hardware, source, chunk_size, flags);
+            ASSERT_FALSE(compressed.empty());
+
+            EXPECT_EQ(source, decompress(qpl_path_software, compressed, static_cast<uint32_t>(compressed.size()), size))
+                                << "flags: " << flags << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_queue, latency_and_queue_depth) {
+    constexpr uint32_t engines_count = 1u;
+    constexpr uint32_t queue_depth   = 2u;
+    constexpr auto     latency       = std::chrono::milliseconds(50);
+    constexpr uint32_t max_accepted  = engines_count + queue_depth;
+
+    const auto source = generate_text(1024u, 6u);
+
+    hw_emulated_queue queue(engines_count, queue_depth, latency);
+
+    EXPECT_EQ(engines_count, queue.engines_count());
+    EXPECT_EQ(queue_depth, queue.queue_depth());
+    EXPECT_EQ(latency, queue.latency());
+
+    alignas(64) hw_descriptor            descriptors[max_accepted + 1u];
+    alignas(64) hw_iaa_completion_record records[max_accepted + 1u] = {};
+
+    // The engine holds each descriptor for the latency, so the burst overflows the queue
+    const auto start_time = std::chrono::steady_clock::now();
+    uint32_t   accepted   = 0u;
+
+    for (uint32_t i = 0u; i <= max_accepted; i++) {
+        hw_iaa_descriptor_init_crc64(&descriptors[i], source.data(), 1024u, crc64_polynomial, false, false);
+        hw_iaa_descriptor_set_completion_record(&descriptors[i], reinterpret_cast<hw_completion_record *>(&records[i]));
+
+        if (queue.enqueue_descriptor(&descriptors[i])) {
+            break;
+        }
+
+        accepted++;
+    }
+
+    EXPECT_GE(accepted, queue_depth);
+    EXPECT_LE(accepted, max_accepted);
+
+    for (uint32_t i = 0u; i < accepted; i++) {
+        while (AD_STATUS_INPROG == reinterpret_cast<volatile hw_iaa_completion_record &>(records[i]).status) {
+        }
+
+        EXPECT_EQ(AD_STATUS_SUCCESS, records[i].status);
+    }
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start_time, latency);
+
+    // Queue accepts descriptors again after they are completed
+    alignas(64) hw_iaa_completion_record record = {};
+
+    ASSERT_TRUE(execute(queue, descriptors[0], record));
+    EXPECT_EQ(AD_STATUS_SUCCESS, record.status);
+}
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Tests
+ */
+
+#include <memory>
+#include <vector>
+
+#include "dispatcher/hw_scheduler.hpp"
+#include "../t_common.hpp"
+
+namespace qpl::test {
+
+using namespace qpl::ml::dispatcher;
+
+static auto order(const std::vector<hw_load_t> &loads, uint32_t rotation) -> std::vector<uint32_t> {
+    std::vector<uint32_t> indices(loads.size());
+
+    order_by_load(static_cast<uint32_t>(loads.size()),
+                  [&loads](uint32_t index) { return loads[index]; },
+                  rotation,
+                  indices.data());
+
+    return indices;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_scheduler, least_loaded_first) {
+    const std::vector<hw_load_t> loads = {{5u, 16u, 1u}, {0u, 16u, 1u}, {3u, 16u, 1u}};
+
+    EXPECT_EQ(order(loads, 0u), (std::vector<uint32_t>{1u, 2u, 0u}));
+    EXPECT_EQ(order(loads, 2u), (std::vector<uint32_t>{1u, 2u, 0u}));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_scheduler, size_and_priority_weighting) {
+    // The same backlog drains faster from the larger queue
+    EXPECT_TRUE(is_less_loaded({3u, 32u, 1u}, {3u, 16u, 1u}));
+
+    // The same backlog drains faster from the higher priority queue
+    EXPECT_TRUE(is_less_loaded({3u, 16u, 2u}, {3u, 16u, 1u}));
+
+    // The same expected completion time isn't less loaded
+    EXPECT_FALSE(is_less_loaded({7u, 32u, 1u}, {3u, 16u, 1u}));
+
+    const std::vector<hw_load_t> loads = {{2u, 8u, 1u}, {2u, 8u, 4u}, {2u, 32u, 1u}};
+
+    EXPECT_EQ(order(loads, 0u), (std::vector<uint32_t>{1u, 2u, 0u}));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_scheduler, round_robin_on_equal_load) {
+    const std::vector<hw_load_t> loads(4u, hw_load_t{1u, 16u, 1u});
+
+    for (uint32_t rotation = 0u; rotation < 4u; rotation++) {
+        const auto indices = order(loads, rotation);
+
+        for (uint32_t i = 0u; i < 4u; i++) {
+            EXPECT_EQ(indices[i], (rotation + i) % 4u);
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_scheduler, spill_over) {
+    EXPECT_TRUE(is_spill_over_allowed({0u, 16u, 1u}));
+    EXPECT_TRUE(is_spill_over_allowed({7u, 16u, 1u}));
+    EXPECT_FALSE(is_spill_over_allowed({8u, 16u, 1u}));
+    EXPECT_FALSE(is_spill_over_allowed({20u, 16u, 1u}));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_scheduler, inflight_tracking) {
+    auto tracker = std::make_unique<hw_inflight_tracker>();
+
+    hw_occupancy first_queue;
+    hw_occupancy second_queue;
+
+    alignas(32) uint8_t records[4][64] = {};
+
+    ASSERT_TRUE(tracker->track(records[0], &first_queue));
+    ASSERT_TRUE(tracker->track(records[1], &first_queue));
+    ASSERT_TRUE(tracker->track(records[2], &second_queue));
+
+    EXPECT_EQ(first_queue.in_flight(), 2u);
+    EXPECT_EQ(second_queue.in_flight(), 1u);
+
+    // Busy queue rejected the descriptor
+    tracker->cancel(records[2]);
+
+    EXPECT_EQ(second_queue.in_flight(), 0u);
+    EXPECT_EQ(second_queue.submitted(), 0u);
+
+    tracker->release(records[0]);
+
+    EXPECT_EQ(first_queue.in_flight(), 1u);
+    EXPECT_EQ(first_queue.completed(), 1u);
+
+    // Completion is observed once
+    tracker->release(records[0]);
+    tracker->release(records[3]);
+
+    EXPECT_EQ(first_queue.in_flight(), 1u);
+    EXPECT_EQ(first_queue.completed(), 1u);
+
+    // Reused record releases the descriptor which completion wasn't checked
+    ASSERT_TRUE(tracker->track(records[1], &second_queue));
+
+    EXPECT_EQ(first_queue.in_flight(), 0u);
+    EXPECT_EQ(first_queue.completed(), 2u);
+    EXPECT_EQ(second_queue.in_flight(), 1u);
+    EXPECT_EQ(second_queue.submitted(), 1u);
+}
+
+}
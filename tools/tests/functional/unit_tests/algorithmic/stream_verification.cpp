@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Tests
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "job.hpp"
+#include "../t_common.hpp"
+
+namespace qpl::test {
+
+using namespace qpl::job;
+
+constexpr uint32_t verify_interval = 3u;
+constexpr uint32_t streams_count   = 3u * verify_interval;
+constexpr uint32_t jobs_count      = 3u;
+
+static auto job_flags(uint32_t job) -> uint32_t {
+    uint32_t flags = QPL_FLAG_DYNAMIC_HUFFMAN;
+
+    flags |= (0u == job) ? QPL_FLAG_FIRST : 0u;
+    flags |= (jobs_count - 1u == job) ? QPL_FLAG_LAST : 0u;
+
+    return flags;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(stream_verification, interval) {
+    own_compression_state_t state{};
+    qpl_job                 job{};
+
+    job.data_ptr.compress_state_ptr = reinterpret_cast<uint8_t *>(&state);
+
+    uint32_t verified_count = 0u;
+
+    for (uint32_t stream = 0u; stream < streams_count; stream++) {
+        const bool is_expected_verified = (0u == stream % verify_interval);
+
+        for (uint32_t job_index = 0u; job_index < jobs_count; job_index++) {
+            // The interval changed in the middle of a stream takes effect from the next stream only
+            job.verify_interval = (0u == job_index) ? verify_interval : 1u;
+            job.flags           = job_flags(job_index);
+
+            EXPECT_EQ(is_stream_verification_enabled(&job), is_expected_verified)
+                                << "stream: " << stream << ", job: " << job_index;
+        }
+
+        verified_count += is_expected_verified ? 1u : 0u;
+
+        update_streams_count(&job);
+    }
+
+    EXPECT_EQ(verified_count, streams_count / verify_interval);
+
+    // 0 and 1 verify every stream, QPL_FLAG_OMIT_VERIFY disables verification regardless of the interval
+    for (uint32_t interval : {0u, 1u}) {
+        job.verify_interval = interval;
+        job.flags           = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        EXPECT_TRUE(is_stream_verification_enabled(&job)) << "interval: " << interval;
+
+        job.flags |= QPL_FLAG_OMIT_VERIFY;
+        EXPECT_FALSE(is_stream_verification_enabled(&job)) << "interval: " << interval;
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(stream_verification, multiple_jobs) {
+    uint32_t job_size = 0u;
+
+    ASSERT_EQ(qpl_get_job_size(qpl_path_software, &job_size), QPL_STS_OK);
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto *job_ptr   = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    ASSERT_EQ(qpl_init_job(qpl_path_software, job_ptr), QPL_STS_OK);
+
+    const auto *state_ptr = reinterpret_cast<const own_compression_state_t *>(job_ptr->data_ptr.compress_state_ptr);
+
+    std::vector<uint8_t> source;
+    const std::string    line = "Only one of every verify_interval streams is decompressed by the verification. ";
+
+    while (source.size() < 64u * 1024u) {
+        source.insert(source.end(), line.begin(), line.end());
+        source.push_back(static_cast<uint8_t>(source.size()));
+    }
+
+    std::vector<uint8_t> destination(source.size() * 2u, 0u);
+
+    const auto chunk_size = static_cast<uint32_t>(source.size()) / jobs_count;
+
+    uint32_t verified_count = 0u;
+
+    for (uint32_t stream = 0u; stream < streams_count; stream++) {
+        const bool is_expected_verified = (0u == stream % verify_interval);
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+        for (uint32_t job_index = 0u; job_index < jobs_count; job_index++) {
+            const bool is_last_job = (jobs_count - 1u == job_index);
+
+            job_ptr->verify_interval = (0u == job_index) ? verify_interval : 1u;
+            job_ptr->flags           = job_flags(job_index);
+            job_ptr->next_in_ptr     = source.data() + job_index * chunk_size;
+            job_ptr->available_in    = (is_last_job) ?
+                                       static_cast<uint32_t>(source.size()) - job_index * chunk_size :
+                                       chunk_size;
+
+            ASSERT_EQ(qpl_execute_job(job_ptr), QPL_STS_OK) << "stream: " << stream << ", job: " << job_index;
+
+            EXPECT_EQ(0u != state_ptr->is_stream_verified, is_expected_verified)
+                                << "stream: " << stream << ", job: " << job_index;
+        }
+
+        verified_count += (0u != state_ptr->is_stream_verified) ? 1u : 0u;
+    }
+
+    EXPECT_EQ(verified_count, streams_count / verify_interval);
+    EXPECT_EQ(state_ptr->streams_count, streams_count);
+
+    EXPECT_EQ(qpl_fini_job(job_ptr), QPL_STS_OK);
+}
+}
@@ -134,6 +134,9 @@ namespace qpl::test
             case qpl_op_scan_not_range:
                 return "ScanNotRange";
 
+            case qpl_op_scan_program:
+                return "ScanProgram";
+
             case qpl_op_extract:
                 return "Extract";
 